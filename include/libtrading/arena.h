@@ -0,0 +1,36 @@
+#ifndef LIBTRADING_ARENA_H
+#define LIBTRADING_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/*
+ * Bump allocator for storage that lives as long as one message. Memory
+ * comes from a list of large chunks that arena_reset() rewinds rather
+ * than frees, so once the arena has grown to fit the largest message
+ * allocating from it is just a pointer bump.
+ */
+struct arena_chunk;
+
+struct arena {
+	struct arena_chunk	*chunks;	/* first chunk */
+	struct arena_chunk	*current;
+	size_t			chunk_size;
+	size_t			used;		/* bytes taken from current chunk */
+	size_t			last;		/* offset of the latest allocation */
+};
+
+struct arena *arena_new(size_t chunk_size);
+void arena_delete(struct arena *self);
+void arena_reset(struct arena *self);
+void *arena_alloc(struct arena *self, size_t size);
+void *arena_grow(struct arena *self, void *ptr, size_t old_size, size_t new_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -6,6 +6,8 @@ extern "C" {
 #endif
 
 #include <libtrading/types.h>
+#include <libtrading/byte-order.h>
+#include <libtrading/scan.h>
 
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -13,14 +15,24 @@ extern "C" {
 #include <stdbool.h>
 #include <stdarg.h>
 #include <stdint.h>
+#include <string.h>
+#include <time.h>	/* for struct timespec */
 #include <unistd.h>	/* for ssize_t */
 #include <zlib.h>	/* for z_stream */
 
+enum buffer_type {
+	BUFFER_TYPE_LINEAR,
+	BUFFER_TYPE_MIRROR,	/* ring buffer backed by a double-mapped region */
+	BUFFER_TYPE_MMAP,	/* read-only file mapping from buffer_mmap() */
+};
+
 struct buffer {
 	unsigned long		start;
 	unsigned long		end;
 	unsigned long		capacity;
 	char			*data;
+	unsigned long		mirror;	/* size of the mirrored region, 0 if linear */
+	enum buffer_type	type;	/* of the constructor, 0 for caller-built buffers */
 };
 
 struct buffer *buffer_new(unsigned long capacity);
@@ -31,6 +43,7 @@ u8 buffer_sum(struct buffer *self);
 
 void buffer_append(struct buffer *dst, struct buffer *src);
 ssize_t buffer_recv(struct buffer *self, int sockfd, size_t size, int flags);
+ssize_t buffer_recv_ts(struct buffer *self, int sockfd, size_t size, int flags, struct timespec *ts);
 ssize_t buffer_xread(struct buffer *self, int fd);
 ssize_t buffer_nxread(struct buffer *buf, int fd, size_t size);
 ssize_t buffer_xwrite(struct buffer *self, int fd);
@@ -43,9 +56,22 @@ static inline u8 buffer_peek_8(const struct buffer *self)
 	return self->data[self->start];
 }
 
-static inline le16 buffer_peek_le16(const struct buffer *self)
+static inline u16 buffer_peek_le16(const struct buffer *self)
 {
-	return ((u8)(self->data[self->start + 1]) << 8) | (u8)(self->data[self->start]);
+	le16 x;
+
+	memcpy(&x, &self->data[self->start], sizeof(x));
+
+	return le16_to_cpu(x);
+}
+
+static inline u16 buffer_peek_be16(const struct buffer *self)
+{
+	be16 x;
+
+	memcpy(&x, &self->data[self->start], sizeof(x));
+
+	return be16_to_cpu(x);
 }
 
 static inline u8 buffer_get_8(struct buffer *self)
@@ -58,52 +84,78 @@ static inline char buffer_get_char(struct buffer *self)
 	return buffer_get_8(self);
 }
 
+/*
+ * The multi-byte accessors below do one unaligned load each. Like
+ * buffer_get_8() they do not check that the bytes are there; use a
+ * buffer_view to validate a whole frame up front.
+ */
 static inline u16 buffer_get_le16(struct buffer *self)
 {
-	u16 x = 0;
-	x |= (u16)buffer_get_8(self);
-	x |= (u16)buffer_get_8(self) << 8;
+	u16 x = buffer_peek_le16(self);
+
+	self->start += sizeof(x);
+
 	return x;
 }
 
 static inline u32 buffer_get_le32(struct buffer *self)
 {
-	u32 x = 0;
-	x |= (u32)buffer_get_8(self);
-	x |= (u32)buffer_get_8(self) << 8;
-	x |= (u32)buffer_get_8(self) << 16;
-	x |= (u32)buffer_get_8(self) << 24;
-	return x;
+	le32 x;
+
+	memcpy(&x, &self->data[self->start], sizeof(x));
+
+	self->start += sizeof(x);
+
+	return le32_to_cpu(x);
 }
 
-static inline uint64_t buffer_get_le64(struct buffer *self)
+static inline u64 buffer_get_le64(struct buffer *self)
 {
-	uint64_t x = 0;
-	x |= (uint64_t)buffer_get_8(self);
-	x |= (uint64_t)buffer_get_8(self) << 8;
-	x |= (uint64_t)buffer_get_8(self) << 16;
-	x |= (uint64_t)buffer_get_8(self) << 24;
-	x |= (uint64_t)buffer_get_8(self) << 32;
-	x |= (uint64_t)buffer_get_8(self) << 40;
-	x |= (uint64_t)buffer_get_8(self) << 48;
-	x |= (uint64_t)buffer_get_8(self) << 56;
-	return x;
+	le64 x;
+
+	memcpy(&x, &self->data[self->start], sizeof(x));
+
+	self->start += sizeof(x);
+
+	return le64_to_cpu(x);
 }
 
 static inline u16 buffer_get_be16(struct buffer *self)
 {
-	u16 x = 0;
-	x |= (u16)buffer_get_8(self) << 8;
-	x |= (u16)buffer_get_8(self);
+	u16 x = buffer_peek_be16(self);
+
+	self->start += sizeof(x);
+
 	return x;
 }
 
+static inline u32 buffer_get_be32(struct buffer *self)
+{
+	be32 x;
+
+	memcpy(&x, &self->data[self->start], sizeof(x));
+
+	self->start += sizeof(x);
+
+	return be32_to_cpu(x);
+}
+
+static inline u64 buffer_get_be64(struct buffer *self)
+{
+	be64 x;
+
+	memcpy(&x, &self->data[self->start], sizeof(x));
+
+	self->start += sizeof(x);
+
+	return be64_to_cpu(x);
+}
+
 static inline void buffer_get_n(struct buffer *self, int n, char *dst)
 {
-	int i;
+	memcpy(dst, &self->data[self->start], n);
 
-	for (i = 0; i < n; i++)
-		*dst++ = buffer_get_8(self);
+	self->start += n;
 }
 
 /* User must ensure that there is space to store a byte */
@@ -151,24 +203,98 @@ static inline void buffer_to_iovec(struct buffer *b, struct iovec *iov)
 static inline void buffer_reset(struct buffer *buf)
 {
 	buf->start = buf->end = 0;
+
+	if (buf->mirror)
+		buf->capacity = buf->mirror;
 }
 
 static inline char *buffer_find(struct buffer *buf, u8 c)
 {
-	while (buffer_size(buf)) {
-		if (buffer_peek_8(buf) == c) {
-			return buffer_start(buf);
-		}
-		buffer_advance(buf, 1);
-	}
-	return NULL;
+	const char *p;
+
+	p = scan_byte(buffer_start(buf), buffer_end(buf), c);
+
+	buffer_advance(buf, (p ? p : buffer_end(buf)) - buffer_start(buf));
+
+	return (char *) p;
+}
+
+/*
+ * A window onto one binary frame at the start of a buffer. The frame
+ * length is checked once, when the view is taken; the view_*() field
+ * accessors then load fixed-width fields at constant offsets with a
+ * single unaligned load and no further checks. Callers must only read
+ * fields that end within 'len'.
+ */
+struct buffer_view {
+	const char		*data;
+	size_t			len;
+};
+
+static inline bool buffer_view(const struct buffer *self, size_t len, struct buffer_view *view)
+{
+	if (buffer_size(self) < len)
+		return false;
+
+	view->data	= buffer_start(self);
+	view->len	= len;
+
+	return true;
+}
+
+static inline const void *view_ptr(const struct buffer_view *view, size_t offset)
+{
+	return view->data + offset;
+}
+
+static inline u8 view_8(const struct buffer_view *view, size_t offset)
+{
+	return view->data[offset];
+}
+
+#define VIEW_LOAD(name, type, conv)						\
+static inline u##type view_##name(const struct buffer_view *view, size_t offset)	\
+{										\
+	name x;									\
+										\
+	memcpy(&x, view->data + offset, sizeof(x));				\
+										\
+	return conv(x);								\
 }
 
+VIEW_LOAD(le16, 16, le16_to_cpu)
+VIEW_LOAD(le32, 32, le32_to_cpu)
+VIEW_LOAD(le64, 64, le64_to_cpu)
+VIEW_LOAD(be16, 16, be16_to_cpu)
+VIEW_LOAD(be32, 32, be32_to_cpu)
+VIEW_LOAD(be64, 64, be64_to_cpu)
+
+#undef VIEW_LOAD
+
 void buffer_compact(struct buffer *buf);
 
+enum buffer_mmap_flags {
+	BUFFER_MMAP_POPULATE	= 1U << 0,	/* pre-fault the whole file */
+	BUFFER_MMAP_SEQUENTIAL	= 1U << 1,	/* MADV_SEQUENTIAL */
+	BUFFER_MMAP_HUGEPAGE	= 1U << 2,	/* MADV_HUGEPAGE */
+};
+
+struct buffer_mmap_cfg {
+	unsigned int		flags;
+	size_t			readahead;	/* MADV_WILLNEED window ahead of start, 0 for none */
+	size_t			release;	/* MADV_DONTNEED consumed data in steps of this size, 0 to keep it */
+};
+
+void buffer_mmap_cfg_init(struct buffer_mmap_cfg *cfg);
 struct buffer *buffer_mmap(int fd, size_t len);
+struct buffer *buffer_mmap_with(int fd, size_t len, const struct buffer_mmap_cfg *cfg);
+int buffer_mmap_advance(struct buffer *buf);
 void buffer_munmap(struct buffer *buf);
 
+struct buffer *buffer_mirror_new(unsigned long capacity);
+void buffer_mirror_delete(struct buffer *buf);
+void buffer_mirror_wrap(struct buffer *buf);
+
 ssize_t buffer_inflate(struct buffer *comp_buf, struct buffer *uncomp_buf, z_stream *stream);
 
 #ifdef __cplusplus
@@ -0,0 +1,43 @@
+#ifndef LIBTRADING_CPU_H
+#define LIBTRADING_CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+/*
+ * Instruction set extensions the out-of-line kernels (scan_bitmap(),
+ * buffer_sum_range()) pick from on every call. The CPU is probed on first
+ * use. cpu_features_disable() hides features so that tests and benchmarks
+ * can run the fallbacks; it is not meant to race with the kernels.
+ */
+enum cpu_feature {
+	CPU_FEATURE_SSE2	= 1U << 0,
+	CPU_FEATURE_AVX2	= 1U << 1,
+
+	CPU_FEATURE_PROBED	= 1U << 31,	/* keeps the set non-zero once probed */
+};
+
+extern unsigned int cpu_feature_set;
+
+unsigned int cpu_features_probe(void);
+void cpu_features_disable(unsigned int features);
+void cpu_features_reset(void);
+
+static inline bool cpu_has(enum cpu_feature feature)
+{
+	unsigned int features = cpu_feature_set;
+
+	if (__builtin_expect(!features, 0))
+		features = cpu_features_probe();
+
+	return features & feature;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
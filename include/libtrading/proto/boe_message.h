@@ -181,6 +181,11 @@ struct boe_logout {
 	struct boe_unit			Units[];
 } __attribute__((packed));
 
+/*
+ * Returns the next complete message in place, or NULL if the buffer does
+ * not hold one yet. The message stays valid until the buffer is reused.
+ */
+struct boe_message *boe_message_view(struct buffer *buf);
 int boe_message_decode(struct buffer *buf, struct boe_message *msg, size_t size);
 
 static inline void *boe_message_payload(struct boe_message *msg)
@@ -0,0 +1,761 @@
+#ifndef LIBTRADING_CME_GLOBEX_FIX_H
+#define LIBTRADING_CME_GLOBEX_FIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/proto/fix_session.h"
+
+extern struct fix_dialect cme_globex_fix_dialect;
+
+enum cme_globex_fix_tag {
+	CME_GLOBEX_TAG_MsgSeqNum = 34,
+	CME_GLOBEX_TAG_PossDupFlag = 43,
+	CME_GLOBEX_TAG_SenderCompID = 49,
+	CME_GLOBEX_TAG_SenderSubID = 50,
+	CME_GLOBEX_TAG_SendingTime = 52,
+	CME_GLOBEX_TAG_LastMsgSeqNumProcessed = 369,
+	CME_GLOBEX_TAG_TargetCompID = 56,
+	CME_GLOBEX_TAG_TargetSubID = 57,
+	CME_GLOBEX_TAG_PossResend = 97,
+	CME_GLOBEX_TAG_OrigSendingTime = 122,
+	CME_GLOBEX_TAG_SenderLocationID = 142,
+	CME_GLOBEX_TAG_TargetLocationID = 143,
+	CME_GLOBEX_TAG_CheckSum = 10,
+	CME_GLOBEX_TAG_RawDataLength = 95,
+	CME_GLOBEX_TAG_RawData = 96,
+	CME_GLOBEX_TAG_EncryptMethod = 98,
+	CME_GLOBEX_TAG_HeartBtInt = 108,
+	CME_GLOBEX_TAG_ResetSeqNumFlag = 141,
+	CME_GLOBEX_TAG_ApplicationSystemName = 1603,
+	CME_GLOBEX_TAG_TradingSystemVersion = 1604,
+	CME_GLOBEX_TAG_ApplicationSystemVendor = 1605,
+	CME_GLOBEX_TAG_TestReqID = 112,
+	CME_GLOBEX_TAG_BeginSeqNo = 7,
+	CME_GLOBEX_TAG_EndSeqNo = 16,
+	CME_GLOBEX_TAG_RefSeqNum = 45,
+	CME_GLOBEX_TAG_Text = 58,
+	CME_GLOBEX_TAG_RefTagID = 371,
+	CME_GLOBEX_TAG_RefMsgType = 372,
+	CME_GLOBEX_TAG_SessionRejectReason = 373,
+	CME_GLOBEX_TAG_BusinessRejectRefID = 379,
+	CME_GLOBEX_TAG_BusinessRejectReason = 380,
+	CME_GLOBEX_TAG_NewSeqNo = 36,
+	CME_GLOBEX_TAG_GapFillFlag = 123,
+	CME_GLOBEX_TAG_NextExpectedMsgSeqNum = 789,
+	CME_GLOBEX_TAG_ManualOrderIndicator = 1028,
+	CME_GLOBEX_TAG_CustOrderHandlingInst = 1031,
+	CME_GLOBEX_TAG_Account = 1,
+	CME_GLOBEX_TAG_ClOrdID = 11,
+	CME_GLOBEX_TAG_HandlInst = 21,
+	CME_GLOBEX_TAG_OrderQty = 38,
+	CME_GLOBEX_TAG_OrdType = 40,
+	CME_GLOBEX_TAG_Price = 44,
+	CME_GLOBEX_TAG_Side = 54,
+	CME_GLOBEX_TAG_Symbol = 55,
+	CME_GLOBEX_TAG_TimeInForce = 59,
+	CME_GLOBEX_TAG_TransactTime = 60,
+	CME_GLOBEX_TAG_PreTradeAnonymity = 1091,
+	CME_GLOBEX_TAG_NoAllocs = 78,
+	CME_GLOBEX_TAG_AllocAccount = 79,
+	CME_GLOBEX_TAG_StopPx = 99,
+	CME_GLOBEX_TAG_SecurityDesc = 107,
+	CME_GLOBEX_TAG_MinQty = 110,
+	CME_GLOBEX_TAG_SecurityType = 167,
+	CME_GLOBEX_TAG_CustomerOrFirm = 204,
+	CME_GLOBEX_TAG_MaxShow = 210,
+	CME_GLOBEX_TAG_ExpireDate = 432,
+	CME_GLOBEX_TAG_SelfMatchPreventionID = 7928,
+	CME_GLOBEX_TAG_SelfMatchPreventionInstruction = 8000,
+	CME_GLOBEX_TAG_CtiCode = 9702,
+	CME_GLOBEX_TAG_GiveUpFirm = 9707,
+	CME_GLOBEX_TAG_CmtaGiveupCD = 9708,
+	CME_GLOBEX_TAG_CorrelationClOrdID = 9717,
+	CME_GLOBEX_TAG_OrderID = 37,
+	CME_GLOBEX_TAG_OrigClOrdID = 41,
+	CME_GLOBEX_TAG_OFMOverride = 9768,
+	CME_GLOBEX_TAG_AvgPx = 6,
+	CME_GLOBEX_TAG_CumQty = 14,
+	CME_GLOBEX_TAG_ExecID = 17,
+	CME_GLOBEX_TAG_ExecTransType = 20,
+	CME_GLOBEX_TAG_LastPx = 31,
+	CME_GLOBEX_TAG_LastQty = 32,
+	CME_GLOBEX_TAG_OrdStatus = 39,
+	CME_GLOBEX_TAG_SecurityID = 48,
+	CME_GLOBEX_TAG_ExecType = 150,
+	CME_GLOBEX_TAG_LeavesQty = 151,
+	CME_GLOBEX_TAG_ExecRestatementReason = 378,
+	CME_GLOBEX_TAG_CrossID = 548,
+	CME_GLOBEX_TAG_CrossType = 549,
+	CME_GLOBEX_TAG_HostCrossID = 961,
+	CME_GLOBEX_TAG_MassStatusReqID = 584,
+	CME_GLOBEX_TAG_TradeDate = 75,
+	CME_GLOBEX_TAG_LastRptRequested = 912,
+	CME_GLOBEX_TAG_ContraTrader = 337,
+	CME_GLOBEX_TAG_ContraBroker = 375,
+	CME_GLOBEX_TAG_TotalNumSecurities = 393,
+	CME_GLOBEX_TAG_MultiLegReportingType = 442,
+	CME_GLOBEX_TAG_SecondaryExecID = 527,
+	CME_GLOBEX_TAG_UnderlyingPx = 810,
+	CME_GLOBEX_TAG_OptionDelta = 811,
+	CME_GLOBEX_TAG_AggressorIndicator = 1057,
+	CME_GLOBEX_TAG_Volatility = 1188,
+	CME_GLOBEX_TAG_ExpirationTimeValue = 1189,
+	CME_GLOBEX_TAG_RiskFreeRate = 1190,
+	CME_GLOBEX_TAG_OrdRejReason = 103,
+	CME_GLOBEX_TAG_CxlRejReason = 102,
+	CME_GLOBEX_TAG_CxlRejResponseTo = 434,
+	CME_GLOBEX_TAG_MassStatusReqType = 585,
+	CME_GLOBEX_TAG_OrdStatusReqType = 5000,
+	CME_GLOBEX_TAG_MassActionType = 1373,
+	CME_GLOBEX_TAG_MassActionScope = 1374,
+	CME_GLOBEX_TAG_MarketSegmentID = 1300,
+	CME_GLOBEX_TAG_MassCancelRequestType = 6115,
+	CME_GLOBEX_TAG_MassActionReportID = 1369,
+	CME_GLOBEX_TAG_MassActionResponse = 1375,
+	CME_GLOBEX_TAG_TotalAffectedOrders = 533,
+	CME_GLOBEX_TAG_NoAffectedOrders = 534,
+	CME_GLOBEX_TAG_CxlQty = 84,
+	CME_GLOBEX_TAG_AffectedOrderID = 535,
+	CME_GLOBEX_TAG_LastFragment = 893,
+};
+
+/* Logon (MsgType A), see cme_globex_logon_parse() */
+struct cme_globex_logon {
+	uint64_t		present;	/* CME_GLOBEX_LOGON_* bits */
+	int64_t			raw_data_length;
+	const char		*raw_data;
+	unsigned int		raw_data_len;
+	int64_t			encrypt_method;
+	int64_t			heart_bt_int;
+	char			reset_seq_num_flag;
+	const char		*application_system_name;
+	unsigned int		application_system_name_len;
+	const char		*trading_system_version;
+	unsigned int		trading_system_version_len;
+	const char		*application_system_vendor;
+	unsigned int		application_system_vendor_len;
+};
+
+#define CME_GLOBEX_LOGON_RAW_DATA_LENGTH	(1ULL << 0)
+#define CME_GLOBEX_LOGON_RAW_DATA	(1ULL << 1)
+#define CME_GLOBEX_LOGON_ENCRYPT_METHOD	(1ULL << 2)
+#define CME_GLOBEX_LOGON_HEART_BT_INT	(1ULL << 3)
+#define CME_GLOBEX_LOGON_RESET_SEQ_NUM_FLAG	(1ULL << 4)
+#define CME_GLOBEX_LOGON_APPLICATION_SYSTEM_NAME	(1ULL << 5)
+#define CME_GLOBEX_LOGON_TRADING_SYSTEM_VERSION	(1ULL << 6)
+#define CME_GLOBEX_LOGON_APPLICATION_SYSTEM_VENDOR	(1ULL << 7)
+
+int cme_globex_logon_parse(struct cme_globex_logon *self, struct fix_message *msg);
+
+/* HeartBeat (MsgType 0), see cme_globex_heart_beat_parse() */
+struct cme_globex_heart_beat {
+	uint64_t		present;	/* CME_GLOBEX_HEART_BEAT_* bits */
+	const char		*test_req_id;
+	unsigned int		test_req_id_len;
+};
+
+#define CME_GLOBEX_HEART_BEAT_TEST_REQ_ID	(1ULL << 0)
+
+int cme_globex_heart_beat_parse(struct cme_globex_heart_beat *self, struct fix_message *msg);
+
+/* TestRequest (MsgType 1), see cme_globex_test_request_parse() */
+struct cme_globex_test_request {
+	uint64_t		present;	/* CME_GLOBEX_TEST_REQUEST_* bits */
+	const char		*test_req_id;
+	unsigned int		test_req_id_len;
+};
+
+#define CME_GLOBEX_TEST_REQUEST_TEST_REQ_ID	(1ULL << 0)
+
+int cme_globex_test_request_parse(struct cme_globex_test_request *self, struct fix_message *msg);
+
+/* ResendRequest (MsgType 2), see cme_globex_resend_request_parse() */
+struct cme_globex_resend_request {
+	uint64_t		present;	/* CME_GLOBEX_RESEND_REQUEST_* bits */
+	int64_t			begin_seq_no;
+	int64_t			end_seq_no;
+};
+
+#define CME_GLOBEX_RESEND_REQUEST_BEGIN_SEQ_NO	(1ULL << 0)
+#define CME_GLOBEX_RESEND_REQUEST_END_SEQ_NO	(1ULL << 1)
+
+int cme_globex_resend_request_parse(struct cme_globex_resend_request *self, struct fix_message *msg);
+
+/* SessionLevelReject (MsgType 3), see cme_globex_session_level_reject_parse() */
+struct cme_globex_session_level_reject {
+	uint64_t		present;	/* CME_GLOBEX_SESSION_LEVEL_REJECT_* bits */
+	int64_t			ref_seq_num;
+	const char		*text;
+	unsigned int		text_len;
+	const char		*ref_tag_id;
+	unsigned int		ref_tag_id_len;
+	const char		*ref_msg_type;
+	unsigned int		ref_msg_type_len;
+	int64_t			session_reject_reason;
+	char			manual_order_indicator;
+	char			cust_order_handling_inst;
+};
+
+#define CME_GLOBEX_SESSION_LEVEL_REJECT_REF_SEQ_NUM	(1ULL << 0)
+#define CME_GLOBEX_SESSION_LEVEL_REJECT_TEXT	(1ULL << 1)
+#define CME_GLOBEX_SESSION_LEVEL_REJECT_REF_TAG_ID	(1ULL << 2)
+#define CME_GLOBEX_SESSION_LEVEL_REJECT_REF_MSG_TYPE	(1ULL << 3)
+#define CME_GLOBEX_SESSION_LEVEL_REJECT_SESSION_REJECT_REASON	(1ULL << 4)
+#define CME_GLOBEX_SESSION_LEVEL_REJECT_MANUAL_ORDER_INDICATOR	(1ULL << 5)
+#define CME_GLOBEX_SESSION_LEVEL_REJECT_CUST_ORDER_HANDLING_INST	(1ULL << 6)
+
+int cme_globex_session_level_reject_parse(struct cme_globex_session_level_reject *self, struct fix_message *msg);
+
+/* BusinessLevelReject (MsgType j), see cme_globex_business_level_reject_parse() */
+struct cme_globex_business_level_reject {
+	uint64_t		present;	/* CME_GLOBEX_BUSINESS_LEVEL_REJECT_* bits */
+	int64_t			ref_seq_num;
+	const char		*ref_msg_type;
+	unsigned int		ref_msg_type_len;
+	const char		*business_reject_ref_id;
+	unsigned int		business_reject_ref_id_len;
+	int64_t			business_reject_reason;
+	const char		*text;
+	unsigned int		text_len;
+	char			manual_order_indicator;
+	char			cust_order_handling_inst;
+};
+
+#define CME_GLOBEX_BUSINESS_LEVEL_REJECT_REF_SEQ_NUM	(1ULL << 0)
+#define CME_GLOBEX_BUSINESS_LEVEL_REJECT_REF_MSG_TYPE	(1ULL << 1)
+#define CME_GLOBEX_BUSINESS_LEVEL_REJECT_BUSINESS_REJECT_REF_ID	(1ULL << 2)
+#define CME_GLOBEX_BUSINESS_LEVEL_REJECT_BUSINESS_REJECT_REASON	(1ULL << 3)
+#define CME_GLOBEX_BUSINESS_LEVEL_REJECT_TEXT	(1ULL << 4)
+#define CME_GLOBEX_BUSINESS_LEVEL_REJECT_MANUAL_ORDER_INDICATOR	(1ULL << 5)
+#define CME_GLOBEX_BUSINESS_LEVEL_REJECT_CUST_ORDER_HANDLING_INST	(1ULL << 6)
+
+int cme_globex_business_level_reject_parse(struct cme_globex_business_level_reject *self, struct fix_message *msg);
+
+/* SequenceReset (MsgType 4), see cme_globex_sequence_reset_parse() */
+struct cme_globex_sequence_reset {
+	uint64_t		present;	/* CME_GLOBEX_SEQUENCE_RESET_* bits */
+	int64_t			new_seq_no;
+	char			gap_fill_flag;
+};
+
+#define CME_GLOBEX_SEQUENCE_RESET_NEW_SEQ_NO	(1ULL << 0)
+#define CME_GLOBEX_SEQUENCE_RESET_GAP_FILL_FLAG	(1ULL << 1)
+
+int cme_globex_sequence_reset_parse(struct cme_globex_sequence_reset *self, struct fix_message *msg);
+
+/* Logout (MsgType 5), see cme_globex_logout_parse() */
+struct cme_globex_logout {
+	uint64_t		present;	/* CME_GLOBEX_LOGOUT_* bits */
+	const char		*text;
+	unsigned int		text_len;
+	int64_t			next_expected_msg_seq_num;
+};
+
+#define CME_GLOBEX_LOGOUT_TEXT	(1ULL << 0)
+#define CME_GLOBEX_LOGOUT_NEXT_EXPECTED_MSG_SEQ_NUM	(1ULL << 1)
+
+int cme_globex_logout_parse(struct cme_globex_logout *self, struct fix_message *msg);
+
+/* NewOrderSingle (MsgType D), see cme_globex_new_order_single_parse() */
+struct cme_globex_new_order_single {
+	uint64_t		present;	/* CME_GLOBEX_NEW_ORDER_SINGLE_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	char			handl_inst;
+	char			cust_order_handling_inst;
+	int64_t			order_qty;
+	char			ord_type;
+	double			price;
+	char			side;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	char			time_in_force;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	char			manual_order_indicator;
+	char			pre_trade_anonymity;
+	char			no_allocs;
+	const char		*alloc_account;
+	unsigned int		alloc_account_len;
+	double			stop_px;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	int64_t			min_qty;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	int64_t			customer_or_firm;
+	int64_t			max_show;
+	const char		*expire_date;
+	unsigned int		expire_date_len;
+	const char		*self_match_prevention_id;
+	unsigned int		self_match_prevention_id_len;
+	char			self_match_prevention_instruction;
+	char			cti_code;
+	const char		*give_up_firm;
+	unsigned int		give_up_firm_len;
+	const char		*cmta_giveup_cd;
+	unsigned int		cmta_giveup_cd_len;
+	const char		*correlation_cl_ord_id;
+	unsigned int		correlation_cl_ord_id_len;
+};
+
+#define CME_GLOBEX_NEW_ORDER_SINGLE_ACCOUNT	(1ULL << 0)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_CL_ORD_ID	(1ULL << 1)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_HANDL_INST	(1ULL << 2)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_CUST_ORDER_HANDLING_INST	(1ULL << 3)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_ORDER_QTY	(1ULL << 4)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_ORD_TYPE	(1ULL << 5)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_PRICE	(1ULL << 6)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_SIDE	(1ULL << 7)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_SYMBOL	(1ULL << 8)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_TIME_IN_FORCE	(1ULL << 9)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_TRANSACT_TIME	(1ULL << 10)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_MANUAL_ORDER_INDICATOR	(1ULL << 11)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_PRE_TRADE_ANONYMITY	(1ULL << 12)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_NO_ALLOCS	(1ULL << 13)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_ALLOC_ACCOUNT	(1ULL << 14)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_STOP_PX	(1ULL << 15)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_SECURITY_DESC	(1ULL << 16)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_MIN_QTY	(1ULL << 17)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_SECURITY_TYPE	(1ULL << 18)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_CUSTOMER_OR_FIRM	(1ULL << 19)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_MAX_SHOW	(1ULL << 20)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_EXPIRE_DATE	(1ULL << 21)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_SELF_MATCH_PREVENTION_ID	(1ULL << 22)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_SELF_MATCH_PREVENTION_INSTRUCTION	(1ULL << 23)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_CTI_CODE	(1ULL << 24)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_GIVE_UP_FIRM	(1ULL << 25)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_CMTA_GIVEUP_CD	(1ULL << 26)
+#define CME_GLOBEX_NEW_ORDER_SINGLE_CORRELATION_CL_ORD_ID	(1ULL << 27)
+
+int cme_globex_new_order_single_parse(struct cme_globex_new_order_single *self, struct fix_message *msg);
+
+/* ExecutionReport (MsgType 8), see cme_globex_execution_report_parse() */
+struct cme_globex_execution_report {
+	uint64_t		present;	/* CME_GLOBEX_EXECUTION_REPORT_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	char			avg_px;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	int64_t			cum_qty;
+	const char		*exec_id;
+	unsigned int		exec_id_len;
+	char			exec_trans_type;
+	int64_t			order_id;
+	int64_t			order_qty;
+	char			ord_status;
+	char			ord_type;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	double			price;
+	int64_t			security_id;
+	char			side;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	char			time_in_force;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	char			no_allocs;
+	const char		*alloc_account;
+	unsigned int		alloc_account_len;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	double			stop_px;
+	int64_t			min_qty;
+	char			exec_type;
+	int64_t			leaves_qty;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	int64_t			exec_restatement_reason;
+	int64_t			max_show;
+	const char		*expire_date;
+	unsigned int		expire_date_len;
+	char			manual_order_indicator;
+	char			cust_order_handling_inst;
+	char			pre_trade_anonymity;
+	const char		*self_match_prevention_id;
+	unsigned int		self_match_prevention_id_len;
+	char			self_match_prevention_instruction;
+	const char		*correlation_cl_ord_id;
+	unsigned int		correlation_cl_ord_id_len;
+	const char		*cross_id;
+	unsigned int		cross_id_len;
+	char			cross_type;
+	const char		*host_cross_id;
+	unsigned int		host_cross_id_len;
+	const char		*mass_status_req_id;
+	unsigned int		mass_status_req_id_len;
+	const char		*ref_msg_type;
+	unsigned int		ref_msg_type_len;
+	int64_t			business_reject_reason;
+	const char		*trade_date;
+	unsigned int		trade_date_len;
+	char			last_rpt_requested;
+	const char		*text;
+	unsigned int		text_len;
+	double			last_px;
+	int64_t			last_qty;
+	const char		*contra_trader;
+	unsigned int		contra_trader_len;
+	const char		*contra_broker;
+	unsigned int		contra_broker_len;
+	int64_t			total_num_securities;
+	char			multi_leg_reporting_type;
+	const char		*secondary_exec_id;
+	unsigned int		secondary_exec_id_len;
+	double			underlying_px;
+	double			option_delta;
+	char			aggressor_indicator;
+	const char		*volatility;
+	unsigned int		volatility_len;
+	double			expiration_time_value;
+	double			risk_free_rate;
+	int64_t			ord_rej_reason;
+};
+
+#define CME_GLOBEX_EXECUTION_REPORT_ACCOUNT	(1ULL << 0)
+#define CME_GLOBEX_EXECUTION_REPORT_AVG_PX	(1ULL << 1)
+#define CME_GLOBEX_EXECUTION_REPORT_CL_ORD_ID	(1ULL << 2)
+#define CME_GLOBEX_EXECUTION_REPORT_CUM_QTY	(1ULL << 3)
+#define CME_GLOBEX_EXECUTION_REPORT_EXEC_ID	(1ULL << 4)
+#define CME_GLOBEX_EXECUTION_REPORT_EXEC_TRANS_TYPE	(1ULL << 5)
+#define CME_GLOBEX_EXECUTION_REPORT_ORDER_ID	(1ULL << 6)
+#define CME_GLOBEX_EXECUTION_REPORT_ORDER_QTY	(1ULL << 7)
+#define CME_GLOBEX_EXECUTION_REPORT_ORD_STATUS	(1ULL << 8)
+#define CME_GLOBEX_EXECUTION_REPORT_ORD_TYPE	(1ULL << 9)
+#define CME_GLOBEX_EXECUTION_REPORT_ORIG_CL_ORD_ID	(1ULL << 10)
+#define CME_GLOBEX_EXECUTION_REPORT_PRICE	(1ULL << 11)
+#define CME_GLOBEX_EXECUTION_REPORT_SECURITY_ID	(1ULL << 12)
+#define CME_GLOBEX_EXECUTION_REPORT_SIDE	(1ULL << 13)
+#define CME_GLOBEX_EXECUTION_REPORT_SYMBOL	(1ULL << 14)
+#define CME_GLOBEX_EXECUTION_REPORT_TIME_IN_FORCE	(1ULL << 15)
+#define CME_GLOBEX_EXECUTION_REPORT_TRANSACT_TIME	(1ULL << 16)
+#define CME_GLOBEX_EXECUTION_REPORT_NO_ALLOCS	(1ULL << 17)
+#define CME_GLOBEX_EXECUTION_REPORT_ALLOC_ACCOUNT	(1ULL << 18)
+#define CME_GLOBEX_EXECUTION_REPORT_SECURITY_DESC	(1ULL << 19)
+#define CME_GLOBEX_EXECUTION_REPORT_STOP_PX	(1ULL << 20)
+#define CME_GLOBEX_EXECUTION_REPORT_MIN_QTY	(1ULL << 21)
+#define CME_GLOBEX_EXECUTION_REPORT_EXEC_TYPE	(1ULL << 22)
+#define CME_GLOBEX_EXECUTION_REPORT_LEAVES_QTY	(1ULL << 23)
+#define CME_GLOBEX_EXECUTION_REPORT_SECURITY_TYPE	(1ULL << 24)
+#define CME_GLOBEX_EXECUTION_REPORT_EXEC_RESTATEMENT_REASON	(1ULL << 25)
+#define CME_GLOBEX_EXECUTION_REPORT_MAX_SHOW	(1ULL << 26)
+#define CME_GLOBEX_EXECUTION_REPORT_EXPIRE_DATE	(1ULL << 27)
+#define CME_GLOBEX_EXECUTION_REPORT_MANUAL_ORDER_INDICATOR	(1ULL << 28)
+#define CME_GLOBEX_EXECUTION_REPORT_CUST_ORDER_HANDLING_INST	(1ULL << 29)
+#define CME_GLOBEX_EXECUTION_REPORT_PRE_TRADE_ANONYMITY	(1ULL << 30)
+#define CME_GLOBEX_EXECUTION_REPORT_SELF_MATCH_PREVENTION_ID	(1ULL << 31)
+#define CME_GLOBEX_EXECUTION_REPORT_SELF_MATCH_PREVENTION_INSTRUCTION	(1ULL << 32)
+#define CME_GLOBEX_EXECUTION_REPORT_CORRELATION_CL_ORD_ID	(1ULL << 33)
+#define CME_GLOBEX_EXECUTION_REPORT_CROSS_ID	(1ULL << 34)
+#define CME_GLOBEX_EXECUTION_REPORT_CROSS_TYPE	(1ULL << 35)
+#define CME_GLOBEX_EXECUTION_REPORT_HOST_CROSS_ID	(1ULL << 36)
+#define CME_GLOBEX_EXECUTION_REPORT_MASS_STATUS_REQ_ID	(1ULL << 37)
+#define CME_GLOBEX_EXECUTION_REPORT_REF_MSG_TYPE	(1ULL << 38)
+#define CME_GLOBEX_EXECUTION_REPORT_BUSINESS_REJECT_REASON	(1ULL << 39)
+#define CME_GLOBEX_EXECUTION_REPORT_TRADE_DATE	(1ULL << 40)
+#define CME_GLOBEX_EXECUTION_REPORT_LAST_RPT_REQUESTED	(1ULL << 41)
+#define CME_GLOBEX_EXECUTION_REPORT_TEXT	(1ULL << 42)
+#define CME_GLOBEX_EXECUTION_REPORT_LAST_PX	(1ULL << 43)
+#define CME_GLOBEX_EXECUTION_REPORT_LAST_QTY	(1ULL << 44)
+#define CME_GLOBEX_EXECUTION_REPORT_CONTRA_TRADER	(1ULL << 45)
+#define CME_GLOBEX_EXECUTION_REPORT_CONTRA_BROKER	(1ULL << 46)
+#define CME_GLOBEX_EXECUTION_REPORT_TOTAL_NUM_SECURITIES	(1ULL << 47)
+#define CME_GLOBEX_EXECUTION_REPORT_MULTI_LEG_REPORTING_TYPE	(1ULL << 48)
+#define CME_GLOBEX_EXECUTION_REPORT_SECONDARY_EXEC_ID	(1ULL << 49)
+#define CME_GLOBEX_EXECUTION_REPORT_UNDERLYING_PX	(1ULL << 50)
+#define CME_GLOBEX_EXECUTION_REPORT_OPTION_DELTA	(1ULL << 51)
+#define CME_GLOBEX_EXECUTION_REPORT_AGGRESSOR_INDICATOR	(1ULL << 52)
+#define CME_GLOBEX_EXECUTION_REPORT_VOLATILITY	(1ULL << 53)
+#define CME_GLOBEX_EXECUTION_REPORT_EXPIRATION_TIME_VALUE	(1ULL << 54)
+#define CME_GLOBEX_EXECUTION_REPORT_RISK_FREE_RATE	(1ULL << 55)
+#define CME_GLOBEX_EXECUTION_REPORT_ORD_REJ_REASON	(1ULL << 56)
+
+int cme_globex_execution_report_parse(struct cme_globex_execution_report *self, struct fix_message *msg);
+
+/* OrderCancelRequest (MsgType F), see cme_globex_order_cancel_request_parse() */
+struct cme_globex_order_cancel_request {
+	uint64_t		present;	/* CME_GLOBEX_ORDER_CANCEL_REQUEST_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	int64_t			order_id;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	char			side;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	char			manual_order_indicator;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	const char		*correlation_cl_ord_id;
+	unsigned int		correlation_cl_ord_id_len;
+};
+
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_ACCOUNT	(1ULL << 0)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_CL_ORD_ID	(1ULL << 1)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_ORDER_ID	(1ULL << 2)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID	(1ULL << 3)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_SIDE	(1ULL << 4)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_SYMBOL	(1ULL << 5)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_TRANSACT_TIME	(1ULL << 6)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_MANUAL_ORDER_INDICATOR	(1ULL << 7)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_SECURITY_DESC	(1ULL << 8)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_SECURITY_TYPE	(1ULL << 9)
+#define CME_GLOBEX_ORDER_CANCEL_REQUEST_CORRELATION_CL_ORD_ID	(1ULL << 10)
+
+int cme_globex_order_cancel_request_parse(struct cme_globex_order_cancel_request *self, struct fix_message *msg);
+
+/* OrderCancelReplaceRequest (MsgType G), see cme_globex_order_cancel_replace_request_parse() */
+struct cme_globex_order_cancel_replace_request {
+	uint64_t		present;	/* CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	int64_t			order_id;
+	char			handl_inst;
+	int64_t			order_qty;
+	char			cust_order_handling_inst;
+	char			ord_type;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	double			price;
+	char			side;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*text;
+	unsigned int		text_len;
+	char			time_in_force;
+	char			manual_order_indicator;
+	char			pre_trade_anonymity;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	char			no_allocs;
+	const char		*alloc_account;
+	unsigned int		alloc_account_len;
+	double			stop_px;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	int64_t			min_qty;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	int64_t			customer_or_firm;
+	int64_t			max_show;
+	const char		*expire_date;
+	unsigned int		expire_date_len;
+	const char		*self_match_prevention_id;
+	unsigned int		self_match_prevention_id_len;
+	char			self_match_prevention_instruction;
+	char			cti_code;
+	const char		*give_up_firm;
+	unsigned int		give_up_firm_len;
+	const char		*cmta_giveup_cd;
+	unsigned int		cmta_giveup_cd_len;
+	const char		*correlation_cl_ord_id;
+	unsigned int		correlation_cl_ord_id_len;
+	char			ofm_override;
+};
+
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT	(1ULL << 0)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID	(1ULL << 1)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_ID	(1ULL << 2)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST	(1ULL << 3)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY	(1ULL << 4)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CUST_ORDER_HANDLING_INST	(1ULL << 5)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE	(1ULL << 6)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID	(1ULL << 7)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_PRICE	(1ULL << 8)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SIDE	(1ULL << 9)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL	(1ULL << 10)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TEXT	(1ULL << 11)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TIME_IN_FORCE	(1ULL << 12)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MANUAL_ORDER_INDICATOR	(1ULL << 13)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_PRE_TRADE_ANONYMITY	(1ULL << 14)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME	(1ULL << 15)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_NO_ALLOCS	(1ULL << 16)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ALLOC_ACCOUNT	(1ULL << 17)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_STOP_PX	(1ULL << 18)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_DESC	(1ULL << 19)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MIN_QTY	(1ULL << 20)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_TYPE	(1ULL << 21)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CUSTOMER_OR_FIRM	(1ULL << 22)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW	(1ULL << 23)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_EXPIRE_DATE	(1ULL << 24)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SELF_MATCH_PREVENTION_ID	(1ULL << 25)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SELF_MATCH_PREVENTION_INSTRUCTION	(1ULL << 26)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CTI_CODE	(1ULL << 27)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_GIVE_UP_FIRM	(1ULL << 28)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CMTA_GIVEUP_CD	(1ULL << 29)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CORRELATION_CL_ORD_ID	(1ULL << 30)
+#define CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_OFM_OVERRIDE	(1ULL << 31)
+
+int cme_globex_order_cancel_replace_request_parse(struct cme_globex_order_cancel_replace_request *self, struct fix_message *msg);
+
+/* OrderCancelReject (MsgType 9), see cme_globex_order_cancel_reject_parse() */
+struct cme_globex_order_cancel_reject {
+	uint64_t		present;	/* CME_GLOBEX_ORDER_CANCEL_REJECT_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*exec_id;
+	unsigned int		exec_id_len;
+	int64_t			order_id;
+	char			ord_status;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	int64_t			security_id;
+	const char		*text;
+	unsigned int		text_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	int64_t			cxl_rej_reason;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	char			cxl_rej_response_to;
+	char			manual_order_indicator;
+	char			pre_trade_anonymity;
+	const char		*self_match_prevention_id;
+	unsigned int		self_match_prevention_id_len;
+	const char		*correlation_cl_ord_id;
+	unsigned int		correlation_cl_ord_id_len;
+};
+
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_ACCOUNT	(1ULL << 0)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_CL_ORD_ID	(1ULL << 1)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_EXEC_ID	(1ULL << 2)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_ORDER_ID	(1ULL << 3)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_ORD_STATUS	(1ULL << 4)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID	(1ULL << 5)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_SECURITY_ID	(1ULL << 6)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_TEXT	(1ULL << 7)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_TRANSACT_TIME	(1ULL << 8)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_CXL_REJ_REASON	(1ULL << 9)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_SECURITY_DESC	(1ULL << 10)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_CXL_REJ_RESPONSE_TO	(1ULL << 11)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_MANUAL_ORDER_INDICATOR	(1ULL << 12)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_PRE_TRADE_ANONYMITY	(1ULL << 13)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_SELF_MATCH_PREVENTION_ID	(1ULL << 14)
+#define CME_GLOBEX_ORDER_CANCEL_REJECT_CORRELATION_CL_ORD_ID	(1ULL << 15)
+
+int cme_globex_order_cancel_reject_parse(struct cme_globex_order_cancel_reject *self, struct fix_message *msg);
+
+/* OrderStatusRequest (MsgType H), see cme_globex_order_status_request_parse() */
+struct cme_globex_order_status_request {
+	uint64_t		present;	/* CME_GLOBEX_ORDER_STATUS_REQUEST_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	int64_t			order_id;
+	char			side;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	char			manual_order_indicator;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	const char		*correlation_cl_ord_id;
+	unsigned int		correlation_cl_ord_id_len;
+};
+
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_CL_ORD_ID	(1ULL << 0)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_ORDER_ID	(1ULL << 1)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_SIDE	(1ULL << 2)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_SYMBOL	(1ULL << 3)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_MANUAL_ORDER_INDICATOR	(1ULL << 4)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_TRANSACT_TIME	(1ULL << 5)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_SECURITY_DESC	(1ULL << 6)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_SECURITY_TYPE	(1ULL << 7)
+#define CME_GLOBEX_ORDER_STATUS_REQUEST_CORRELATION_CL_ORD_ID	(1ULL << 8)
+
+int cme_globex_order_status_request_parse(struct cme_globex_order_status_request *self, struct fix_message *msg);
+
+/* OrderMassStatusRequest (MsgType AF), see cme_globex_order_mass_status_request_parse() */
+struct cme_globex_order_mass_status_request {
+	uint64_t		present;	/* CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_* bits */
+	const char		*mass_status_req_id;
+	unsigned int		mass_status_req_id_len;
+	int64_t			mass_status_req_type;
+	int64_t			ord_status_req_type;
+	const char		*account;
+	unsigned int		account_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	char			time_in_force;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	char			manual_order_indicator;
+};
+
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MASS_STATUS_REQ_ID	(1ULL << 0)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MASS_STATUS_REQ_TYPE	(1ULL << 1)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_ORD_STATUS_REQ_TYPE	(1ULL << 2)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_ACCOUNT	(1ULL << 3)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_SYMBOL	(1ULL << 4)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_SECURITY_DESC	(1ULL << 5)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_TIME_IN_FORCE	(1ULL << 6)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_TRANSACT_TIME	(1ULL << 7)
+#define CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MANUAL_ORDER_INDICATOR	(1ULL << 8)
+
+int cme_globex_order_mass_status_request_parse(struct cme_globex_order_mass_status_request *self, struct fix_message *msg);
+
+/* OrderMassActionRequest (MsgType CA), see cme_globex_order_mass_action_request_parse() */
+struct cme_globex_order_mass_action_request {
+	uint64_t		present;	/* CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	int64_t			mass_action_type;
+	int64_t			mass_action_scope;
+	const char		*market_segment_id;
+	unsigned int		market_segment_id_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*security_desc;
+	unsigned int		security_desc_len;
+	int64_t			mass_cancel_request_type;
+	const char		*account;
+	unsigned int		account_len;
+	char			side;
+	char			ord_type;
+	char			time_in_force;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	char			manual_order_indicator;
+};
+
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_CL_ORD_ID	(1ULL << 0)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_ACTION_TYPE	(1ULL << 1)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_ACTION_SCOPE	(1ULL << 2)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MARKET_SEGMENT_ID	(1ULL << 3)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SYMBOL	(1ULL << 4)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SECURITY_DESC	(1ULL << 5)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_CANCEL_REQUEST_TYPE	(1ULL << 6)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_ACCOUNT	(1ULL << 7)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SIDE	(1ULL << 8)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_ORD_TYPE	(1ULL << 9)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_TIME_IN_FORCE	(1ULL << 10)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_TRANSACT_TIME	(1ULL << 11)
+#define CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MANUAL_ORDER_INDICATOR	(1ULL << 12)
+
+int cme_globex_order_mass_action_request_parse(struct cme_globex_order_mass_action_request *self, struct fix_message *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTRADING_CME_GLOBEX_FIX_H */
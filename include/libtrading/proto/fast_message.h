@@ -9,6 +9,7 @@ extern "C" {
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <time.h>
 #include <glib.h>
 
 #define	FAST_PMAP_MAX_BYTES		8
@@ -181,6 +182,9 @@ struct fast_message {
 
 	struct buffer		*pmap_buf;
 	struct buffer		*msg_buf;
+
+	/* Kernel receive time of the packet that completed the message */
+	struct timespec		rx_timestamp;
 };
 
 static inline void fast_msg_set_flags(struct fast_message *msg, int flags)
@@ -9,6 +9,7 @@ extern "C" {
 
 #include <libtrading/buffer.h>
 
+#include <sys/socket.h>
 #include <string.h>
 
 #define	FAST_RECV_BUFFER_SIZE	(2 * FAST_MESSAGE_MAX_SIZE)
@@ -17,9 +18,12 @@ extern "C" {
 struct fast_message;
 
 struct fast_session_cfg {
-	int		preamble_bytes;
-	int		sockfd;
-	bool		reset;
+	int			preamble_bytes;
+	int			sockfd;
+	bool			reset;
+	enum buffer_type	rx_buffer_type;
+	int			batch_size;	/* datagrams per recvmmsg(), 0 disables batching */
+	bool			rx_timestamps;	/* kernel RX timestamps via recvmsg() */
 };
 
 struct fast_session {
@@ -41,8 +45,35 @@ struct fast_session {
 
 	ssize_t			(*recv)(struct buffer*, int, size_t, int);
 	ssize_t			(*send)(int, const struct msghdr *, int);
+
+	/*
+	 * Batched datagram receive. In this mode rx_buffer is a view onto
+	 * the packet currently being decoded.
+	 */
+	int			batch_size;
+	int			nr_packets;
+	int			packet;
+	struct mmsghdr		*rx_mmsgs;
+	struct iovec		*rx_iovs;
+	char			*rx_packets;
+	char			*rx_controls;
+
+	bool			rx_timestamps;
+	struct timespec		rx_timestamp;	/* of the last packet read */
+
+	u64			nr_recv_calls;
+	u64			nr_recv_packets;
+	u64			nr_recv_messages;
 };
 
+static inline double fast_session_syscalls_per_message(struct fast_session *session)
+{
+	if (!session->nr_recv_messages)
+		return 0.0;
+
+	return (double) session->nr_recv_calls / session->nr_recv_messages;
+}
+
 static inline struct fast_message *fast_msg_by_name(struct fast_session *session, const char *name)
 {
 	struct fast_message *msg;
@@ -61,6 +92,7 @@ static inline struct fast_message *fast_msg_by_name(struct fast_session *session
 int fast_session_send(struct fast_session *self, struct fast_message *msg, int flags);
 struct fast_message *fast_session_recv(struct fast_session *self, int flags);
 int fast_parse_template(struct fast_session *self, const char *xml);
+void fast_session_cfg_init(struct fast_session_cfg *cfg);
 struct fast_session *fast_session_new(struct fast_session_cfg *cfg);
 void fast_session_free(struct fast_session *self);
 void fast_session_reset(struct fast_session *self);
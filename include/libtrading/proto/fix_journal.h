@@ -0,0 +1,61 @@
+#ifndef LIBTRADING_FIX_JOURNAL_H
+#define LIBTRADING_FIX_JOURNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/types.h"
+
+#include <sys/uio.h>
+#include <stddef.h>
+
+/*
+ * Append-only store of the serialized messages a session has sent, kept
+ * in a memory-mapped file so that it survives a restart. Messages are
+ * indexed by MsgSeqNum for replaying them on ResendRequest.
+ *
+ * File layout: struct fix_journal_header, 'max_msgs' index entries, then
+ * 'size' bytes of message data.
+ */
+#define FIX_JOURNAL_MAGIC	0x314c4e524a584946ULL	/* "FIXJRNL1" */
+
+struct fix_journal_header {
+	u64			magic;
+	u64			size;		/* of the message data */
+	u64			max_msgs;
+	u64			first_seq_num;	/* MsgSeqNum of index entry 0 */
+	u64			nr_msgs;	/* index entries in use */
+	u64			end;		/* message data in use */
+};
+
+struct fix_journal_entry {
+	u32			offset;		/* into the message data */
+	u32			len;		/* 0 if the message wasn't journaled */
+};
+
+struct fix_journal_cfg {
+	const char		*path;
+	size_t			size;		/* bytes of message data */
+	unsigned long		max_msgs;
+};
+
+struct fix_journal {
+	struct fix_journal_header	*header;
+	struct fix_journal_entry	*index;
+	char				*data;
+	size_t				map_size;
+};
+
+void fix_journal_cfg_init(struct fix_journal_cfg *cfg);
+struct fix_journal *fix_journal_new(const struct fix_journal_cfg *cfg);
+void fix_journal_free(struct fix_journal *self);
+void fix_journal_reset(struct fix_journal *self);
+int fix_journal_append(struct fix_journal *self, unsigned long msg_seq_num, const struct iovec *iov, int iovcnt);
+const char *fix_journal_get(struct fix_journal *self, unsigned long msg_seq_num, size_t *len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
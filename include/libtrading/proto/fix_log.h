@@ -0,0 +1,78 @@
+#ifndef LIBTRADING_FIX_LOG_H
+#define LIBTRADING_FIX_LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/types.h"
+
+#include <sys/uio.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Message log written off the session thread. fix_log_write() copies the
+ * raw message and a timestamp into a single-producer single-consumer ring;
+ * a writer thread appends the records to <path>.<n> files, one line per
+ * message, starting a new file every 'rotate_size' bytes.
+ */
+enum fix_log_dir {
+	FIX_LOG_IN,
+	FIX_LOG_OUT,
+};
+
+/* What fix_log_write() does when the ring has no room for a record */
+enum fix_log_full {
+	FIX_LOG_FULL_DROP,	/* drop the record and count it in nr_dropped */
+	FIX_LOG_FULL_BLOCK,	/* wait for the writer thread to make room */
+};
+
+struct fix_log_cfg {
+	const char		*path;
+	size_t			ring_size;	/* power of two */
+	size_t			rotate_size;	/* bytes per file, 0 for a single file */
+	enum fix_log_full	full;
+};
+
+#define FIX_LOG_BATCH		64	/* records per writev() */
+
+struct fix_log {
+	/* Producer side */
+	u64			head __attribute__((aligned(64)));
+	u64			tail_cache;	/* last tail seen by the producer */
+	u64			nr_dropped;
+
+	/* Consumer side */
+	u64			tail __attribute__((aligned(64)));
+	u64			nr_written;
+	u64			nr_errors;	/* failed writes */
+
+	char			*ring;
+	size_t			ring_size;
+	enum fix_log_full	full;
+
+	const char		*path;
+	size_t			rotate_size;
+	unsigned long		file_index;
+	size_t			file_size;
+	int			fd;
+
+	bool			stop;
+	pthread_t		thread;
+
+	char			prefix[FIX_LOG_BATCH][48];
+	struct iovec		iov[3 * FIX_LOG_BATCH];
+};
+
+void fix_log_cfg_init(struct fix_log_cfg *cfg);
+struct fix_log *fix_log_new(const struct fix_log_cfg *cfg);
+void fix_log_free(struct fix_log *self);
+int fix_log_write(struct fix_log *self, enum fix_log_dir dir, const struct iovec *iov, int iovcnt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -14,6 +14,8 @@ extern "C" {
 struct buffer;
 
 struct fix_dialect;
+struct arena;
+struct fix_tag_index;
 
 /*
  * Message types:
@@ -61,9 +63,15 @@ enum fix_msg_type {
 #define FIX_MAX_BODY_LEN	1024UL
 #define FIX_MAX_MESSAGE_SIZE	(FIX_MAX_HEAD_LEN + FIX_MAX_BODY_LEN)
 
-/* Total number of elements of fix_tag type*/
+/* Room in a fields array set by the caller, see fix_message_add_field() */
 #define FIX_MAX_FIELD_NUMBER	48
 
+/* Arena chunk of a message from fix_message_new() */
+#define FIX_ARENA_CHUNK_SIZE	(64UL * 1024)
+
+/* Repeating groups recorded per parsed message */
+#define FIX_MAX_GROUP_NUMBER	8
+
 #define	FIX_MSG_STATE_PARTIAL	1
 #define	FIX_MSG_STATE_GARBLED	2
 
@@ -77,6 +85,42 @@ enum fix_type {
 	FIX_TYPE_CHECKSUM,
 	FIX_TYPE_MSGSEQNUM,
 	FIX_TYPE_STRING_8,
+	FIX_TYPE_DECIMAL,
+	FIX_TYPE_GROUP,		/* NumInGroup field, stored as FIX_TYPE_INT */
+};
+
+/*
+ * Fixed-point decimal, worth mantissa * 10^exponent. "12.50" is parsed as
+ * { 1250, -2 } and formatted back the same way, without ever going through
+ * floating point.
+ */
+struct fix_decimal {
+	int64_t				mantissa;
+	int				exponent;
+};
+
+#define FIX_DECIMAL_MAX_DIGITS		18	/* significant digits kept by the parser */
+
+/* Fraction digits of a UTCTimestamp */
+enum fix_time_precision {
+	FIX_TIME_MILLI			= 3,
+	FIX_TIME_MICRO			= 6,
+	FIX_TIME_NANO			= 9,
+};
+
+/* "YYYYMMDD-HH:MM:SS." and the fraction */
+#define FIX_TIMESTAMP_LEN(precision)	(18 + (precision))
+
+/*
+ * UTCTimestamp formatter for SendingTime and the like. The text goes to
+ * 'str', which must be left alone between updates: the "YYYYMMDD-HH:MM:"
+ * prefix there is only rendered again when the minute changes, otherwise
+ * just the seconds and the fraction are written. 'str' is not terminated.
+ */
+struct fix_timestamp {
+	char				*str;
+	enum fix_time_precision		precision;
+	time_t				minute;		/* of the prefix in 'str', or -1 */
 };
 
 enum fix_tag {
@@ -118,15 +162,20 @@ enum fix_tag {
 	OrdRejReason		= 103,
 	HeartBtInt		= 108,
 	TestReqID		= 112,
+	OrigSendingTime		= 122,
 	GapFillFlag		= 123,
 	ResetSeqNumFlag		= 141,
 	ExecType		= 150,
 	LeavesQty		= 151,
+	NoMDEntries		= 268,
 	MDEntryType		= 269,
 	MDEntryPx		= 270,
 	MDEntrySize		= 271,
+	MDEntryTime		= 273,
+	MDEntryID		= 278,
 	MDUpdateAction		= 279,
 	TradingSessionID	= 336,
+	NumberOfOrders		= 346,
 	LastMsgSeqNumProcessed	= 369,
 	MultiLegReportingType	= 442,
 	Password		= 554,
@@ -143,7 +192,20 @@ struct fix_field {
 		char			char_value;
 		const char		*string_value;
 		char			string_8_value[8];
+		int64_t			decimal_mantissa;	/* see decimal_exponent */
 	};
+
+	/* Length of the value on the wire, for parsed fields */
+	unsigned int			value_len;
+
+	/*
+	 * Parsed with FIX_PARSE_FLAG_LAZY and not converted yet: the value is
+	 * still in string_value. fix_get_field() converts it.
+	 */
+	bool				lazy;
+
+	/* FIX_TYPE_DECIMAL: the value is decimal_mantissa * 10^decimal_exponent */
+	int8_t				decimal_exponent;
 };
 
 #define FIX_INT_FIELD(t, v)				\
@@ -181,12 +243,53 @@ struct fix_field {
 		{ .char_value	= v },			\
 	}
 
+#define FIX_DECIMAL_FIELD(t, m, e)			\
+	(struct fix_field) {				\
+		.tag		= t,			\
+		.type		= FIX_TYPE_DECIMAL,	\
+		{ .decimal_mantissa = m },		\
+		.decimal_exponent = e,			\
+	}
+
+#define FIX_LAZY_FIELD(t, ty, s)			\
+	(struct fix_field) {				\
+		.tag		= t,			\
+		.type		= ty,			\
+		{ .string_value	= s },			\
+		.lazy		= true,			\
+	}
+
 #define FIX_STRING_8_FIELD(t)				\
 	(struct fix_field) {				\
 		.tag		= t,			\
 		.type		= FIX_TYPE_STRING_8,	\
 	}
 
+/*
+ * Repeating group layout for the parser, returned by the dialect for tags
+ * of FIX_TYPE_GROUP. Each entry starts with the field that follows the
+ * NumInGroup field and runs until that tag repeats. The group ends at the
+ * first field that is not one of 'members'. Nested groups are not
+ * tracked: their fields just have to be listed as members of the outer
+ * group.
+ */
+struct fix_group_def {
+	int				tag;
+	const int			*members;	/* zero-terminated */
+};
+
+/*
+ * Repeating group of a parsed message. Entry 'i' is the run of fields
+ * starting at fields[entries[i]]; see fix_group_entry().
+ */
+struct fix_group {
+	int				tag;
+	unsigned long			count;		/* NumInGroup value */
+	unsigned long			nr_entries;	/* entries actually found */
+	const unsigned long		*entries;
+	unsigned long			end;		/* index past the last field */
+};
+
 struct fix_message {
 	enum fix_msg_type		type;
 
@@ -212,7 +315,29 @@ struct fix_message {
 	unsigned long			nr_fields;
 	struct fix_field		*fields;
 
+	/*
+	 * Storage for fields and group_entries of messages from
+	 * fix_message_new(). It is reset by every parse, so both arrays just
+	 * grow to fit the largest message seen. A fields array set by the
+	 * caller is used as it is, with room for FIX_MAX_FIELD_NUMBER, and
+	 * freed by fix_message_free().
+	 */
+	struct arena			*arena;
+	struct fix_field		*arena_fields;	/* fields array allocated from the arena */
+	unsigned long			max_fields;	/* room in arena_fields and group_entries */
+
+	/* Tag lookup table for parsed messages, NULL if not indexed */
+	struct fix_tag_index		*index;
+
+	/* Repeating groups found by the parser */
+	unsigned long			nr_groups;
+	struct fix_group		*groups;
+	unsigned long			*group_entries;
+
 	struct iovec			iov[2];
+
+	/* Kernel receive time of the data that completed the message */
+	struct timespec			rx_timestamp;
 };
 
 static inline size_t fix_message_size(struct fix_message *self)
@@ -222,17 +347,37 @@ static inline size_t fix_message_size(struct fix_message *self)
 
 enum fix_parse_flag {
 	FIX_PARSE_FLAG_NO_CSUM = 1UL << 0,
-	FIX_PARSE_FLAG_NO_TYPE = 1UL << 1
+	FIX_PARSE_FLAG_NO_TYPE = 1UL << 1,
+	FIX_PARSE_FLAG_ONE_PASS = 1UL << 2,	/* tokenize and checksum in a single sweep */
+	FIX_PARSE_FLAG_LAZY = 1UL << 3,		/* convert numeric values on first access */
 };
 
 int64_t fix_atoi64(const char *p, const char **end);
 int fix_uatoi(const char *p, const char **end);
 
+struct fix_decimal fix_decimal_parse(const char *p, const char **end);
+int fix_decimal_unparse(struct fix_decimal value, char *s);
+double fix_decimal_to_double(struct fix_decimal value);
+
+static inline struct fix_decimal fix_field_decimal(const struct fix_field *field)
+{
+	return (struct fix_decimal) { field->decimal_mantissa, field->decimal_exponent };
+}
+
+void fix_timestamp_init(struct fix_timestamp *self, char *str, enum fix_time_precision precision);
+int fix_timestamp_update(struct fix_timestamp *self, const struct timespec *realtime);
+
+static inline unsigned int fix_timestamp_len(const struct fix_timestamp *self)
+{
+	return FIX_TIMESTAMP_LEN(self->precision);
+}
+
 bool fix_field_unparse(struct fix_field *self, struct buffer *buffer);
 
 struct fix_message *fix_message_new(void);
 void fix_message_free(struct fix_message *self);
 
+void fix_message_reset(struct fix_message *self);
 void fix_message_add_field(struct fix_message *msg, struct fix_field *field);
 
 void fix_message_unparse(struct fix_message *self);
@@ -247,6 +392,30 @@ const char *fix_get_string(struct fix_field *field, char *buffer, unsigned long
 double fix_get_float(struct fix_message *self, int tag, double _default_);
 int64_t fix_get_int(struct fix_message *self, int tag, int64_t _default_);
 char fix_get_char(struct fix_message *self, int tag, char _default_);
+struct fix_decimal fix_get_decimal(struct fix_message *self, int tag, struct fix_decimal _default_);
+
+struct fix_group *fix_get_group(struct fix_message *self, int tag);
+struct fix_field *fix_group_get_field(struct fix_message *self, struct fix_group *group, unsigned long entry, int tag);
+
+/*
+ * Return the fields of group entry 'entry' in place, and their number in
+ * '*nr_fields'. Values parsed with FIX_PARSE_FLAG_LAZY are not converted;
+ * use fix_group_get_field() or fix_get_field_at() for those.
+ */
+static inline struct fix_field *fix_group_entry(struct fix_message *self, struct fix_group *group, unsigned long entry, unsigned long *nr_fields)
+{
+	unsigned long start, end;
+
+	if (entry >= group->nr_entries)
+		return NULL;
+
+	start	= group->entries[entry];
+	end	= entry + 1 < group->nr_entries ? group->entries[entry + 1] : group->end;
+
+	*nr_fields = end - start;
+
+	return &self->fields[start];
+}
 
 void fix_message_validate(struct fix_message *self);
 int fix_message_send(struct fix_message *self, int sockfd, int flags);
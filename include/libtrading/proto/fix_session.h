@@ -6,6 +6,8 @@ extern "C" {
 #endif
 
 #include "libtrading/proto/fix_message.h"
+#include "libtrading/proto/fix_journal.h"
+#include "libtrading/proto/fix_log.h"
 
 #include "libtrading/buffer.h"
 
@@ -14,6 +16,7 @@ extern "C" {
 #define RECV_BUFFER_SIZE	4096UL
 #define FIX_TX_HEAD_BUFFER_SIZE	FIX_MAX_HEAD_LEN
 #define FIX_TX_BODY_BUFFER_SIZE	FIX_MAX_BODY_LEN
+#define FIX_TX_RING_MAX_SIZE	512UL	/* two iovecs per message, within IOV_MAX */
 
 struct fix_message;
 
@@ -30,10 +33,39 @@ enum fix_version {
 struct fix_dialect {
 	enum fix_version	version;
 	enum fix_type		(*tag_type)(int tag);
+
+	/* Layout of the group started by a FIX_TYPE_GROUP tag, or NULL */
+	const struct fix_group_def *(*group_def)(int tag);
+
+	/*
+	 * Parser of the fields after MsgType with tag_type() inlined, see
+	 * lib/proto/fix_parse.h. NULL falls back to the generic parser.
+	 */
+	int			(*parse_body)(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags);
 };
 
 extern struct fix_dialect	fix_dialects[];
 
+/*
+ * Durability of the session state file, see fix_session_cfg.state_path.
+ * The counters are always updated with plain stores; the policy decides
+ * when they are also written back with msync().
+ */
+enum fix_state_sync {
+	FIX_STATE_SYNC_NONE,	/* page cache only: survives the process, not the host */
+	FIX_STATE_SYNC_SEND,	/* MsgSeqNum is on disk before a message goes out */
+	FIX_STATE_SYNC_ALWAYS,	/* after every message sent or received */
+};
+
+#define FIX_SESSION_STATE_MAGIC	0x3154535358494654ULL	/* "TFIXSST1" as stored on little-endian hosts */
+
+/* Layout of the session state file */
+struct fix_session_state {
+	u64			magic;
+	u64			in_msg_seq_num;
+	u64			out_msg_seq_num;
+};
+
 struct fix_session_cfg {
 	char			sender_comp_id[32];
 	char			target_comp_id[32];
@@ -43,7 +75,34 @@ struct fix_session_cfg {
 	int			sockfd;
 	unsigned long		in_msg_seq_num;
 	unsigned long		out_msg_seq_num;
-	
+	enum buffer_type	rx_buffer_type;
+
+	/* FIX_RECV_FLAG_SPIN budget; spin until either one runs out */
+	unsigned long		spin_usec;
+	unsigned long		spin_count;
+	int			busy_poll_usec;	/* SO_BUSY_POLL, 0 to leave unset */
+	bool			rx_timestamps;	/* kernel RX timestamps via recvmsg(), bypasses io_recv */
+
+	/* SendingTime */
+	enum fix_time_precision	time_precision;	/* 0 for milliseconds */
+	bool			update_time_on_send;	/* read the clock for every message sent */
+
+	/* Messages FIX_SEND_FLAG_CORK can queue, 0 to send each one right away */
+	unsigned long		tx_ring_size;
+
+	/* Outbound messages to replay on ResendRequest, or NULL. Not owned by the session. */
+	struct fix_journal	*journal;
+
+	/*
+	 * File that keeps the sequence numbers across restarts, or NULL. Its
+	 * counters take precedence over in_msg_seq_num and out_msg_seq_num.
+	 */
+	const char		*state_path;
+	enum fix_state_sync	state_sync;
+
+	/* Log of every message sent and received, or NULL. Not owned by the session. */
+	struct fix_log		*log;
+
 	void			*user_data;
 };
 
@@ -55,6 +114,12 @@ enum fix_failure_reason {
 	FIX_FAILURE_GARBLED	= 4
 };
 
+/* A message serialized and waiting for fix_session_flush() */
+struct fix_tx_slot {
+	struct buffer			*head_buf;
+	struct buffer			*body_buf;
+};
+
 struct fix_session {
 	struct fix_dialect		*dialect;
 	int				sockfd;
@@ -71,12 +136,30 @@ struct fix_session {
 	struct buffer			*tx_head_buffer;
 	struct buffer			*tx_body_buffer;
 
+	/* Outbound messages corked until the ring fills or is flushed */
+	struct fix_tx_slot		*tx_ring;
+	struct iovec			*tx_iov;
+	unsigned long			tx_ring_size;
+	unsigned long			nr_tx_queued;
+	unsigned long			tx_iov_pos;	/* first iovec not fully sent */
+
+	struct fix_journal		*journal;
+	unsigned long			nr_journal_errors;	/* messages the full journal couldn't take */
+
+	/* Mapped session state file, or NULL */
+	struct fix_session_state	*state;
+	enum fix_state_sync		state_sync;
+
+	struct fix_log			*log;
+
 	struct fix_message		*rx_message;
 
 	int				heartbtint;
 
 	struct timespec			now;
 	char				str_now[64];
+	struct fix_timestamp		timestamp;	/* formats into str_now */
+	bool				update_time_on_send;
 
 	struct timespec			rx_timestamp;
 	struct timespec			tx_timestamp;
@@ -87,6 +170,17 @@ struct fix_session {
 
 	enum fix_failure_reason		failure_reason;
 
+	unsigned long			spin_usec;
+	unsigned long			spin_count;
+
+	bool				rx_timestamps;
+	struct timespec			rx_kernel_timestamp;
+
+	/* FIX_RECV_FLAG_SPIN statistics */
+	unsigned long			nr_spin_polls;	/* non-blocking polls without a message */
+	unsigned long			nr_spin_hits;	/* messages received while spinning */
+	unsigned long			nr_sleeps;	/* fallbacks to a blocking wait */
+
 	void				*user_data;
 };
 
@@ -103,16 +197,24 @@ int fix_session_time_update_monotonic(struct fix_session *self, struct timespec
 int fix_session_time_update_realtime(struct fix_session *self, struct timespec *realtime);
 int fix_session_time_update(struct fix_session *self);
 int fix_session_send(struct fix_session *self, struct fix_message *msg, unsigned long flags);
+int fix_session_flush(struct fix_session *self);
+int fix_session_state_sync(struct fix_session *self);
+int fix_session_set_in_msg_seq_num(struct fix_session *self, unsigned long seq_num);
+int fix_session_consume(struct fix_session *self);
+int fix_session_resend(struct fix_session *self, unsigned long begin_seq_num, unsigned long end_seq_num);
 int fix_session_recv(struct fix_session *self, struct fix_message **msg, unsigned long flags);
+int fix_session_recv_batch(struct fix_session *self, struct fix_message **msgs, unsigned long nr, unsigned long flags);
 
 enum fix_send_flag {
 	FIX_SEND_FLAG_PRESERVE_MSG_NUM = 1UL << 0, // lower 16 bits
 	FIX_SEND_FLAG_PRESERVE_BUFFER  = 1UL << 1,
+	FIX_SEND_FLAG_CORK	       = 1UL << 2, // queue until the tx ring fills or fix_session_flush()
 };
 
 enum fix_recv_flag {
 	FIX_RECV_FLAG_MSG_DONTWAIT = 1UL << 16, // upper 16 bits
-	FIX_RECV_KEEP_IN_MSGSEQNUM = 1UL << 17
+	FIX_RECV_KEEP_IN_MSGSEQNUM = 1UL << 17,
+	FIX_RECV_FLAG_SPIN	   = 1UL << 18, // poll, then block until a message arrives
 };
 
 #ifdef __cplusplus
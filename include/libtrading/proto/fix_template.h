@@ -11,6 +11,22 @@ extern "C" {
 #define FIX_TEMPLATE_BODY_LEN_ZPAD 4UL
 #define FIX_TEMPLATE_MSG_SEQ_NUM_ZPAD 6UL
 #define FIX_MAX_TEMPLATE_BUFFER_SIZE 1024UL
+#define FIX_TEMPLATE_MAX_SLOTS 16UL
+#define FIX_TEMPLATE_QTY_WIDTH 12UL
+#define FIX_TEMPLATE_PRICE_WIDTH 16UL
+
+/*
+ * A field that keeps its place and width in the prepared buffer, so that
+ * fix_template_set_field() can overwrite its value without reformatting
+ * the rest of the message. Numbers are padded with leading zeros, strings
+ * must be exactly 'width' long.
+ */
+struct fix_template_slot {
+	int			tag;
+	enum fix_type		type;
+	unsigned long		width;
+	char			*marker;	// value in the template buffer, set by fix_template_prepare()
+};
 
 struct fix_template {
 	char			*marker_body_length;
@@ -22,7 +38,9 @@ struct fix_template {
 	char			*marker_const_end;
 
 	unsigned long		sender_comp_id_len;
-	uint8_t			const_csum;
+	uint8_t			sum;	// of the bytes up to marker_const_end, kept current as they are patched
+
+	struct fix_timestamp	sending_time;	// formats in place at marker_sending_time
 
 	struct buffer		buf;	 // first two fields
 	char			tx_data[FIX_MAX_TEMPLATE_BUFFER_SIZE];
@@ -31,6 +49,9 @@ struct fix_template {
 	struct fix_field	fields[FIX_MAX_FIELD_NUMBER]; // variable fields array
 	struct fix_field	csum_field;
 
+	unsigned long		nr_slots;
+	struct fix_template_slot slots[FIX_TEMPLATE_MAX_SLOTS];
+
 	struct iovec		iov[1];
 };
 
@@ -42,16 +63,24 @@ struct fix_template_cfg {
 	const char		*target_comp_id; // TargetCompID - constant value, unchanged on each unparse cycle
 
 	bool			manage_transact_time; // true to print / manage transact time
+	enum fix_time_precision	time_precision; // fraction digits of SendingTime and TransactTime, 0 for milliseconds
 
 	unsigned long		nr_const_fields; // number of constant fields to be serialized during initialization only
 	struct fix_field	const_fields[FIX_MAX_FIELD_NUMBER];	 // constant fields array
+
+	unsigned long		nr_slots;	 // number of fixed width fields, serialized after the constant ones
+	struct fix_template_slot slots[FIX_TEMPLATE_MAX_SLOTS];
 };
 
 struct fix_template *fix_template_new(void);
 void fix_template_free(struct fix_template *self);
 char *fix_field_unparse_zpad(struct fix_field *self, int zpad, struct buffer *buffer);
+void fix_template_cfg_new_order_single(struct fix_template_cfg *cfg, unsigned long cl_ord_id_len);
+void fix_template_cfg_order_cancel_request(struct fix_template_cfg *cfg, unsigned long cl_ord_id_len);
+void fix_template_cfg_order_cancel_replace(struct fix_template_cfg *cfg, unsigned long cl_ord_id_len);
 void fix_template_prepare(struct fix_template *self, struct fix_template_cfg *cfg);
-void fix_template_update_time(struct fix_template *self, const char *str_now);
+int fix_template_set_field(struct fix_template *self, struct fix_field *field);
+int fix_template_update_time(struct fix_template *self, struct timespec *realtime);
 void fix_template_unparse(struct fix_template *self, struct fix_session *session);
 int fix_template_send(struct fix_template *self, int sockfd, int flags);
 
@@ -0,0 +1,571 @@
+#ifndef LIBTRADING_ICE_OS_FIX_H
+#define LIBTRADING_ICE_OS_FIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/proto/fix_session.h"
+
+extern struct fix_dialect ice_os_fix_dialect;
+
+enum ice_os_fix_tag {
+	ICE_OS_TAG_MsgSeqNum = 34,
+	ICE_OS_TAG_SenderCompID = 49,
+	ICE_OS_TAG_TargetCompID = 56,
+	ICE_OS_TAG_TargetSubID = 57,
+	ICE_OS_TAG_SenderSubID = 50,
+	ICE_OS_TAG_PossDupFlag = 43,
+	ICE_OS_TAG_PossResend = 97,
+	ICE_OS_TAG_SendingTime = 52,
+	ICE_OS_TAG_CheckSum = 10,
+	ICE_OS_TAG_UserName = 553,
+	ICE_OS_TAG_RawData = 96,
+	ICE_OS_TAG_EncryptMethod = 98,
+	ICE_OS_TAG_ResetSeqNumFlag = 141,
+	ICE_OS_TAG_HeartbeatInt = 108,
+	ICE_OS_TAG_Text = 58,
+	ICE_OS_TAG_TestReqID = 112,
+	ICE_OS_TAG_BeginSeqNo = 7,
+	ICE_OS_TAG_EndSeqNo = 16,
+	ICE_OS_TAG_NewSeqNo = 36,
+	ICE_OS_TAG_GapFillFlag = 123,
+	ICE_OS_TAG_RefSeqNum = 45,
+	ICE_OS_TAG_RefTagID = 371,
+	ICE_OS_TAG_RefMsgType = 372,
+	ICE_OS_TAG_SessionRejectReason = 373,
+	ICE_OS_TAG_EncodedTextLen = 354,
+	ICE_OS_TAG_EncodedText = 355,
+	ICE_OS_TAG_ClientID = 109,
+	ICE_OS_TAG_ClOrdID = 11,
+	ICE_OS_TAG_OnBehalfOfCompID = 115,
+	ICE_OS_TAG_OnBehalfOfSubID = 116,
+	ICE_OS_TAG_OnBehalfOfLocationID = 144,
+	ICE_OS_TAG_OriginatorUserID = 9139,
+	ICE_OS_TAG_HandlInst = 21,
+	ICE_OS_TAG_Symbol = 55,
+	ICE_OS_TAG_SecurityType = 167,
+	ICE_OS_TAG_PutOrCall = 201,
+	ICE_OS_TAG_StrikePrice = 202,
+	ICE_OS_TAG_CustOrderHandlingInst = 1031,
+	ICE_OS_TAG_Side = 54,
+	ICE_OS_TAG_TransactTime = 60,
+	ICE_OS_TAG_OrderQty = 38,
+	ICE_OS_TAG_MaxShow = 210,
+	ICE_OS_TAG_OrdType = 40,
+	ICE_OS_TAG_Price = 44,
+	ICE_OS_TAG_PriceType = 423,
+	ICE_OS_TAG_StopPx = 99,
+	ICE_OS_TAG_PositionEffect = 77,
+	ICE_OS_TAG_TimeInForce = 59,
+	ICE_OS_TAG_NoAllocs = 78,
+	ICE_OS_TAG_AllocHandlInst = 209,
+	ICE_OS_TAG_GiveUpClearingFirm = 9196,
+	ICE_OS_TAG_AllocAccount = 79,
+	ICE_OS_TAG_AllocQty = 80,
+	ICE_OS_TAG_ClearingAccount = 440,
+	ICE_OS_TAG_ClearingFirm = 439,
+	ICE_OS_TAG_MemoField = 9121,
+	ICE_OS_TAG_AccountCode = 9195,
+	ICE_OS_TAG_CTICode = 9208,
+	ICE_OS_TAG_CustomerAccountRefId = 9207,
+	ICE_OS_TAG_OrigClOrdID = 41,
+	ICE_OS_TAG_OrderID = 37,
+	ICE_OS_TAG_OrdStatus = 39,
+	ICE_OS_TAG_CxlRejectresponseTo = 434,
+	ICE_OS_TAG_CxlRejectReason = 102,
+	ICE_OS_TAG_ExecID = 17,
+	ICE_OS_TAG_ExecTransType = 20,
+	ICE_OS_TAG_ExecRefID = 19,
+	ICE_OS_TAG_ExecType = 150,
+	ICE_OS_TAG_OrdRejReason = 103,
+	ICE_OS_TAG_OrderState = 9175,
+	ICE_OS_TAG_LiquidityIndicator = 9120,
+	ICE_OS_TAG_ExecRestatementReason = 378,
+	ICE_OS_TAG_LeavesQty = 151,
+	ICE_OS_TAG_CumQty = 14,
+	ICE_OS_TAG_AvgPx = 6,
+	ICE_OS_TAG_LastPx = 31,
+	ICE_OS_TAG_LastParPx = 669,
+	ICE_OS_TAG_LastQty = 32,
+	ICE_OS_TAG_MultiLegReportingType = 442,
+	ICE_OS_TAG_SecondaryExecID = 527,
+	ICE_OS_TAG_CrossID = 548,
+	ICE_OS_TAG_CrossType = 549,
+	ICE_OS_TAG_DeliveryStartDate = 9520,
+	ICE_OS_TAG_DeliveryEndDate = 9521,
+	ICE_OS_TAG_CrossExecutionType = 9405,
+};
+
+/* Logon (MsgType A), see ice_os_logon_parse() */
+struct ice_os_logon {
+	uint64_t		present;	/* ICE_OS_LOGON_* bits */
+	const char		*user_name;
+	unsigned int		user_name_len;
+	const char		*raw_data;
+	unsigned int		raw_data_len;
+	int64_t			encrypt_method;
+	char			reset_seq_num_flag;
+	int64_t			heartbeat_int;
+};
+
+#define ICE_OS_LOGON_USER_NAME	(1ULL << 0)
+#define ICE_OS_LOGON_RAW_DATA	(1ULL << 1)
+#define ICE_OS_LOGON_ENCRYPT_METHOD	(1ULL << 2)
+#define ICE_OS_LOGON_RESET_SEQ_NUM_FLAG	(1ULL << 3)
+#define ICE_OS_LOGON_HEARTBEAT_INT	(1ULL << 4)
+
+int ice_os_logon_parse(struct ice_os_logon *self, struct fix_message *msg);
+
+/* Logout (MsgType 5), see ice_os_logout_parse() */
+struct ice_os_logout {
+	uint64_t		present;	/* ICE_OS_LOGOUT_* bits */
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define ICE_OS_LOGOUT_TEXT	(1ULL << 0)
+
+int ice_os_logout_parse(struct ice_os_logout *self, struct fix_message *msg);
+
+/* Heartbeat (MsgType 0), see ice_os_heartbeat_parse() */
+struct ice_os_heartbeat {
+	uint64_t		present;	/* ICE_OS_HEARTBEAT_* bits */
+	const char		*test_req_id;
+	unsigned int		test_req_id_len;
+};
+
+#define ICE_OS_HEARTBEAT_TEST_REQ_ID	(1ULL << 0)
+
+int ice_os_heartbeat_parse(struct ice_os_heartbeat *self, struct fix_message *msg);
+
+/* TestRequest (MsgType 1), see ice_os_test_request_parse() */
+struct ice_os_test_request {
+	uint64_t		present;	/* ICE_OS_TEST_REQUEST_* bits */
+	const char		*test_req_id;
+	unsigned int		test_req_id_len;
+};
+
+#define ICE_OS_TEST_REQUEST_TEST_REQ_ID	(1ULL << 0)
+
+int ice_os_test_request_parse(struct ice_os_test_request *self, struct fix_message *msg);
+
+/* ResendRequest (MsgType 2), see ice_os_resend_request_parse() */
+struct ice_os_resend_request {
+	uint64_t		present;	/* ICE_OS_RESEND_REQUEST_* bits */
+	int64_t			begin_seq_no;
+	int64_t			end_seq_no;
+};
+
+#define ICE_OS_RESEND_REQUEST_BEGIN_SEQ_NO	(1ULL << 0)
+#define ICE_OS_RESEND_REQUEST_END_SEQ_NO	(1ULL << 1)
+
+int ice_os_resend_request_parse(struct ice_os_resend_request *self, struct fix_message *msg);
+
+/* SequenceReset (MsgType 4), see ice_os_sequence_reset_parse() */
+struct ice_os_sequence_reset {
+	uint64_t		present;	/* ICE_OS_SEQUENCE_RESET_* bits */
+	int64_t			new_seq_no;
+	char			gap_fill_flag;
+};
+
+#define ICE_OS_SEQUENCE_RESET_NEW_SEQ_NO	(1ULL << 0)
+#define ICE_OS_SEQUENCE_RESET_GAP_FILL_FLAG	(1ULL << 1)
+
+int ice_os_sequence_reset_parse(struct ice_os_sequence_reset *self, struct fix_message *msg);
+
+/* SessionLevelReject (MsgType 3), see ice_os_session_level_reject_parse() */
+struct ice_os_session_level_reject {
+	uint64_t		present;	/* ICE_OS_SESSION_LEVEL_REJECT_* bits */
+	int64_t			ref_seq_num;
+	const char		*ref_tag_id;
+	unsigned int		ref_tag_id_len;
+	const char		*ref_msg_type;
+	unsigned int		ref_msg_type_len;
+	int64_t			session_reject_reason;
+	const char		*text;
+	unsigned int		text_len;
+	int64_t			encoded_text_len;
+	const char		*encoded_text;
+};
+
+#define ICE_OS_SESSION_LEVEL_REJECT_REF_SEQ_NUM	(1ULL << 0)
+#define ICE_OS_SESSION_LEVEL_REJECT_REF_TAG_ID	(1ULL << 1)
+#define ICE_OS_SESSION_LEVEL_REJECT_REF_MSG_TYPE	(1ULL << 2)
+#define ICE_OS_SESSION_LEVEL_REJECT_SESSION_REJECT_REASON	(1ULL << 3)
+#define ICE_OS_SESSION_LEVEL_REJECT_TEXT	(1ULL << 4)
+#define ICE_OS_SESSION_LEVEL_REJECT_ENCODED_TEXT_LEN	(1ULL << 5)
+#define ICE_OS_SESSION_LEVEL_REJECT_ENCODED_TEXT	(1ULL << 6)
+
+int ice_os_session_level_reject_parse(struct ice_os_session_level_reject *self, struct fix_message *msg);
+
+/* TraderLogin (MsgType CG), see ice_os_trader_login_parse() */
+struct ice_os_trader_login {
+	uint64_t		present;	/* ICE_OS_TRADER_LOGIN_* bits */
+	const char		*client_id;
+	unsigned int		client_id_len;
+	const char		*user_name;
+	unsigned int		user_name_len;
+	const char		*raw_data;
+	unsigned int		raw_data_len;
+};
+
+#define ICE_OS_TRADER_LOGIN_CLIENT_ID	(1ULL << 0)
+#define ICE_OS_TRADER_LOGIN_USER_NAME	(1ULL << 1)
+#define ICE_OS_TRADER_LOGIN_RAW_DATA	(1ULL << 2)
+
+int ice_os_trader_login_parse(struct ice_os_trader_login *self, struct fix_message *msg);
+
+/* TraderLogout (MsgType CH), see ice_os_trader_logout_parse() */
+struct ice_os_trader_logout {
+	uint64_t		present;	/* ICE_OS_TRADER_LOGOUT_* bits */
+	const char		*client_id;
+	unsigned int		client_id_len;
+	const char		*user_name;
+	unsigned int		user_name_len;
+};
+
+#define ICE_OS_TRADER_LOGOUT_CLIENT_ID	(1ULL << 0)
+#define ICE_OS_TRADER_LOGOUT_USER_NAME	(1ULL << 1)
+
+int ice_os_trader_logout_parse(struct ice_os_trader_logout *self, struct fix_message *msg);
+
+/* NewOrderSingle (MsgType D), see ice_os_new_order_single_parse() */
+struct ice_os_new_order_single {
+	uint64_t		present;	/* ICE_OS_NEW_ORDER_SINGLE_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*client_id;
+	unsigned int		client_id_len;
+	const char		*on_behalf_of_comp_id;
+	unsigned int		on_behalf_of_comp_id_len;
+	const char		*on_behalf_of_sub_id;
+	unsigned int		on_behalf_of_sub_id_len;
+	const char		*on_behalf_of_location_id;
+	unsigned int		on_behalf_of_location_id_len;
+	const char		*originator_user_id;
+	unsigned int		originator_user_id_len;
+	char			handl_inst;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	char			put_or_call;
+	double			strike_price;
+	char			cust_order_handling_inst;
+	char			side;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	int64_t			order_qty;
+	int64_t			max_show;
+	char			ord_type;
+	double			price;
+	int64_t			price_type;
+	double			stop_px;
+	char			position_effect;
+	char			time_in_force;
+	char			no_allocs;
+	char			alloc_handl_inst;
+	int64_t			give_up_clearing_firm;
+	const char		*alloc_account;
+	unsigned int		alloc_account_len;
+	int64_t			alloc_qty;
+	const char		*clearing_account;
+	unsigned int		clearing_account_len;
+	int64_t			clearing_firm;
+	const char		*memo_field;
+	unsigned int		memo_field_len;
+	char			account_code;
+	char			cti_code;
+	const char		*customer_account_ref_id;
+	unsigned int		customer_account_ref_id_len;
+};
+
+#define ICE_OS_NEW_ORDER_SINGLE_CL_ORD_ID	(1ULL << 0)
+#define ICE_OS_NEW_ORDER_SINGLE_CLIENT_ID	(1ULL << 1)
+#define ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_COMP_ID	(1ULL << 2)
+#define ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_SUB_ID	(1ULL << 3)
+#define ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_LOCATION_ID	(1ULL << 4)
+#define ICE_OS_NEW_ORDER_SINGLE_ORIGINATOR_USER_ID	(1ULL << 5)
+#define ICE_OS_NEW_ORDER_SINGLE_HANDL_INST	(1ULL << 6)
+#define ICE_OS_NEW_ORDER_SINGLE_SYMBOL	(1ULL << 7)
+#define ICE_OS_NEW_ORDER_SINGLE_SECURITY_TYPE	(1ULL << 8)
+#define ICE_OS_NEW_ORDER_SINGLE_PUT_OR_CALL	(1ULL << 9)
+#define ICE_OS_NEW_ORDER_SINGLE_STRIKE_PRICE	(1ULL << 10)
+#define ICE_OS_NEW_ORDER_SINGLE_CUST_ORDER_HANDLING_INST	(1ULL << 11)
+#define ICE_OS_NEW_ORDER_SINGLE_SIDE	(1ULL << 12)
+#define ICE_OS_NEW_ORDER_SINGLE_TRANSACT_TIME	(1ULL << 13)
+#define ICE_OS_NEW_ORDER_SINGLE_ORDER_QTY	(1ULL << 14)
+#define ICE_OS_NEW_ORDER_SINGLE_MAX_SHOW	(1ULL << 15)
+#define ICE_OS_NEW_ORDER_SINGLE_ORD_TYPE	(1ULL << 16)
+#define ICE_OS_NEW_ORDER_SINGLE_PRICE	(1ULL << 17)
+#define ICE_OS_NEW_ORDER_SINGLE_PRICE_TYPE	(1ULL << 18)
+#define ICE_OS_NEW_ORDER_SINGLE_STOP_PX	(1ULL << 19)
+#define ICE_OS_NEW_ORDER_SINGLE_POSITION_EFFECT	(1ULL << 20)
+#define ICE_OS_NEW_ORDER_SINGLE_TIME_IN_FORCE	(1ULL << 21)
+#define ICE_OS_NEW_ORDER_SINGLE_NO_ALLOCS	(1ULL << 22)
+#define ICE_OS_NEW_ORDER_SINGLE_ALLOC_HANDL_INST	(1ULL << 23)
+#define ICE_OS_NEW_ORDER_SINGLE_GIVE_UP_CLEARING_FIRM	(1ULL << 24)
+#define ICE_OS_NEW_ORDER_SINGLE_ALLOC_ACCOUNT	(1ULL << 25)
+#define ICE_OS_NEW_ORDER_SINGLE_ALLOC_QTY	(1ULL << 26)
+#define ICE_OS_NEW_ORDER_SINGLE_CLEARING_ACCOUNT	(1ULL << 27)
+#define ICE_OS_NEW_ORDER_SINGLE_CLEARING_FIRM	(1ULL << 28)
+#define ICE_OS_NEW_ORDER_SINGLE_MEMO_FIELD	(1ULL << 29)
+#define ICE_OS_NEW_ORDER_SINGLE_ACCOUNT_CODE	(1ULL << 30)
+#define ICE_OS_NEW_ORDER_SINGLE_CTI_CODE	(1ULL << 31)
+#define ICE_OS_NEW_ORDER_SINGLE_CUSTOMER_ACCOUNT_REF_ID	(1ULL << 32)
+
+int ice_os_new_order_single_parse(struct ice_os_new_order_single *self, struct fix_message *msg);
+
+/* ExecutionReport (MsgType 8), see ice_os_execution_report_parse() */
+struct ice_os_execution_report {
+	uint64_t		present;	/* ICE_OS_EXECUTION_REPORT_* bits */
+	int64_t			order_id;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	const char		*client_id;
+	unsigned int		client_id_len;
+	const char		*originator_user_id;
+	unsigned int		originator_user_id_len;
+	const char		*exec_id;
+	unsigned int		exec_id_len;
+	char			exec_trans_type;
+	const char		*exec_ref_id;
+	unsigned int		exec_ref_id_len;
+	char			exec_type;
+	char			ord_status;
+	int64_t			ord_rej_reason;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	char			side;
+	int64_t			order_qty;
+	char			put_or_call;
+	double			strike_price;
+	char			cust_order_handling_inst;
+	int64_t			max_show;
+	char			ord_type;
+	double			price;
+	char			order_state;
+	char			liquidity_indicator;
+	int64_t			exec_restatement_reason;
+	char			time_in_force;
+	int64_t			leaves_qty;
+	int64_t			cum_qty;
+	double			avg_px;
+	double			last_px;
+	double			last_par_px;
+	int64_t			last_qty;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	char			multi_leg_reporting_type;
+	const char		*secondary_exec_id;
+	unsigned int		secondary_exec_id_len;
+	const char		*cross_id;
+	unsigned int		cross_id_len;
+	char			cross_type;
+	int64_t			clearing_firm;
+	const char		*clearing_account;
+	unsigned int		clearing_account_len;
+	const char		*memo_field;
+	unsigned int		memo_field_len;
+	const char		*delivery_start_date;
+	unsigned int		delivery_start_date_len;
+	const char		*delivery_end_date;
+	unsigned int		delivery_end_date_len;
+	int64_t			cross_execution_type;
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define ICE_OS_EXECUTION_REPORT_ORDER_ID	(1ULL << 0)
+#define ICE_OS_EXECUTION_REPORT_CL_ORD_ID	(1ULL << 1)
+#define ICE_OS_EXECUTION_REPORT_ORIG_CL_ORD_ID	(1ULL << 2)
+#define ICE_OS_EXECUTION_REPORT_CLIENT_ID	(1ULL << 3)
+#define ICE_OS_EXECUTION_REPORT_ORIGINATOR_USER_ID	(1ULL << 4)
+#define ICE_OS_EXECUTION_REPORT_EXEC_ID	(1ULL << 5)
+#define ICE_OS_EXECUTION_REPORT_EXEC_TRANS_TYPE	(1ULL << 6)
+#define ICE_OS_EXECUTION_REPORT_EXEC_REF_ID	(1ULL << 7)
+#define ICE_OS_EXECUTION_REPORT_EXEC_TYPE	(1ULL << 8)
+#define ICE_OS_EXECUTION_REPORT_ORD_STATUS	(1ULL << 9)
+#define ICE_OS_EXECUTION_REPORT_ORD_REJ_REASON	(1ULL << 10)
+#define ICE_OS_EXECUTION_REPORT_SYMBOL	(1ULL << 11)
+#define ICE_OS_EXECUTION_REPORT_SIDE	(1ULL << 12)
+#define ICE_OS_EXECUTION_REPORT_ORDER_QTY	(1ULL << 13)
+#define ICE_OS_EXECUTION_REPORT_PUT_OR_CALL	(1ULL << 14)
+#define ICE_OS_EXECUTION_REPORT_STRIKE_PRICE	(1ULL << 15)
+#define ICE_OS_EXECUTION_REPORT_CUST_ORDER_HANDLING_INST	(1ULL << 16)
+#define ICE_OS_EXECUTION_REPORT_MAX_SHOW	(1ULL << 17)
+#define ICE_OS_EXECUTION_REPORT_ORD_TYPE	(1ULL << 18)
+#define ICE_OS_EXECUTION_REPORT_PRICE	(1ULL << 19)
+#define ICE_OS_EXECUTION_REPORT_ORDER_STATE	(1ULL << 20)
+#define ICE_OS_EXECUTION_REPORT_LIQUIDITY_INDICATOR	(1ULL << 21)
+#define ICE_OS_EXECUTION_REPORT_EXEC_RESTATEMENT_REASON	(1ULL << 22)
+#define ICE_OS_EXECUTION_REPORT_TIME_IN_FORCE	(1ULL << 23)
+#define ICE_OS_EXECUTION_REPORT_LEAVES_QTY	(1ULL << 24)
+#define ICE_OS_EXECUTION_REPORT_CUM_QTY	(1ULL << 25)
+#define ICE_OS_EXECUTION_REPORT_AVG_PX	(1ULL << 26)
+#define ICE_OS_EXECUTION_REPORT_LAST_PX	(1ULL << 27)
+#define ICE_OS_EXECUTION_REPORT_LAST_PAR_PX	(1ULL << 28)
+#define ICE_OS_EXECUTION_REPORT_LAST_QTY	(1ULL << 29)
+#define ICE_OS_EXECUTION_REPORT_TRANSACT_TIME	(1ULL << 30)
+#define ICE_OS_EXECUTION_REPORT_MULTI_LEG_REPORTING_TYPE	(1ULL << 31)
+#define ICE_OS_EXECUTION_REPORT_SECONDARY_EXEC_ID	(1ULL << 32)
+#define ICE_OS_EXECUTION_REPORT_CROSS_ID	(1ULL << 33)
+#define ICE_OS_EXECUTION_REPORT_CROSS_TYPE	(1ULL << 34)
+#define ICE_OS_EXECUTION_REPORT_CLEARING_FIRM	(1ULL << 35)
+#define ICE_OS_EXECUTION_REPORT_CLEARING_ACCOUNT	(1ULL << 36)
+#define ICE_OS_EXECUTION_REPORT_MEMO_FIELD	(1ULL << 37)
+#define ICE_OS_EXECUTION_REPORT_DELIVERY_START_DATE	(1ULL << 38)
+#define ICE_OS_EXECUTION_REPORT_DELIVERY_END_DATE	(1ULL << 39)
+#define ICE_OS_EXECUTION_REPORT_CROSS_EXECUTION_TYPE	(1ULL << 40)
+#define ICE_OS_EXECUTION_REPORT_TEXT	(1ULL << 41)
+
+int ice_os_execution_report_parse(struct ice_os_execution_report *self, struct fix_message *msg);
+
+/* OrderCancelRequest (MsgType F), see ice_os_order_cancel_request_parse() */
+struct ice_os_order_cancel_request {
+	uint64_t		present;	/* ICE_OS_ORDER_CANCEL_REQUEST_* bits */
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*client_id;
+	unsigned int		client_id_len;
+	const char		*originator_user_id;
+	unsigned int		originator_user_id_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	char			put_or_call;
+	double			strike_price;
+	char			side;
+};
+
+#define ICE_OS_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID	(1ULL << 0)
+#define ICE_OS_ORDER_CANCEL_REQUEST_CL_ORD_ID	(1ULL << 1)
+#define ICE_OS_ORDER_CANCEL_REQUEST_CLIENT_ID	(1ULL << 2)
+#define ICE_OS_ORDER_CANCEL_REQUEST_ORIGINATOR_USER_ID	(1ULL << 3)
+#define ICE_OS_ORDER_CANCEL_REQUEST_SYMBOL	(1ULL << 4)
+#define ICE_OS_ORDER_CANCEL_REQUEST_SECURITY_TYPE	(1ULL << 5)
+#define ICE_OS_ORDER_CANCEL_REQUEST_PUT_OR_CALL	(1ULL << 6)
+#define ICE_OS_ORDER_CANCEL_REQUEST_STRIKE_PRICE	(1ULL << 7)
+#define ICE_OS_ORDER_CANCEL_REQUEST_SIDE	(1ULL << 8)
+
+int ice_os_order_cancel_request_parse(struct ice_os_order_cancel_request *self, struct fix_message *msg);
+
+/* OrderCancelReplaceRequest (MsgType G), see ice_os_order_cancel_replace_request_parse() */
+struct ice_os_order_cancel_replace_request {
+	uint64_t		present;	/* ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_* bits */
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*client_id;
+	unsigned int		client_id_len;
+	const char		*on_behalf_of_comp_id;
+	unsigned int		on_behalf_of_comp_id_len;
+	const char		*on_behalf_of_sub_id;
+	unsigned int		on_behalf_of_sub_id_len;
+	const char		*on_behalf_of_location_id;
+	unsigned int		on_behalf_of_location_id_len;
+	const char		*originator_user_id;
+	unsigned int		originator_user_id_len;
+	char			handl_inst;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	char			side;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	int64_t			order_qty;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	char			put_or_call;
+	double			strike_price;
+	char			cust_order_handling_inst;
+	int64_t			max_show;
+	char			ord_type;
+	double			price;
+	int64_t			price_type;
+	double			stop_px;
+	char			time_in_force;
+	const char		*clearing_account;
+	unsigned int		clearing_account_len;
+	int64_t			clearing_firm;
+	const char		*memo_field;
+	unsigned int		memo_field_len;
+	char			account_code;
+	char			cti_code;
+	const char		*customer_account_ref_id;
+	unsigned int		customer_account_ref_id_len;
+};
+
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID	(1ULL << 0)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID	(1ULL << 1)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLIENT_ID	(1ULL << 2)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_COMP_ID	(1ULL << 3)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_SUB_ID	(1ULL << 4)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_LOCATION_ID	(1ULL << 5)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORIGINATOR_USER_ID	(1ULL << 6)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST	(1ULL << 7)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL	(1ULL << 8)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SIDE	(1ULL << 9)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME	(1ULL << 10)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY	(1ULL << 11)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_TYPE	(1ULL << 12)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PUT_OR_CALL	(1ULL << 13)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_STRIKE_PRICE	(1ULL << 14)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CUST_ORDER_HANDLING_INST	(1ULL << 15)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW	(1ULL << 16)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE	(1ULL << 17)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PRICE	(1ULL << 18)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PRICE_TYPE	(1ULL << 19)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_STOP_PX	(1ULL << 20)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_TIME_IN_FORCE	(1ULL << 21)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLEARING_ACCOUNT	(1ULL << 22)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLEARING_FIRM	(1ULL << 23)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_MEMO_FIELD	(1ULL << 24)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT_CODE	(1ULL << 25)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CTI_CODE	(1ULL << 26)
+#define ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CUSTOMER_ACCOUNT_REF_ID	(1ULL << 27)
+
+int ice_os_order_cancel_replace_request_parse(struct ice_os_order_cancel_replace_request *self, struct fix_message *msg);
+
+/* OrderCancelReject (MsgType 9), see ice_os_order_cancel_reject_parse() */
+struct ice_os_order_cancel_reject {
+	uint64_t		present;	/* ICE_OS_ORDER_CANCEL_REJECT_* bits */
+	int64_t			order_id;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	char			ord_status;
+	const char		*client_id;
+	unsigned int		client_id_len;
+	const char		*originator_user_id;
+	unsigned int		originator_user_id_len;
+	char			cxl_rejectresponse_to;
+	char			cxl_reject_reason;
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define ICE_OS_ORDER_CANCEL_REJECT_ORDER_ID	(1ULL << 0)
+#define ICE_OS_ORDER_CANCEL_REJECT_CL_ORD_ID	(1ULL << 1)
+#define ICE_OS_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID	(1ULL << 2)
+#define ICE_OS_ORDER_CANCEL_REJECT_ORD_STATUS	(1ULL << 3)
+#define ICE_OS_ORDER_CANCEL_REJECT_CLIENT_ID	(1ULL << 4)
+#define ICE_OS_ORDER_CANCEL_REJECT_ORIGINATOR_USER_ID	(1ULL << 5)
+#define ICE_OS_ORDER_CANCEL_REJECT_CXL_REJECTRESPONSE_TO	(1ULL << 6)
+#define ICE_OS_ORDER_CANCEL_REJECT_CXL_REJECT_REASON	(1ULL << 7)
+#define ICE_OS_ORDER_CANCEL_REJECT_TEXT	(1ULL << 8)
+
+int ice_os_order_cancel_reject_parse(struct ice_os_order_cancel_reject *self, struct fix_message *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTRADING_ICE_OS_FIX_H */
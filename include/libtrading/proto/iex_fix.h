@@ -0,0 +1,305 @@
+#ifndef LIBTRADING_IEX_FIX_H
+#define LIBTRADING_IEX_FIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/proto/fix_session.h"
+
+extern struct fix_dialect iex_fix_dialect;
+
+enum iex_fix_tag {
+	IEX_TAG_SenderCompID = 49,
+	IEX_TAG_SendingTime = 52,
+	IEX_TAG_TargetCompID = 56,
+	IEX_TAG_CheckSum = 10,
+	IEX_TAG_PossDupFlag = 43,
+	IEX_TAG_PossResend = 97,
+	IEX_TAG_OrigSendingTime = 122,
+	IEX_TAG_Account = 1,
+	IEX_TAG_ClOrdID = 11,
+	IEX_TAG_ExecInst = 18,
+	IEX_TAG_HandlInst = 21,
+	IEX_TAG_OrderQty = 38,
+	IEX_TAG_OrdType = 40,
+	IEX_TAG_OrigClOrdId = 41,
+	IEX_TAG_Price = 44,
+	IEX_TAG_OrderCapacity = 47,
+	IEX_TAG_SenderSubID = 50,
+	IEX_TAG_Side = 54,
+	IEX_TAG_Symbol = 55,
+	IEX_TAG_Text = 58,
+	IEX_TAG_TimeInForce = 59,
+	IEX_TAG_TransactTime = 60,
+	IEX_TAG_ClientID = 109,
+	IEX_TAG_MinQty = 110,
+	IEX_TAG_MaxFloor = 111,
+	IEX_TAG_LocateReqd = 114,
+	IEX_TAG_OnBehalfOfCompID = 115,
+	IEX_TAG_ExpireTime = 126,
+	IEX_TAG_AvgPrice = 6,
+	IEX_TAG_CumQty = 14,
+	IEX_TAG_ExecID = 17,
+	IEX_TAG_ExecRefID = 19,
+	IEX_TAG_ExecTransType = 20,
+	IEX_TAG_LastMkt = 30,
+	IEX_TAG_LastPx = 31,
+	IEX_TAG_LastShares = 32,
+	IEX_TAG_OrderID = 37,
+	IEX_TAG_OrderStatus = 39,
+	IEX_TAG_OrigTime = 42,
+	IEX_TAG_CxlRejReason = 102,
+	IEX_TAG_OrdRejReason = 103,
+	IEX_TAG_DeliverToCompID = 128,
+	IEX_TAG_ExecType = 150,
+	IEX_TAG_LeavesQty = 151,
+	IEX_TAG_CxlRejResponseTo = 434,
+	IEX_TAG_TradeLiquidityIndicator = 9730,
+};
+
+/* SessionReject (MsgType 3), see iex_session_reject_parse() */
+struct iex_session_reject {
+	uint64_t		present;	/* IEX_SESSION_REJECT_* bits */
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define IEX_SESSION_REJECT_TEXT	(1ULL << 0)
+
+int iex_session_reject_parse(struct iex_session_reject *self, struct fix_message *msg);
+
+/* Logout (MsgType 5), see iex_logout_parse() */
+struct iex_logout {
+	uint64_t		present;	/* IEX_LOGOUT_* bits */
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define IEX_LOGOUT_TEXT	(1ULL << 0)
+
+int iex_logout_parse(struct iex_logout *self, struct fix_message *msg);
+
+/* NewOrderSingle (MsgType D), see iex_new_order_single_parse() */
+struct iex_new_order_single {
+	uint64_t		present;	/* IEX_NEW_ORDER_SINGLE_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*exec_inst;
+	unsigned int		exec_inst_len;
+	const char		*handl_inst;
+	unsigned int		handl_inst_len;
+	const char		*order_qty;
+	unsigned int		order_qty_len;
+	const char		*ord_type;
+	unsigned int		ord_type_len;
+	double			price;
+	const char		*order_capacity;
+	unsigned int		order_capacity_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*time_in_force;
+	unsigned int		time_in_force_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	const char		*account;
+	unsigned int		account_len;
+	const char		*text;
+	unsigned int		text_len;
+	const char		*min_qty;
+	unsigned int		min_qty_len;
+	const char		*max_floor;
+	unsigned int		max_floor_len;
+	const char		*locate_reqd;
+	unsigned int		locate_reqd_len;
+};
+
+#define IEX_NEW_ORDER_SINGLE_CL_ORD_ID	(1ULL << 0)
+#define IEX_NEW_ORDER_SINGLE_EXEC_INST	(1ULL << 1)
+#define IEX_NEW_ORDER_SINGLE_HANDL_INST	(1ULL << 2)
+#define IEX_NEW_ORDER_SINGLE_ORDER_QTY	(1ULL << 3)
+#define IEX_NEW_ORDER_SINGLE_ORD_TYPE	(1ULL << 4)
+#define IEX_NEW_ORDER_SINGLE_PRICE	(1ULL << 5)
+#define IEX_NEW_ORDER_SINGLE_ORDER_CAPACITY	(1ULL << 6)
+#define IEX_NEW_ORDER_SINGLE_SIDE	(1ULL << 7)
+#define IEX_NEW_ORDER_SINGLE_SYMBOL	(1ULL << 8)
+#define IEX_NEW_ORDER_SINGLE_TIME_IN_FORCE	(1ULL << 9)
+#define IEX_NEW_ORDER_SINGLE_TRANSACT_TIME	(1ULL << 10)
+#define IEX_NEW_ORDER_SINGLE_ACCOUNT	(1ULL << 11)
+#define IEX_NEW_ORDER_SINGLE_TEXT	(1ULL << 12)
+#define IEX_NEW_ORDER_SINGLE_MIN_QTY	(1ULL << 13)
+#define IEX_NEW_ORDER_SINGLE_MAX_FLOOR	(1ULL << 14)
+#define IEX_NEW_ORDER_SINGLE_LOCATE_REQD	(1ULL << 15)
+
+int iex_new_order_single_parse(struct iex_new_order_single *self, struct fix_message *msg);
+
+/* OrderCancelReplaceRequest (MsgType G), see iex_order_cancel_replace_request_parse() */
+struct iex_order_cancel_replace_request {
+	uint64_t		present;	/* IEX_ORDER_CANCEL_REPLACE_REQUEST_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*handl_inst;
+	unsigned int		handl_inst_len;
+	const char		*order_qty;
+	unsigned int		order_qty_len;
+	const char		*ord_type;
+	unsigned int		ord_type_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	double			price;
+};
+
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID	(1ULL << 0)
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST	(1ULL << 1)
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY	(1ULL << 2)
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE	(1ULL << 3)
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_SIDE	(1ULL << 4)
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL	(1ULL << 5)
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME	(1ULL << 6)
+#define IEX_ORDER_CANCEL_REPLACE_REQUEST_PRICE	(1ULL << 7)
+
+int iex_order_cancel_replace_request_parse(struct iex_order_cancel_replace_request *self, struct fix_message *msg);
+
+/* OrderCancelRequest (MsgType F), see iex_order_cancel_request_parse() */
+struct iex_order_cancel_request {
+	uint64_t		present;	/* IEX_ORDER_CANCEL_REQUEST_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*order_qty;
+	unsigned int		order_qty_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+};
+
+#define IEX_ORDER_CANCEL_REQUEST_CL_ORD_ID	(1ULL << 0)
+#define IEX_ORDER_CANCEL_REQUEST_ORDER_QTY	(1ULL << 1)
+#define IEX_ORDER_CANCEL_REQUEST_SIDE	(1ULL << 2)
+#define IEX_ORDER_CANCEL_REQUEST_SYMBOL	(1ULL << 3)
+#define IEX_ORDER_CANCEL_REQUEST_TRANSACT_TIME	(1ULL << 4)
+
+int iex_order_cancel_request_parse(struct iex_order_cancel_request *self, struct fix_message *msg);
+
+/* ExecutionReport (MsgType 8), see iex_execution_report_parse() */
+struct iex_execution_report {
+	uint64_t		present;	/* IEX_EXECUTION_REPORT_* bits */
+	double			avg_price;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	double			cum_qty;
+	const char		*exec_id;
+	unsigned int		exec_id_len;
+	const char		*exec_inst;
+	unsigned int		exec_inst_len;
+	const char		*order_id;
+	unsigned int		order_id_len;
+	const char		*order_qty;
+	unsigned int		order_qty_len;
+	const char		*ord_type;
+	unsigned int		ord_type_len;
+	const char		*order_capacity;
+	unsigned int		order_capacity_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*time_in_force;
+	unsigned int		time_in_force_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	const char		*leaves_qty;
+	unsigned int		leaves_qty_len;
+	const char		*account;
+	unsigned int		account_len;
+	double			price;
+	const char		*min_qty;
+	unsigned int		min_qty_len;
+	const char		*max_floor;
+	unsigned int		max_floor_len;
+	const char		*expire_time;
+	unsigned int		expire_time_len;
+	const char		*exec_trans_type;
+	unsigned int		exec_trans_type_len;
+	const char		*order_status;
+	unsigned int		order_status_len;
+	const char		*exec_type;
+	unsigned int		exec_type_len;
+	const char		*last_mkt;
+	unsigned int		last_mkt_len;
+	const char		*last_px;
+	unsigned int		last_px_len;
+	const char		*last_shares;
+	unsigned int		last_shares_len;
+	const char		*trade_liquidity_indicator;
+	unsigned int		trade_liquidity_indicator_len;
+	const char		*client_id;
+	unsigned int		client_id_len;
+};
+
+#define IEX_EXECUTION_REPORT_AVG_PRICE	(1ULL << 0)
+#define IEX_EXECUTION_REPORT_CL_ORD_ID	(1ULL << 1)
+#define IEX_EXECUTION_REPORT_CUM_QTY	(1ULL << 2)
+#define IEX_EXECUTION_REPORT_EXEC_ID	(1ULL << 3)
+#define IEX_EXECUTION_REPORT_EXEC_INST	(1ULL << 4)
+#define IEX_EXECUTION_REPORT_ORDER_ID	(1ULL << 5)
+#define IEX_EXECUTION_REPORT_ORDER_QTY	(1ULL << 6)
+#define IEX_EXECUTION_REPORT_ORD_TYPE	(1ULL << 7)
+#define IEX_EXECUTION_REPORT_ORDER_CAPACITY	(1ULL << 8)
+#define IEX_EXECUTION_REPORT_SIDE	(1ULL << 9)
+#define IEX_EXECUTION_REPORT_SYMBOL	(1ULL << 10)
+#define IEX_EXECUTION_REPORT_TIME_IN_FORCE	(1ULL << 11)
+#define IEX_EXECUTION_REPORT_TRANSACT_TIME	(1ULL << 12)
+#define IEX_EXECUTION_REPORT_LEAVES_QTY	(1ULL << 13)
+#define IEX_EXECUTION_REPORT_ACCOUNT	(1ULL << 14)
+#define IEX_EXECUTION_REPORT_PRICE	(1ULL << 15)
+#define IEX_EXECUTION_REPORT_MIN_QTY	(1ULL << 16)
+#define IEX_EXECUTION_REPORT_MAX_FLOOR	(1ULL << 17)
+#define IEX_EXECUTION_REPORT_EXPIRE_TIME	(1ULL << 18)
+#define IEX_EXECUTION_REPORT_EXEC_TRANS_TYPE	(1ULL << 19)
+#define IEX_EXECUTION_REPORT_ORDER_STATUS	(1ULL << 20)
+#define IEX_EXECUTION_REPORT_EXEC_TYPE	(1ULL << 21)
+#define IEX_EXECUTION_REPORT_LAST_MKT	(1ULL << 22)
+#define IEX_EXECUTION_REPORT_LAST_PX	(1ULL << 23)
+#define IEX_EXECUTION_REPORT_LAST_SHARES	(1ULL << 24)
+#define IEX_EXECUTION_REPORT_TRADE_LIQUIDITY_INDICATOR	(1ULL << 25)
+#define IEX_EXECUTION_REPORT_CLIENT_ID	(1ULL << 26)
+
+int iex_execution_report_parse(struct iex_execution_report *self, struct fix_message *msg);
+
+/* CancelReject (MsgType 9), see iex_cancel_reject_parse() */
+struct iex_cancel_reject {
+	uint64_t		present;	/* IEX_CANCEL_REJECT_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*order_id;
+	unsigned int		order_id_len;
+	const char		*cxl_rej_reason;
+	unsigned int		cxl_rej_reason_len;
+	const char		*cxl_rej_response_to;
+	unsigned int		cxl_rej_response_to_len;
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define IEX_CANCEL_REJECT_CL_ORD_ID	(1ULL << 0)
+#define IEX_CANCEL_REJECT_ORDER_ID	(1ULL << 1)
+#define IEX_CANCEL_REJECT_CXL_REJ_REASON	(1ULL << 2)
+#define IEX_CANCEL_REJECT_CXL_REJ_RESPONSE_TO	(1ULL << 3)
+#define IEX_CANCEL_REJECT_TEXT	(1ULL << 4)
+
+int iex_cancel_reject_parse(struct iex_cancel_reject *self, struct fix_message *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTRADING_IEX_FIX_H */
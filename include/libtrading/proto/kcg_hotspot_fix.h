@@ -0,0 +1,470 @@
+#ifndef LIBTRADING_KCG_HOTSPOT_FIX_H
+#define LIBTRADING_KCG_HOTSPOT_FIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/proto/fix_session.h"
+
+extern struct fix_dialect kcg_hotspot_fix_dialect;
+
+enum kcg_hotspot_fix_tag {
+	KCG_HOTSPOT_TAG_SenderCompID = 49,
+	KCG_HOTSPOT_TAG_SenderSubID = 50,
+	KCG_HOTSPOT_TAG_TargetCompID = 56,
+	KCG_HOTSPOT_TAG_OnBehalfOfSubID = 116,
+	KCG_HOTSPOT_TAG_PossDupFlag = 43,
+	KCG_HOTSPOT_TAG_PossResend = 97,
+	KCG_HOTSPOT_TAG_SendingTime = 52,
+	KCG_HOTSPOT_TAG_CheckSum = 10,
+	KCG_HOTSPOT_TAG_Username = 553,
+	KCG_HOTSPOT_TAG_Password = 554,
+	KCG_HOTSPOT_TAG_EncryptMethod = 98,
+	KCG_HOTSPOT_TAG_HeartBtInt = 108,
+	KCG_HOTSPOT_TAG_ResetSeqNumFlag = 141,
+	KCG_HOTSPOT_TAG_TestReqID = 112,
+	KCG_HOTSPOT_TAG_BeginSeqNo = 7,
+	KCG_HOTSPOT_TAG_EndSeqNo = 16,
+	KCG_HOTSPOT_TAG_RefSeqNum = 45,
+	KCG_HOTSPOT_TAG_RefTagID = 371,
+	KCG_HOTSPOT_TAG_RefMsgType = 372,
+	KCG_HOTSPOT_TAG_SessionRejectReason = 373,
+	KCG_HOTSPOT_TAG_Text = 58,
+	KCG_HOTSPOT_TAG_NewSeqNo = 36,
+	KCG_HOTSPOT_TAG_GapFillFlag = 123,
+	KCG_HOTSPOT_TAG_Account = 1,
+	KCG_HOTSPOT_TAG_ClOrdID = 11,
+	KCG_HOTSPOT_TAG_ExecInst = 18,
+	KCG_HOTSPOT_TAG_HandlInst = 21,
+	KCG_HOTSPOT_TAG_Currency = 15,
+	KCG_HOTSPOT_TAG_OrderQty = 38,
+	KCG_HOTSPOT_TAG_MaxShow = 210,
+	KCG_HOTSPOT_TAG_MinQty = 110,
+	KCG_HOTSPOT_TAG_Price = 44,
+	KCG_HOTSPOT_TAG_Side = 54,
+	KCG_HOTSPOT_TAG_Symbol = 55,
+	KCG_HOTSPOT_TAG_OrdType = 40,
+	KCG_HOTSPOT_TAG_TimeInForce = 59,
+	KCG_HOTSPOT_TAG_TransactTime = 60,
+	KCG_HOTSPOT_TAG_PegDifference = 211,
+	KCG_HOTSPOT_TAG_ExecID = 17,
+	KCG_HOTSPOT_TAG_ExecTransType = 20,
+	KCG_HOTSPOT_TAG_OrderID = 37,
+	KCG_HOTSPOT_TAG_OrdStatus = 39,
+	KCG_HOTSPOT_TAG_OrigClOrdID = 41,
+	KCG_HOTSPOT_TAG_ExecBroker = 76,
+	KCG_HOTSPOT_TAG_LeavesQty = 151,
+	KCG_HOTSPOT_TAG_CumQty = 14,
+	KCG_HOTSPOT_TAG_OrderQty2 = 192,
+	KCG_HOTSPOT_TAG_FutSetlDate = 64,
+	KCG_HOTSPOT_TAG_TradeDate = 75,
+	KCG_HOTSPOT_TAG_SettlCurrAmount = 119,
+	KCG_HOTSPOT_TAG_SettleCurrency = 120,
+	KCG_HOTSPOT_TAG_SecurityType = 167,
+	KCG_HOTSPOT_TAG_ExecType = 150,
+	KCG_HOTSPOT_TAG_LastShares = 32,
+	KCG_HOTSPOT_TAG_LastPx = 31,
+	KCG_HOTSPOT_TAG_NoContraBrokers = 382,
+	KCG_HOTSPOT_TAG_ContraBroker = 375,
+	KCG_HOTSPOT_TAG_CxlRejResponseTo = 434,
+	KCG_HOTSPOT_TAG_CxlRejReason = 102,
+};
+
+/* Logon (MsgType A), see kcg_hotspot_logon_parse() */
+struct kcg_hotspot_logon {
+	uint64_t		present;	/* KCG_HOTSPOT_LOGON_* bits */
+	const char		*username;
+	unsigned int		username_len;
+	const char		*password;
+	unsigned int		password_len;
+	const char		*encrypt_method;
+	unsigned int		encrypt_method_len;
+	const char		*heart_bt_int;
+	unsigned int		heart_bt_int_len;
+	const char		*reset_seq_num_flag;
+	unsigned int		reset_seq_num_flag_len;
+};
+
+#define KCG_HOTSPOT_LOGON_USERNAME	(1ULL << 0)
+#define KCG_HOTSPOT_LOGON_PASSWORD	(1ULL << 1)
+#define KCG_HOTSPOT_LOGON_ENCRYPT_METHOD	(1ULL << 2)
+#define KCG_HOTSPOT_LOGON_HEART_BT_INT	(1ULL << 3)
+#define KCG_HOTSPOT_LOGON_RESET_SEQ_NUM_FLAG	(1ULL << 4)
+
+int kcg_hotspot_logon_parse(struct kcg_hotspot_logon *self, struct fix_message *msg);
+
+/* HeartBeat (MsgType 0), see kcg_hotspot_heart_beat_parse() */
+struct kcg_hotspot_heart_beat {
+	uint64_t		present;	/* KCG_HOTSPOT_HEART_BEAT_* bits */
+	const char		*test_req_id;
+	unsigned int		test_req_id_len;
+};
+
+#define KCG_HOTSPOT_HEART_BEAT_TEST_REQ_ID	(1ULL << 0)
+
+int kcg_hotspot_heart_beat_parse(struct kcg_hotspot_heart_beat *self, struct fix_message *msg);
+
+/* TestRequest (MsgType 1), see kcg_hotspot_test_request_parse() */
+struct kcg_hotspot_test_request {
+	uint64_t		present;	/* KCG_HOTSPOT_TEST_REQUEST_* bits */
+	const char		*test_req_id;
+	unsigned int		test_req_id_len;
+};
+
+#define KCG_HOTSPOT_TEST_REQUEST_TEST_REQ_ID	(1ULL << 0)
+
+int kcg_hotspot_test_request_parse(struct kcg_hotspot_test_request *self, struct fix_message *msg);
+
+/* ResendRequest (MsgType 2), see kcg_hotspot_resend_request_parse() */
+struct kcg_hotspot_resend_request {
+	uint64_t		present;	/* KCG_HOTSPOT_RESEND_REQUEST_* bits */
+	const char		*begin_seq_no;
+	unsigned int		begin_seq_no_len;
+	const char		*end_seq_no;
+	unsigned int		end_seq_no_len;
+};
+
+#define KCG_HOTSPOT_RESEND_REQUEST_BEGIN_SEQ_NO	(1ULL << 0)
+#define KCG_HOTSPOT_RESEND_REQUEST_END_SEQ_NO	(1ULL << 1)
+
+int kcg_hotspot_resend_request_parse(struct kcg_hotspot_resend_request *self, struct fix_message *msg);
+
+/* Reject (MsgType 3), see kcg_hotspot_reject_parse() */
+struct kcg_hotspot_reject {
+	uint64_t		present;	/* KCG_HOTSPOT_REJECT_* bits */
+	const char		*ref_seq_num;
+	unsigned int		ref_seq_num_len;
+	const char		*ref_tag_id;
+	unsigned int		ref_tag_id_len;
+	const char		*ref_msg_type;
+	unsigned int		ref_msg_type_len;
+	const char		*session_reject_reason;
+	unsigned int		session_reject_reason_len;
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define KCG_HOTSPOT_REJECT_REF_SEQ_NUM	(1ULL << 0)
+#define KCG_HOTSPOT_REJECT_REF_TAG_ID	(1ULL << 1)
+#define KCG_HOTSPOT_REJECT_REF_MSG_TYPE	(1ULL << 2)
+#define KCG_HOTSPOT_REJECT_SESSION_REJECT_REASON	(1ULL << 3)
+#define KCG_HOTSPOT_REJECT_TEXT	(1ULL << 4)
+
+int kcg_hotspot_reject_parse(struct kcg_hotspot_reject *self, struct fix_message *msg);
+
+/* SequenceReset (MsgType 4), see kcg_hotspot_sequence_reset_parse() */
+struct kcg_hotspot_sequence_reset {
+	uint64_t		present;	/* KCG_HOTSPOT_SEQUENCE_RESET_* bits */
+	const char		*new_seq_no;
+	unsigned int		new_seq_no_len;
+	const char		*gap_fill_flag;
+	unsigned int		gap_fill_flag_len;
+};
+
+#define KCG_HOTSPOT_SEQUENCE_RESET_NEW_SEQ_NO	(1ULL << 0)
+#define KCG_HOTSPOT_SEQUENCE_RESET_GAP_FILL_FLAG	(1ULL << 1)
+
+int kcg_hotspot_sequence_reset_parse(struct kcg_hotspot_sequence_reset *self, struct fix_message *msg);
+
+/* Logout (MsgType 5), see kcg_hotspot_logout_parse() */
+struct kcg_hotspot_logout {
+	uint64_t		present;	/* KCG_HOTSPOT_LOGOUT_* bits */
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define KCG_HOTSPOT_LOGOUT_TEXT	(1ULL << 0)
+
+int kcg_hotspot_logout_parse(struct kcg_hotspot_logout *self, struct fix_message *msg);
+
+/* NewOrderSingle (MsgType D), see kcg_hotspot_new_order_single_parse() */
+struct kcg_hotspot_new_order_single {
+	uint64_t		present;	/* KCG_HOTSPOT_NEW_ORDER_SINGLE_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*exec_inst;
+	unsigned int		exec_inst_len;
+	const char		*handl_inst;
+	unsigned int		handl_inst_len;
+	const char		*currency;
+	unsigned int		currency_len;
+	const char		*order_qty;
+	unsigned int		order_qty_len;
+	const char		*max_show;
+	unsigned int		max_show_len;
+	const char		*min_qty;
+	unsigned int		min_qty_len;
+	const char		*price;
+	unsigned int		price_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*ord_type;
+	unsigned int		ord_type_len;
+	const char		*time_in_force;
+	unsigned int		time_in_force_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	const char		*peg_difference;
+	unsigned int		peg_difference_len;
+};
+
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_ACCOUNT	(1ULL << 0)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_CL_ORD_ID	(1ULL << 1)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_EXEC_INST	(1ULL << 2)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_HANDL_INST	(1ULL << 3)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_CURRENCY	(1ULL << 4)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_ORDER_QTY	(1ULL << 5)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_MAX_SHOW	(1ULL << 6)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_MIN_QTY	(1ULL << 7)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_PRICE	(1ULL << 8)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_SIDE	(1ULL << 9)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_SYMBOL	(1ULL << 10)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_ORD_TYPE	(1ULL << 11)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_TIME_IN_FORCE	(1ULL << 12)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_TRANSACT_TIME	(1ULL << 13)
+#define KCG_HOTSPOT_NEW_ORDER_SINGLE_PEG_DIFFERENCE	(1ULL << 14)
+
+int kcg_hotspot_new_order_single_parse(struct kcg_hotspot_new_order_single *self, struct fix_message *msg);
+
+/* ExecutionReport (MsgType 8), see kcg_hotspot_execution_report_parse() */
+struct kcg_hotspot_execution_report {
+	uint64_t		present;	/* KCG_HOTSPOT_EXECUTION_REPORT_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*exec_id;
+	unsigned int		exec_id_len;
+	const char		*exec_inst;
+	unsigned int		exec_inst_len;
+	const char		*exec_trans_type;
+	unsigned int		exec_trans_type_len;
+	const char		*order_id;
+	unsigned int		order_id_len;
+	const char		*ord_status;
+	unsigned int		ord_status_len;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	const char		*order_qty;
+	unsigned int		order_qty_len;
+	const char		*price;
+	unsigned int		price_len;
+	const char		*time_in_force;
+	unsigned int		time_in_force_len;
+	const char		*currency;
+	unsigned int		currency_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*exec_broker;
+	unsigned int		exec_broker_len;
+	const char		*leaves_qty;
+	unsigned int		leaves_qty_len;
+	const char		*cum_qty;
+	unsigned int		cum_qty_len;
+	const char		*min_qty;
+	unsigned int		min_qty_len;
+	const char		*order_qty2;
+	unsigned int		order_qty2_len;
+	const char		*fut_setl_date;
+	unsigned int		fut_setl_date_len;
+	const char		*trade_date;
+	unsigned int		trade_date_len;
+	const char		*settl_curr_amount;
+	unsigned int		settl_curr_amount_len;
+	const char		*settle_currency;
+	unsigned int		settle_currency_len;
+	const char		*security_type;
+	unsigned int		security_type_len;
+	const char		*max_show;
+	unsigned int		max_show_len;
+	const char		*exec_type;
+	unsigned int		exec_type_len;
+	const char		*last_shares;
+	unsigned int		last_shares_len;
+	const char		*last_px;
+	unsigned int		last_px_len;
+	const char		*no_contra_brokers;
+	unsigned int		no_contra_brokers_len;
+	const char		*contra_broker;
+	unsigned int		contra_broker_len;
+	const char		*text;
+	unsigned int		text_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+};
+
+#define KCG_HOTSPOT_EXECUTION_REPORT_ACCOUNT	(1ULL << 0)
+#define KCG_HOTSPOT_EXECUTION_REPORT_CL_ORD_ID	(1ULL << 1)
+#define KCG_HOTSPOT_EXECUTION_REPORT_EXEC_ID	(1ULL << 2)
+#define KCG_HOTSPOT_EXECUTION_REPORT_EXEC_INST	(1ULL << 3)
+#define KCG_HOTSPOT_EXECUTION_REPORT_EXEC_TRANS_TYPE	(1ULL << 4)
+#define KCG_HOTSPOT_EXECUTION_REPORT_ORDER_ID	(1ULL << 5)
+#define KCG_HOTSPOT_EXECUTION_REPORT_ORD_STATUS	(1ULL << 6)
+#define KCG_HOTSPOT_EXECUTION_REPORT_ORIG_CL_ORD_ID	(1ULL << 7)
+#define KCG_HOTSPOT_EXECUTION_REPORT_ORDER_QTY	(1ULL << 8)
+#define KCG_HOTSPOT_EXECUTION_REPORT_PRICE	(1ULL << 9)
+#define KCG_HOTSPOT_EXECUTION_REPORT_TIME_IN_FORCE	(1ULL << 10)
+#define KCG_HOTSPOT_EXECUTION_REPORT_CURRENCY	(1ULL << 11)
+#define KCG_HOTSPOT_EXECUTION_REPORT_SIDE	(1ULL << 12)
+#define KCG_HOTSPOT_EXECUTION_REPORT_SYMBOL	(1ULL << 13)
+#define KCG_HOTSPOT_EXECUTION_REPORT_EXEC_BROKER	(1ULL << 14)
+#define KCG_HOTSPOT_EXECUTION_REPORT_LEAVES_QTY	(1ULL << 15)
+#define KCG_HOTSPOT_EXECUTION_REPORT_CUM_QTY	(1ULL << 16)
+#define KCG_HOTSPOT_EXECUTION_REPORT_MIN_QTY	(1ULL << 17)
+#define KCG_HOTSPOT_EXECUTION_REPORT_ORDER_QTY2	(1ULL << 18)
+#define KCG_HOTSPOT_EXECUTION_REPORT_FUT_SETL_DATE	(1ULL << 19)
+#define KCG_HOTSPOT_EXECUTION_REPORT_TRADE_DATE	(1ULL << 20)
+#define KCG_HOTSPOT_EXECUTION_REPORT_SETTL_CURR_AMOUNT	(1ULL << 21)
+#define KCG_HOTSPOT_EXECUTION_REPORT_SETTLE_CURRENCY	(1ULL << 22)
+#define KCG_HOTSPOT_EXECUTION_REPORT_SECURITY_TYPE	(1ULL << 23)
+#define KCG_HOTSPOT_EXECUTION_REPORT_MAX_SHOW	(1ULL << 24)
+#define KCG_HOTSPOT_EXECUTION_REPORT_EXEC_TYPE	(1ULL << 25)
+#define KCG_HOTSPOT_EXECUTION_REPORT_LAST_SHARES	(1ULL << 26)
+#define KCG_HOTSPOT_EXECUTION_REPORT_LAST_PX	(1ULL << 27)
+#define KCG_HOTSPOT_EXECUTION_REPORT_NO_CONTRA_BROKERS	(1ULL << 28)
+#define KCG_HOTSPOT_EXECUTION_REPORT_CONTRA_BROKER	(1ULL << 29)
+#define KCG_HOTSPOT_EXECUTION_REPORT_TEXT	(1ULL << 30)
+#define KCG_HOTSPOT_EXECUTION_REPORT_TRANSACT_TIME	(1ULL << 31)
+
+int kcg_hotspot_execution_report_parse(struct kcg_hotspot_execution_report *self, struct fix_message *msg);
+
+/* OrderCancelRequest (MsgType F), see kcg_hotspot_order_cancel_request_parse() */
+struct kcg_hotspot_order_cancel_request {
+	uint64_t		present;	/* KCG_HOTSPOT_ORDER_CANCEL_REQUEST_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	const char		*currency;
+	unsigned int		currency_len;
+};
+
+#define KCG_HOTSPOT_ORDER_CANCEL_REQUEST_ACCOUNT	(1ULL << 0)
+#define KCG_HOTSPOT_ORDER_CANCEL_REQUEST_CL_ORD_ID	(1ULL << 1)
+#define KCG_HOTSPOT_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID	(1ULL << 2)
+#define KCG_HOTSPOT_ORDER_CANCEL_REQUEST_SYMBOL	(1ULL << 3)
+#define KCG_HOTSPOT_ORDER_CANCEL_REQUEST_SIDE	(1ULL << 4)
+#define KCG_HOTSPOT_ORDER_CANCEL_REQUEST_TRANSACT_TIME	(1ULL << 5)
+#define KCG_HOTSPOT_ORDER_CANCEL_REQUEST_CURRENCY	(1ULL << 6)
+
+int kcg_hotspot_order_cancel_request_parse(struct kcg_hotspot_order_cancel_request *self, struct fix_message *msg);
+
+/* OrderCancelReplaceRequest (MsgType G), see kcg_hotspot_order_cancel_replace_request_parse() */
+struct kcg_hotspot_order_cancel_replace_request {
+	uint64_t		present;	/* KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	const char		*handl_inst;
+	unsigned int		handl_inst_len;
+	const char		*order_qty;
+	unsigned int		order_qty_len;
+	const char		*max_show;
+	unsigned int		max_show_len;
+	const char		*min_qty;
+	unsigned int		min_qty_len;
+	const char		*price;
+	unsigned int		price_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*ord_type;
+	unsigned int		ord_type_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+};
+
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT	(1ULL << 0)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID	(1ULL << 1)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID	(1ULL << 2)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST	(1ULL << 3)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY	(1ULL << 4)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW	(1ULL << 5)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_MIN_QTY	(1ULL << 6)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_PRICE	(1ULL << 7)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL	(1ULL << 8)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE	(1ULL << 9)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_SIDE	(1ULL << 10)
+#define KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME	(1ULL << 11)
+
+int kcg_hotspot_order_cancel_replace_request_parse(struct kcg_hotspot_order_cancel_replace_request *self, struct fix_message *msg);
+
+/* OrderCancelReject (MsgType 9), see kcg_hotspot_order_cancel_reject_parse() */
+struct kcg_hotspot_order_cancel_reject {
+	uint64_t		present;	/* KCG_HOTSPOT_ORDER_CANCEL_REJECT_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*order_id;
+	unsigned int		order_id_len;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*cxl_rej_response_to;
+	unsigned int		cxl_rej_response_to_len;
+	const char		*cxl_rej_reason;
+	unsigned int		cxl_rej_reason_len;
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_ACCOUNT	(1ULL << 0)
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_CL_ORD_ID	(1ULL << 1)
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_ORDER_ID	(1ULL << 2)
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID	(1ULL << 3)
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_SYMBOL	(1ULL << 4)
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_CXL_REJ_RESPONSE_TO	(1ULL << 5)
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_CXL_REJ_REASON	(1ULL << 6)
+#define KCG_HOTSPOT_ORDER_CANCEL_REJECT_TEXT	(1ULL << 7)
+
+int kcg_hotspot_order_cancel_reject_parse(struct kcg_hotspot_order_cancel_reject *self, struct fix_message *msg);
+
+/* OrderStatusRequest (MsgType H), see kcg_hotspot_order_status_request_parse() */
+struct kcg_hotspot_order_status_request {
+	uint64_t		present;	/* KCG_HOTSPOT_ORDER_STATUS_REQUEST_* bits */
+	const char		*account;
+	unsigned int		account_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+};
+
+#define KCG_HOTSPOT_ORDER_STATUS_REQUEST_ACCOUNT	(1ULL << 0)
+#define KCG_HOTSPOT_ORDER_STATUS_REQUEST_CL_ORD_ID	(1ULL << 1)
+#define KCG_HOTSPOT_ORDER_STATUS_REQUEST_SYMBOL	(1ULL << 2)
+#define KCG_HOTSPOT_ORDER_STATUS_REQUEST_SIDE	(1ULL << 3)
+#define KCG_HOTSPOT_ORDER_STATUS_REQUEST_TRANSACT_TIME	(1ULL << 4)
+
+int kcg_hotspot_order_status_request_parse(struct kcg_hotspot_order_status_request *self, struct fix_message *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTRADING_KCG_HOTSPOT_FIX_H */
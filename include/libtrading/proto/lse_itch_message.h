@@ -166,6 +166,7 @@ struct lse_itch_snapshot_complete {
 	u8			Flags;
 } __attribute__((packed));
 
+struct lse_itch_message *lse_itch_message_view(struct buffer *buf);
 int lse_itch_message_decode(struct buffer *buf, struct lse_itch_message *msg);
 
 #ifdef __cplusplus
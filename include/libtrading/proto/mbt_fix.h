@@ -0,0 +1,111 @@
+#ifndef LIBTRADING_MBT_FIX_H
+#define LIBTRADING_MBT_FIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/proto/fix_session.h"
+
+extern struct fix_dialect mbt_fix_dialect;
+
+enum mbt_fix_tag {
+	MBT_TAG_SenderCompID = 49,
+	MBT_TAG_SendingTime = 52,
+	MBT_TAG_TargetCompID = 56,
+	MBT_TAG_CheckSum = 10,
+	MBT_TAG_PossDupFlag = 43,
+	MBT_TAG_EncryptMethod = 98,
+	MBT_TAG_OnBehalfOfSubID = 116,
+	MBT_TAG_DeliverToSubID = 129,
+	MBT_TAG_ResetSeqNumFlag = 141,
+	MBT_TAG_SenderLocationID = 142,
+	MBT_TAG_MessageEncoding = 347,
+	MBT_TAG_Password = 554,
+	MBT_TAG_LiquidityTag = 9730,
+	MBT_TAG_PosPendBuy = 10000,
+	MBT_TAG_PosPendSell = 10001,
+	MBT_TAG_MorningBuyingPower = 10002,
+	MBT_TAG_PosBuyPowerUsed = 10003,
+	MBT_TAG_PosRealizedPNL = 10004,
+	MBT_TAG_MBTAccountType = 10005,
+	MBT_TAG_OvernightBuyingPower = 10006,
+	MBT_TAG_RealizedPnL = 10008,
+	MBT_TAG_MorningAccountValue = 10009,
+	MBT_TAG_MorningExcessEquity = 10010,
+	MBT_TAG_PosEquityUsed = 10015,
+	MBT_TAG_MBTInternalOrderId = 10017,
+	MBT_TAG_AccountCredit = 10018,
+	MBT_TAG_MBTXAggressive = 10022,
+	MBT_TAG_AccBasedPermsBitMap = 10024,
+	MBT_TAG_MorningExcessEquity2 = 10040,
+	MBT_TAG_OptionStrategyCode = 10047,
+	MBT_TAG_OvernightExcess = 10048,
+	MBT_TAG_BODOOvernightExcessEq = 10050,
+	MBT_TAG_OrderGroupID1 = 10055,
+	MBT_TAG_UserQuote = 10059,
+	MBT_TAG_PosRunAvgPrice = 10060,
+	MBT_TAG_MultiSymbol = 10065,
+	MBT_TAG_MultiPrice = 10066,
+	MBT_TAG_MBTMultifunction = 10068,
+	MBT_TAG_TodayRealizedPNL2 = 10069,
+	MBT_TAG_UserRoutePerm = 10071,
+	MBT_TAG_TriggerFromOrderID = 10073,
+	MBT_TAG_CompanyID = 10076,
+	MBT_TAG_AccountBank = 10077,
+	MBT_TAG_AccountBranch = 10078,
+	MBT_TAG_FLID = 10401,
+	MBT_TAG_UserSessionID = 10402,
+};
+
+/* Logon (MsgType A), see mbt_logon_parse() */
+struct mbt_logon {
+	uint64_t		present;	/* MBT_LOGON_* bits */
+	const char		*encrypt_method;
+	unsigned int		encrypt_method_len;
+	const char		*reset_seq_num_flag;
+	unsigned int		reset_seq_num_flag_len;
+	const char		*message_encoding;
+	unsigned int		message_encoding_len;
+	const char		*password;
+	unsigned int		password_len;
+};
+
+#define MBT_LOGON_ENCRYPT_METHOD	(1ULL << 0)
+#define MBT_LOGON_RESET_SEQ_NUM_FLAG	(1ULL << 1)
+#define MBT_LOGON_MESSAGE_ENCODING	(1ULL << 2)
+#define MBT_LOGON_PASSWORD	(1ULL << 3)
+
+int mbt_logon_parse(struct mbt_logon *self, struct fix_message *msg);
+
+/* NewOrderSingle (MsgType D), see mbt_new_order_single_parse() */
+struct mbt_new_order_single {
+	uint64_t		present;	/* MBT_NEW_ORDER_SINGLE_* bits */
+	const char		*sending_time;
+	unsigned int		sending_time_len;
+	const char		*mbtx_aggressive;
+	unsigned int		mbtx_aggressive_len;
+	const char		*multi_symbol;
+	unsigned int		multi_symbol_len;
+	const char		*multi_price;
+	unsigned int		multi_price_len;
+	const char		*mbt_multifunction;
+	unsigned int		mbt_multifunction_len;
+	const char		*trigger_from_order_id;
+	unsigned int		trigger_from_order_id_len;
+};
+
+#define MBT_NEW_ORDER_SINGLE_SENDING_TIME	(1ULL << 0)
+#define MBT_NEW_ORDER_SINGLE_MBTX_AGGRESSIVE	(1ULL << 1)
+#define MBT_NEW_ORDER_SINGLE_MULTI_SYMBOL	(1ULL << 2)
+#define MBT_NEW_ORDER_SINGLE_MULTI_PRICE	(1ULL << 3)
+#define MBT_NEW_ORDER_SINGLE_MBT_MULTIFUNCTION	(1ULL << 4)
+#define MBT_NEW_ORDER_SINGLE_TRIGGER_FROM_ORDER_ID	(1ULL << 5)
+
+int mbt_new_order_single_parse(struct mbt_new_order_single *self, struct fix_message *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTRADING_MBT_FIX_H */
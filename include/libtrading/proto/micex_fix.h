@@ -0,0 +1,276 @@
+#ifndef LIBTRADING_MICEX_FIX_H
+#define LIBTRADING_MICEX_FIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/proto/fix_session.h"
+
+extern struct fix_dialect micex_fix_dialect;
+
+enum micex_fix_tag {
+	MICEX_TAG_BeginString = 8,
+	MICEX_TAG_BodyLength = 9,
+	MICEX_TAG_MsgType = 35,
+	MICEX_TAG_SenderCompID = 49,
+	MICEX_TAG_TargetCompID = 56,
+	MICEX_TAG_MsgSeqNum = 34,
+	MICEX_TAG_PossDupFlag = 43,
+	MICEX_TAG_PossResend = 97,
+	MICEX_TAG_SendingTime = 52,
+	MICEX_TAG_OrigSendingTime = 122,
+	MICEX_TAG_CheckSum = 10,
+	MICEX_TAG_Symbol = 55,
+	MICEX_TAG_Product = 460,
+	MICEX_TAG_CFICode = 461,
+	MICEX_TAG_SecurityType = 167,
+	MICEX_TAG_Yield = 236,
+	MICEX_TAG_NoPartyID = 453,
+	MICEX_TAG_PartyID = 448,
+	MICEX_TAG_PartyIDSource = 447,
+	MICEX_TAG_PartyRole = 452,
+	MICEX_TAG_Commission = 12,
+	MICEX_TAG_CommType = 13,
+	MICEX_TAG_OrderQty = 38,
+	MICEX_TAG_CashOrderQty = 152,
+	MICEX_TAG_NoTrdRegTimestamps = 768,
+	MICEX_TAG_TrdRegTimestamp = 769,
+	MICEX_TAG_TrdRegTimestampType = 770,
+	MICEX_TAG_StartDate = 916,
+	MICEX_TAG_EndDate = 917,
+	MICEX_TAG_DeliveryType = 919,
+	MICEX_TAG_UnderlyingSymbol = 311,
+	MICEX_TAG_NoUnderlyingStips = 887,
+	MICEX_TAG_UnderlyingStipType = 888,
+	MICEX_TAG_UnderlyingStipValue = 889,
+	MICEX_TAG_EncryptMethod = 98,
+	MICEX_TAG_HeartBtInt = 108,
+	MICEX_TAG_ResetSeqNumFlag = 141,
+	MICEX_TAG_Password = 554,
+	MICEX_TAG_NewPassword = 925,
+	MICEX_TAG_SessionStatus = 1409,
+	MICEX_TAG_CancelOnDisconnect = 6867,
+	MICEX_TAG_Text = 58,
+	MICEX_TAG_TestReqID = 112,
+	MICEX_TAG_BeginSeqNo = 7,
+	MICEX_TAG_EndSeqNo = 16,
+	MICEX_TAG_GapFillFlag = 123,
+	MICEX_TAG_NewSeqNo = 36,
+	MICEX_TAG_RefSeqNum = 45,
+	MICEX_TAG_RefTagID = 371,
+	MICEX_TAG_RefMsgType = 372,
+	MICEX_TAG_SessionRejectReason = 373,
+	MICEX_TAG_OrderID = 37,
+	MICEX_TAG_ClOrdID = 11,
+	MICEX_TAG_Account = 1,
+	MICEX_TAG_MaxFloor = 111,
+	MICEX_TAG_SecondaryClOrdID = 526,
+	MICEX_TAG_NoTradingSessions = 386,
+	MICEX_TAG_TradingSessionID = 336,
+	MICEX_TAG_Side = 54,
+	MICEX_TAG_TransactTime = 60,
+	MICEX_TAG_OrdType = 40,
+	MICEX_TAG_PriceType = 423,
+	MICEX_TAG_Price = 44,
+	MICEX_TAG_TradeThruTime = 5202,
+	MICEX_TAG_TimeInForce = 59,
+	MICEX_TAG_EffectiveTime = 168,
+	MICEX_TAG_OrderCapacity = 528,
+	MICEX_TAG_OrderRestrictions = 529,
+	MICEX_TAG_MaxPriceLevels = 1090,
+	MICEX_TAG_OrigClOrdID = 41,
+	MICEX_TAG_CancelOrigOnReject = 9619,
+	MICEX_TAG_MassCancelRequestType = 530,
+	MICEX_TAG_UnsolicitedIndicator = 325,
+	MICEX_TAG_TradSesStatus = 340,
+	MICEX_TAG_ExecID = 17,
+	MICEX_TAG_ExecType = 150,
+	MICEX_TAG_OrdStatus = 39,
+	MICEX_TAG_WorkingIndicator = 636,
+	MICEX_TAG_OrdRejReason = 103,
+	MICEX_TAG_ExecRestatementReason = 378,
+	MICEX_TAG_SettDate = 64,
+	MICEX_TAG_OptionSettDate = 5020,
+	MICEX_TAG_LastQty = 32,
+	MICEX_TAG_LastPx = 31,
+	MICEX_TAG_TradingSessionSubID = 625,
+	MICEX_TAG_LeavesQty = 151,
+	MICEX_TAG_CumQty = 14,
+	MICEX_TAG_AvgPx = 6,
+	MICEX_TAG_OrigTime = 9412,
+	MICEX_TAG_StipulationValue = 6636,
+	MICEX_TAG_CurrencyCode = 6029,
+	MICEX_TAG_InstitutionID = 5155,
+	MICEX_TAG_CoverID = 7695,
+	MICEX_TAG_ClientAccID = 7693,
+	MICEX_TAG_TradeIssueDate = 9173,
+	MICEX_TAG_OrigOrderID = 9945,
+	MICEX_TAG_AccruedInterestAmt = 159,
+	MICEX_TAG_NoMiscFees = 136,
+	MICEX_TAG_MiscFeeAmt = 137,
+	MICEX_TAG_MiscFeeType = 139,
+	MICEX_TAG_MDEntryID = 278,
+	MICEX_TAG_MassCancelResponse = 531,
+	MICEX_TAG_MassCancelRejectReason = 532,
+	MICEX_TAG_CxlRejResponseTo = 434,
+	MICEX_TAG_CxlRejReason = 102,
+	MICEX_TAG_TradeReportID = 571,
+	MICEX_TAG_TrdType = 828,
+	MICEX_TAG_TrdSubType = 829,
+	MICEX_TAG_SecondaryTradeReportID = 818,
+	MICEX_TAG_PreviouslyReported = 570,
+	MICEX_TAG_NoUnderlyings = 711,
+	MICEX_TAG_CalculatedCcyLastQty = 1056,
+	MICEX_TAG_TradeDate = 75,
+	MICEX_TAG_SettlType = 63,
+	MICEX_TAG_OptionSettlType = 5459,
+	MICEX_TAG_NoSides = 552,
+	MICEX_TAG_GrossTradeAmt = 381,
+	MICEX_TAG_EndAccruedInterestAmt = 920,
+	MICEX_TAG_StartCash = 921,
+	MICEX_TAG_EndCash = 922,
+	MICEX_TAG_SettlInstID = 162,
+	MICEX_TAG_Price2 = 640,
+	MICEX_TAG_ClearingStatus = 5440,
+	MICEX_TAG_ClearingRefNo = 5934,
+	MICEX_TAG_ClearingHandlingType = 9938,
+	MICEX_TAG_OperationType = 10103,
+	MICEX_TAG_Price1 = 10104,
+	MICEX_TAG_CurrentRepoValue = 10105,
+	MICEX_TAG_CurrentRepoBackValue = 10106,
+	MICEX_TAG_TradeBalance = 10110,
+	MICEX_TAG_TotalAmount = 10111,
+	MICEX_TAG_LastCouponPaymentValue = 10117,
+	MICEX_TAG_LastCouponPaymentDate = 10118,
+	MICEX_TAG_LastPrincipalPaymentValue = 10119,
+	MICEX_TAG_LastPrincipalPaymentDate = 10120,
+	MICEX_TAG_ExpectedDiscount = 10121,
+	MICEX_TAG_ExpectedQty = 10122,
+	MICEX_TAG_ExpectedRepoValue = 10123,
+	MICEX_TAG_ExpectedRepoBackValue = 10124,
+	MICEX_TAG_ExpectedReturnValue = 10125,
+	MICEX_TAG_PreciseBalance = 10126,
+};
+
+/* NewOrderSingle (MsgType D), see micex_new_order_single_parse() */
+struct micex_new_order_single {
+	uint64_t		present;	/* MICEX_NEW_ORDER_SINGLE_* bits */
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	int64_t			no_party_id;
+	const char		*account;
+	unsigned int		account_len;
+	double			max_floor;
+	const char		*secondary_cl_ord_id;
+	unsigned int		secondary_cl_ord_id_len;
+	const char		*trading_session_id;
+	unsigned int		trading_session_id_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*side;
+	unsigned int		side_len;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	double			order_qty;
+	const char		*ord_type;
+	unsigned int		ord_type_len;
+	int64_t			price_type;
+	double			price;
+	const char		*time_in_force;
+	unsigned int		time_in_force_len;
+	const char		*order_capacity;
+	unsigned int		order_capacity_len;
+};
+
+#define MICEX_NEW_ORDER_SINGLE_CL_ORD_ID	(1ULL << 0)
+#define MICEX_NEW_ORDER_SINGLE_NO_PARTY_ID	(1ULL << 1)
+#define MICEX_NEW_ORDER_SINGLE_ACCOUNT	(1ULL << 2)
+#define MICEX_NEW_ORDER_SINGLE_MAX_FLOOR	(1ULL << 3)
+#define MICEX_NEW_ORDER_SINGLE_SECONDARY_CL_ORD_ID	(1ULL << 4)
+#define MICEX_NEW_ORDER_SINGLE_TRADING_SESSION_ID	(1ULL << 5)
+#define MICEX_NEW_ORDER_SINGLE_SYMBOL	(1ULL << 6)
+#define MICEX_NEW_ORDER_SINGLE_SIDE	(1ULL << 7)
+#define MICEX_NEW_ORDER_SINGLE_TRANSACT_TIME	(1ULL << 8)
+#define MICEX_NEW_ORDER_SINGLE_ORDER_QTY	(1ULL << 9)
+#define MICEX_NEW_ORDER_SINGLE_ORD_TYPE	(1ULL << 10)
+#define MICEX_NEW_ORDER_SINGLE_PRICE_TYPE	(1ULL << 11)
+#define MICEX_NEW_ORDER_SINGLE_PRICE	(1ULL << 12)
+#define MICEX_NEW_ORDER_SINGLE_TIME_IN_FORCE	(1ULL << 13)
+#define MICEX_NEW_ORDER_SINGLE_ORDER_CAPACITY	(1ULL << 14)
+
+int micex_new_order_single_parse(struct micex_new_order_single *self, struct fix_message *msg);
+
+/* ExecutionReport (MsgType 8), see micex_execution_report_parse() */
+struct micex_execution_report {
+	uint64_t		present;	/* MICEX_EXECUTION_REPORT_* bits */
+	const char		*order_id;
+	unsigned int		order_id_len;
+	const char		*secondary_cl_ord_id;
+	unsigned int		secondary_cl_ord_id_len;
+	const char		*cl_ord_id;
+	unsigned int		cl_ord_id_len;
+	const char		*orig_cl_ord_id;
+	unsigned int		orig_cl_ord_id_len;
+	int64_t			no_party_id;
+	const char		*exec_id;
+	unsigned int		exec_id_len;
+	const char		*exec_type;
+	unsigned int		exec_type_len;
+	const char		*ord_status;
+	unsigned int		ord_status_len;
+	int64_t			ord_rej_reason;
+	const char		*account;
+	unsigned int		account_len;
+	const char		*symbol;
+	unsigned int		symbol_len;
+	const char		*side;
+	unsigned int		side_len;
+	double			order_qty;
+	const char		*ord_type;
+	unsigned int		ord_type_len;
+	double			price;
+	double			last_qty;
+	double			last_px;
+	const char		*trading_session_id;
+	unsigned int		trading_session_id_len;
+	double			leaves_qty;
+	double			cum_qty;
+	double			avg_px;
+	const char		*transact_time;
+	unsigned int		transact_time_len;
+	const char		*text;
+	unsigned int		text_len;
+};
+
+#define MICEX_EXECUTION_REPORT_ORDER_ID	(1ULL << 0)
+#define MICEX_EXECUTION_REPORT_SECONDARY_CL_ORD_ID	(1ULL << 1)
+#define MICEX_EXECUTION_REPORT_CL_ORD_ID	(1ULL << 2)
+#define MICEX_EXECUTION_REPORT_ORIG_CL_ORD_ID	(1ULL << 3)
+#define MICEX_EXECUTION_REPORT_NO_PARTY_ID	(1ULL << 4)
+#define MICEX_EXECUTION_REPORT_EXEC_ID	(1ULL << 5)
+#define MICEX_EXECUTION_REPORT_EXEC_TYPE	(1ULL << 6)
+#define MICEX_EXECUTION_REPORT_ORD_STATUS	(1ULL << 7)
+#define MICEX_EXECUTION_REPORT_ORD_REJ_REASON	(1ULL << 8)
+#define MICEX_EXECUTION_REPORT_ACCOUNT	(1ULL << 9)
+#define MICEX_EXECUTION_REPORT_SYMBOL	(1ULL << 10)
+#define MICEX_EXECUTION_REPORT_SIDE	(1ULL << 11)
+#define MICEX_EXECUTION_REPORT_ORDER_QTY	(1ULL << 12)
+#define MICEX_EXECUTION_REPORT_ORD_TYPE	(1ULL << 13)
+#define MICEX_EXECUTION_REPORT_PRICE	(1ULL << 14)
+#define MICEX_EXECUTION_REPORT_LAST_QTY	(1ULL << 15)
+#define MICEX_EXECUTION_REPORT_LAST_PX	(1ULL << 16)
+#define MICEX_EXECUTION_REPORT_TRADING_SESSION_ID	(1ULL << 17)
+#define MICEX_EXECUTION_REPORT_LEAVES_QTY	(1ULL << 18)
+#define MICEX_EXECUTION_REPORT_CUM_QTY	(1ULL << 19)
+#define MICEX_EXECUTION_REPORT_AVG_PX	(1ULL << 20)
+#define MICEX_EXECUTION_REPORT_TRANSACT_TIME	(1ULL << 21)
+#define MICEX_EXECUTION_REPORT_TEXT	(1ULL << 22)
+
+int micex_execution_report_parse(struct micex_execution_report *self, struct fix_message *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTRADING_MICEX_FIX_H */
@@ -111,6 +111,11 @@ struct soupbin3_session {
 
 struct soupbin3_session *soupbin3_session_new(int sockfd);
 void soupbin3_session_delete(struct soupbin3_session *session);
+/*
+ * Returns the next packet in place in the receive buffer, reading more from
+ * the socket as needed. The packet is valid until the next receive call.
+ */
+struct soupbin3_packet *soupbin3_session_recv_view(struct soupbin3_session *session);
 int soupbin3_session_recv(struct soupbin3_session *session, struct soupbin3_packet *packet);
 
 #ifdef __cplusplus
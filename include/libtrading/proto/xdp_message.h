@@ -210,6 +210,7 @@ struct xdp_msg_imbalance {
 	le32			SSRFilingPrice;
 } __attribute__((packed));
 
+struct xdp_message *xdp_message_view(struct buffer *buf);
 int xdp_message_decode(struct buffer *buf, struct xdp_message *msg, size_t size);
 
 #ifdef __cplusplus
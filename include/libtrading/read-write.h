@@ -5,9 +5,15 @@
 extern "C" {
 #endif
 
+#include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/uio.h>
+#include <stdbool.h>
 #include <unistd.h>
+#include <time.h>
+
+/* Room for an SCM_TIMESTAMPING or SCM_TIMESTAMPNS control message. */
+#define RX_TIMESTAMP_CMSG_SPACE	CMSG_SPACE(3 * sizeof(struct timespec))
 
 typedef ssize_t (*io_recv_t)(int fd, void *buffer, size_t length, int flags);
 typedef ssize_t (*io_sendmsg_t)(int fd, struct iovec *iov, size_t length, int flags);
@@ -19,6 +25,9 @@ extern io_sendmsg_t io_sendmsg;
 
 size_t iov_byte_length(struct iovec *iov, size_t iov_len);
 
+int rx_timestamps_enable(int fd);
+bool rx_timestamp_get(struct msghdr *msg, struct timespec *ts);
+
 ssize_t xread(int fd, void *buf, size_t count);
 ssize_t xwrite(int fd, const void *buf, size_t count);
 ssize_t xwritev(int fd, const struct iovec *iov, int iovcnt);
@@ -0,0 +1,152 @@
+#ifndef LIBTRADING_SCAN_H
+#define LIBTRADING_SCAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libtrading/types.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+ * Delimiter scanning for the tag=value protocols. scan_byte() looks for
+ * the next delimiter 16 bytes at a time with SSE2, or 8 bytes at a time
+ * with SWAR on other targets. scan_bitmap() marks every occurrence of a
+ * delimiter in a range in one pass, with the widest kernel cpu_has()
+ * allows.
+ */
+
+#define SCAN_BITMAP_WORDS(len)	(((len) + 63) / 64)
+
+#define SWAR_ONES		0x0101010101010101ULL
+#define SWAR_LOWS		0x7f7f7f7f7f7f7f7fULL
+
+/* Sets the top bit of every zero byte in 'x' and clears all other bits. */
+static inline u64 swar_zero_bytes(u64 x)
+{
+	return ~(((x & SWAR_LOWS) + SWAR_LOWS) | x | SWAR_LOWS);
+}
+
+static inline const char *scan_byte_scalar(const char *p, const char *end, char c)
+{
+	for (; p < end; p++) {
+		if (*p == c)
+			return p;
+	}
+
+	return NULL;
+}
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+static inline const char *scan_byte_swar(const char *p, const char *end, char c)
+{
+	const u64 pattern = SWAR_ONES * (u8) c;
+
+	while (end - p >= 8) {
+		u64 x;
+
+		memcpy(&x, p, sizeof(x));
+
+		x = swar_zero_bytes(x ^ pattern);
+		if (x)
+			return p + (__builtin_ctzll(x) >> 3);
+
+		p += 8;
+	}
+
+	return scan_byte_scalar(p, end, c);
+}
+#endif
+
+static inline const char *scan_byte(const char *p, const char *end, char c)
+{
+#ifdef __SSE2__
+	const __m128i needle = _mm_set1_epi8(c);
+
+	while (end - p >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *) p);
+		int mask;
+
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, needle));
+		if (mask)
+			return p + __builtin_ctz(mask);
+
+		p += 16;
+	}
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	return scan_byte_swar(p, end, c);
+#endif
+	return scan_byte_scalar(p, end, c);
+}
+
+/*
+ * Return the delimiter bitmap of the first 'n' bytes of the 64-byte block
+ * at 'p' and add their sum to '*sum', loading each byte only once. All 64
+ * bytes must be readable; the ones past 'n' are ignored.
+ */
+static inline u64 scan_block_sum(const char *p, unsigned int n, char c, unsigned long *sum)
+{
+#ifdef __SSE2__
+	const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i needle = _mm_set1_epi8(c);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i v0, v1, v2, v3, acc;
+	u64 m0, m1, m2, m3;
+
+	v0 = _mm_loadu_si128((const __m128i *) (p +  0));
+	v1 = _mm_loadu_si128((const __m128i *) (p + 16));
+	v2 = _mm_loadu_si128((const __m128i *) (p + 32));
+	v3 = _mm_loadu_si128((const __m128i *) (p + 48));
+
+	if (n < 64) {
+		v0 = _mm_and_si128(v0, _mm_cmpgt_epi8(_mm_set1_epi8(n -  0), iota));
+		v1 = _mm_and_si128(v1, _mm_cmpgt_epi8(_mm_set1_epi8(n - 16), iota));
+		v2 = _mm_and_si128(v2, _mm_cmpgt_epi8(_mm_set1_epi8(n - 32), iota));
+		v3 = _mm_and_si128(v3, _mm_cmpgt_epi8(_mm_set1_epi8(n - 48), iota));
+	}
+
+	m0 = _mm_movemask_epi8(_mm_cmpeq_epi8(v0, needle));
+	m1 = _mm_movemask_epi8(_mm_cmpeq_epi8(v1, needle));
+	m2 = _mm_movemask_epi8(_mm_cmpeq_epi8(v2, needle));
+	m3 = _mm_movemask_epi8(_mm_cmpeq_epi8(v3, needle));
+
+	acc = _mm_add_epi64(_mm_add_epi64(_mm_sad_epu8(v0, zero), _mm_sad_epu8(v1, zero)),
+			    _mm_add_epi64(_mm_sad_epu8(v2, zero), _mm_sad_epu8(v3, zero)));
+
+	*sum += _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+
+	m0 |= (m1 << 16) | (m2 << 32) | (m3 << 48);
+
+	return n < 64 ? m0 & ((1ULL << n) - 1) : m0;
+#else
+	u64 bits = 0;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		*sum += (u8) p[i];
+
+		if (p[i] == c)
+			bits |= 1ULL << i;
+	}
+
+	return bits;
+#endif
+}
+
+/*
+ * Set bit 'i' of 'bitmap' for every p[i] == c. The bitmap must have room
+ * for SCAN_BITMAP_WORDS(len) words; bits past 'len' are cleared.
+ */
+void scan_bitmap(const char *p, size_t len, char c, u64 *bitmap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
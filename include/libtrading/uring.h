@@ -0,0 +1,63 @@
+#ifndef LIBTRADING_URING_H
+#define LIBTRADING_URING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * io_uring transport backend for the io_recv and io_sendmsg hooks.
+ *
+ * uring_init() sets up a process-wide ring and, on success, points the
+ * hooks at uring_recv() and uring_sendmsg(). If the kernel does not
+ * support the required io_uring features the hooks are left untouched
+ * and the plain recv(2)/sendmsg(2) path stays in use.
+ *
+ * There is one ring per process and none of these functions take a lock:
+ * like the hooks themselves, the backend must only be used from a single
+ * thread, or by threads that serialize every call into it and every
+ * io_recv/io_sendmsg call made while it is enabled.
+ *
+ * Call uring_close() on a socket before close(2). The armed multishot
+ * receive holds its own reference to the socket, so until it is cancelled
+ * the socket is not really closed: no FIN goes out and its buffers stay
+ * pinned. State left behind by a socket closed without it is dropped when
+ * a new socket turns up under the same fd number, at the cost of an
+ * fstat(2) on every uring_recv() and uring_sendmsg().
+ */
+struct uring_cfg {
+	unsigned int		entries;	/* submission queue size */
+	unsigned int		nr_rx_bufs;	/* provided receive buffers, power of two */
+	unsigned int		rx_buf_size;
+	unsigned int		nr_tx_bufs;	/* registered send buffers */
+	unsigned int		tx_buf_size;
+	bool			defer_send;	/* batch sends until the next reap or uring_flush() */
+};
+
+struct uring_stats {
+	unsigned long		nr_enters;	/* io_uring_enter(2) calls */
+	unsigned long		nr_recv_cqes;
+	unsigned long		nr_send_cqes;
+};
+
+void uring_cfg_init(struct uring_cfg *cfg);
+int uring_init(struct uring_cfg *cfg);
+void uring_exit(void);
+bool uring_enabled(void);
+int uring_flush(void);
+void uring_close(int fd);
+void uring_get_stats(struct uring_stats *stats);
+
+ssize_t uring_recv(int fd, void *buffer, size_t length, int flags);
+ssize_t uring_sendmsg(int fd, struct iovec *iov, size_t length, int flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTRADING_URING_H */
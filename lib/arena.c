@@ -0,0 +1,127 @@
+#include "libtrading/arena.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN		16
+#define ARENA_ROUND(size)	(((size) + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1))
+
+struct arena_chunk {
+	struct arena_chunk	*next;
+	size_t			size;
+	char			data[] __attribute__((aligned(ARENA_ALIGN)));
+};
+
+static struct arena_chunk *arena_chunk_new(size_t size)
+{
+	struct arena_chunk *chunk;
+
+	chunk = malloc(sizeof *chunk + size);
+	if (!chunk)
+		return NULL;
+
+	chunk->next	= NULL;
+	chunk->size	= size;
+
+	return chunk;
+}
+
+struct arena *arena_new(size_t chunk_size)
+{
+	struct arena *self = calloc(1, sizeof *self);
+
+	if (!self)
+		return NULL;
+
+	self->chunk_size = chunk_size;
+
+	self->chunks = arena_chunk_new(chunk_size);
+	if (!self->chunks) {
+		arena_delete(self);
+		return NULL;
+	}
+
+	self->current = self->chunks;
+
+	return self;
+}
+
+void arena_delete(struct arena *self)
+{
+	struct arena_chunk *chunk, *next;
+
+	if (!self)
+		return;
+
+	for (chunk = self->chunks; chunk; chunk = next) {
+		next = chunk->next;
+		free(chunk);
+	}
+
+	free(self);
+}
+
+/* Make everything allocated so far available again. */
+void arena_reset(struct arena *self)
+{
+	self->current	= self->chunks;
+	self->used	= 0;
+	self->last	= 0;
+}
+
+void *arena_alloc(struct arena *self, size_t size)
+{
+	struct arena_chunk *chunk = self->current;
+	size_t offset;
+
+	size = ARENA_ROUND(size);
+
+	offset = self->used;
+
+	/* Move on to the next chunk that fits, or insert a new one. */
+	while (offset + size > chunk->size) {
+		struct arena_chunk *next = chunk->next;
+
+		if (!next || size > next->size) {
+			next = arena_chunk_new(size > self->chunk_size ? size : self->chunk_size);
+			if (!next)
+				return NULL;
+
+			next->next	= chunk->next;
+			chunk->next	= next;
+		}
+
+		chunk	= next;
+		offset	= 0;
+	}
+
+	self->current	= chunk;
+	self->last	= offset;
+	self->used	= offset + size;
+
+	return chunk->data + offset;
+}
+
+/*
+ * Resize 'ptr' to 'new_size' bytes, keeping its first 'old_size' bytes.
+ * The latest allocation is extended in place when its chunk has room.
+ */
+void *arena_grow(struct arena *self, void *ptr, size_t old_size, size_t new_size)
+{
+	struct arena_chunk *chunk = self->current;
+	void *ret;
+
+	if (ptr && ptr == chunk->data + self->last && self->last + ARENA_ROUND(new_size) <= chunk->size) {
+		self->used = self->last + ARENA_ROUND(new_size);
+		return ptr;
+	}
+
+	ret = arena_alloc(self, new_size);
+	if (!ret)
+		return NULL;
+
+	if (ptr)
+		memcpy(ret, ptr, old_size < new_size ? old_size : new_size);
+
+	return ret;
+}
@@ -1,6 +1,7 @@
 #include "libtrading/buffer.h"
 
 #include "libtrading/read-write.h"
+#include "libtrading/cpu.h"
 
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -10,6 +11,10 @@
 #include <unistd.h>
 #include <stdio.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 struct buffer *buffer_new(unsigned long capacity)
 {
 	struct buffer *buf;
@@ -22,26 +27,97 @@ struct buffer *buffer_new(unsigned long capacity)
 	buf->capacity	= capacity;
 	buf->start	= 0;
 	buf->end	= 0;
+	buf->mirror	= 0;
+	buf->type	= BUFFER_TYPE_LINEAR;
 
 	return buf;
 }
 
 void buffer_delete(struct buffer *buf)
 {
+	if (buf && buf->mirror) {
+		buffer_mirror_delete(buf);
+		return;
+	}
+
 	free(buf);
 }
 
-u8 buffer_sum_range(const char *start, const char *end)
+/*
+ * FIX checksums only need the byte sum modulo 256. PSADBW against zero
+ * sums 8 bytes into each 64-bit lane, so the kernels accumulate lanes
+ * and fold them at the end; only the low bits of each lane matter.
+ */
+static u8 buffer_sum_range_generic(const char *start, const char *end)
 {
 	unsigned long sum = 0;
-	const char *ptr;
 
-	for (ptr = start; ptr < end; ptr++)
-		sum += *ptr;
+	for (; start < end; start++)
+		sum += *start;
 
 	return sum;
 }
 
+#ifdef __SSE2__
+static u8 buffer_sum_range_sse2(const char *start, const char *end)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i acc = zero;
+	unsigned long sum;
+
+	while (end - start >= 16) {
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128((const __m128i *) start), zero));
+		start += 16;
+	}
+
+	sum = _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(acc, acc));
+
+	return sum + buffer_sum_range_generic(start, end);
+}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2")))
+static u8 buffer_sum_range_avx2(const char *start, const char *end)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	__m256i acc0 = zero, acc1 = zero;
+	unsigned long sum;
+	__m128i acc;
+
+	while (end - start >= 64) {
+		acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *) start), zero));
+		acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *) (start + 32)), zero));
+		start += 64;
+	}
+
+	if (end - start >= 32) {
+		acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *) start), zero));
+		start += 32;
+	}
+
+	acc0 = _mm256_add_epi64(acc0, acc1);
+	acc  = _mm_add_epi64(_mm256_castsi256_si128(acc0), _mm256_extracti128_si256(acc0, 1));
+
+	sum = _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(acc, acc));
+
+	return sum + buffer_sum_range_generic(start, end);
+}
+#endif
+
+u8 buffer_sum_range(const char *start, const char *end)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	if (cpu_has(CPU_FEATURE_AVX2))
+		return buffer_sum_range_avx2(start, end);
+#endif
+#ifdef __SSE2__
+	if (cpu_has(CPU_FEATURE_SSE2))
+		return buffer_sum_range_sse2(start, end);
+#endif
+	return buffer_sum_range_generic(start, end);
+}
+
 u8 buffer_sum(struct buffer *buf)
 {
 	return buffer_sum_range(buf->data + buf->start, buf->data + buf->end);
@@ -101,6 +177,51 @@ ssize_t buffer_recv(struct buffer *buf, int sockfd, size_t size, int flags)
 	return len;
 }
 
+/*
+ * Like buffer_recv() but reads with recvmsg(2) and stores the kernel
+ * receive timestamp of the data in 'ts', or zero if there was none. This
+ * bypasses the io_recv hook.
+ */
+ssize_t buffer_recv_ts(struct buffer *buf, int sockfd, size_t size, int flags, struct timespec *ts)
+{
+	union {
+		char		buf[RX_TIMESTAMP_CMSG_SPACE];
+		struct cmsghdr	align;
+	} control;
+	struct msghdr msg;
+	struct iovec iov;
+	size_t count;
+	ssize_t len;
+
+	count	= buffer_remaining(buf);
+
+	if (count > size)
+		count = size;
+
+	iov = (struct iovec) {
+		.iov_base	= buffer_end(buf),
+		.iov_len	= count,
+	};
+
+	msg = (struct msghdr) {
+		.msg_iov	= &iov,
+		.msg_iovlen	= 1,
+		.msg_control	= control.buf,
+		.msg_controllen	= sizeof(control.buf),
+	};
+
+	len = recvmsg(sockfd, &msg, flags);
+	if (len < 0)
+		return len;
+
+	buf->end += len;
+
+	if (!rx_timestamp_get(&msg, ts))
+		*ts = (struct timespec) { 0, 0 };
+
+	return len;
+}
+
 ssize_t buffer_read(struct buffer *buf, int fd)
 {
 	size_t count;
@@ -206,6 +327,11 @@ void buffer_compact(struct buffer *buf)
 	size_t count;
 	void *start;
 
+	if (buf->mirror) {
+		buffer_mirror_wrap(buf);
+		return;
+	}
+
 	start	= buffer_start(buf);
 	count	= buffer_size(buf);
 
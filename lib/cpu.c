@@ -0,0 +1,35 @@
+#include "libtrading/cpu.h"
+
+unsigned int cpu_feature_set;
+
+unsigned int cpu_features_probe(void)
+{
+	unsigned int features = CPU_FEATURE_PROBED;
+
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("sse2"))
+		features |= CPU_FEATURE_SSE2;
+
+	if (__builtin_cpu_supports("avx2"))
+		features |= CPU_FEATURE_AVX2;
+#endif
+	cpu_feature_set = features;
+
+	return features;
+}
+
+void cpu_features_disable(unsigned int features)
+{
+	if (!cpu_feature_set)
+		cpu_features_probe();
+
+	cpu_feature_set &= ~features | CPU_FEATURE_PROBED;
+}
+
+/* Bring back whatever the CPU supports. */
+void cpu_features_reset(void)
+{
+	cpu_features_probe();
+}
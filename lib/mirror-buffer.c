@@ -0,0 +1,121 @@
+#include "libtrading/buffer.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+
+/*
+ * A mirrored buffer maps the same physical pages twice, back to back, so
+ * that data[i] and data[i + mirror] alias each other. Messages that wrap
+ * past the end of the ring are therefore always contiguous in memory and
+ * buffer_compact() only needs to rewind the offsets instead of moving the
+ * unparsed bytes to the front.
+ */
+
+static int mirror_fd(size_t size)
+{
+	char name[64];
+	int fd;
+
+#ifdef MFD_CLOEXEC
+	fd = memfd_create("libtrading-buffer", MFD_CLOEXEC);
+	if (fd >= 0)
+		goto truncate;
+#endif
+	snprintf(name, sizeof(name), "/libtrading-buffer-%ld", (long) getpid());
+
+	fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+	if (fd < 0)
+		return -1;
+
+	shm_unlink(name);
+
+#ifdef MFD_CLOEXEC
+truncate:
+#endif
+	if (ftruncate(fd, size) < 0) {
+		close(fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+struct buffer *buffer_mirror_new(unsigned long capacity)
+{
+	unsigned long page_size;
+	struct buffer *buf;
+	char *p, *q;
+	int fd;
+
+	page_size = sysconf(_SC_PAGESIZE);
+
+	capacity = (capacity + page_size - 1) & ~(page_size - 1);
+
+	buf = calloc(1, sizeof(*buf));
+	if (!buf)
+		return NULL;
+
+	fd = mirror_fd(capacity);
+	if (fd < 0)
+		goto fd_failed;
+
+	/* Reserve address space for both halves before mapping them. */
+	p = mmap(NULL, 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED)
+		goto mmap_failed;
+
+	q = mmap(p, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+	if (q != p)
+		goto map_failed;
+
+	q = mmap(p + capacity, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+	if (q != p + capacity)
+		goto map_failed;
+
+	close(fd);
+
+	buf->data	= p;
+	buf->start	= 0;
+	buf->end	= 0;
+	buf->capacity	= capacity;
+	buf->mirror	= capacity;
+	buf->type	= BUFFER_TYPE_MIRROR;
+
+	return buf;
+
+map_failed:
+	munmap(p, 2 * capacity);
+
+mmap_failed:
+	close(fd);
+
+fd_failed:
+	free(buf);
+	return NULL;
+}
+
+void buffer_mirror_delete(struct buffer *buf)
+{
+	munmap(buf->data, 2 * buf->mirror);
+
+	free(buf);
+}
+
+/*
+ * Move the offsets back into the first half of the mapping and make all
+ * consumed bytes available for writing again. This is O(1): no data is
+ * copied and pointers into the unparsed data stay valid.
+ */
+void buffer_mirror_wrap(struct buffer *buf)
+{
+	if (buf->start >= buf->mirror) {
+		buf->start	-= buf->mirror;
+		buf->end	-= buf->mirror;
+	}
+
+	buf->capacity = buf->start + buf->mirror;
+}
@@ -2,32 +2,125 @@
 
 #include <sys/mman.h>
 #include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
 
-struct buffer *buffer_mmap(int fd, size_t len)
+struct mmap_buffer {
+	struct buffer		buf;
+	struct buffer_mmap_cfg	cfg;
+	size_t			page_size;
+	size_t			willneed;	/* end of the last MADV_WILLNEED window */
+	size_t			released;	/* everything below has been dropped */
+};
+
+void buffer_mmap_cfg_init(struct buffer_mmap_cfg *cfg)
+{
+	memset(cfg, 0, sizeof(*cfg));
+}
+
+struct buffer *buffer_mmap_with(int fd, size_t len, const struct buffer_mmap_cfg *cfg)
 {
-	struct buffer *buf;
+	struct mmap_buffer *mbuf;
+	int flags = MAP_PRIVATE;
 	void *p;
 
-	buf = calloc(1, sizeof(*buf));
-	if (!buf)
+	mbuf = calloc(1, sizeof(*mbuf));
+	if (!mbuf)
 		return NULL;
 
-	p = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+#ifdef MAP_POPULATE
+	if (cfg->flags & BUFFER_MMAP_POPULATE)
+		flags |= MAP_POPULATE;
+#endif
+
+	p = mmap(NULL, len, PROT_READ, flags, fd, 0);
 	if (p == MAP_FAILED)
 		goto mmap_failed;
 
-	buf->data	= p;
-	buf->start	= 0;
-	buf->end	= len;
-	buf->capacity	= len;
+	if (cfg->flags & BUFFER_MMAP_SEQUENTIAL)
+		madvise(p, len, MADV_SEQUENTIAL);
+
+#ifdef MADV_HUGEPAGE
+	if (cfg->flags & BUFFER_MMAP_HUGEPAGE)
+		madvise(p, len, MADV_HUGEPAGE);
+#endif
+
+	mbuf->buf.data		= p;
+	mbuf->buf.start		= 0;
+	mbuf->buf.end		= len;
+	mbuf->buf.capacity	= len;
+	mbuf->buf.type		= BUFFER_TYPE_MMAP;
 
-	return buf;
+	mbuf->cfg		= *cfg;
+	mbuf->page_size		= sysconf(_SC_PAGESIZE);
+
+	buffer_mmap_advance(&mbuf->buf);
+
+	return &mbuf->buf;
 
 mmap_failed:
-	free(buf);
+	free(mbuf);
 	return NULL;
 }
 
+struct buffer *buffer_mmap(int fd, size_t len)
+{
+	struct buffer_mmap_cfg cfg;
+
+	buffer_mmap_cfg_init(&cfg);
+
+	return buffer_mmap_with(fd, len, &cfg);
+}
+
+/*
+ * Move the read-ahead window along with the consumer and drop pages it
+ * is done with, so that streaming a file larger than RAM keeps a bounded
+ * resident set. Call it whenever buf->start has moved; it only issues a
+ * system call once the cursor has moved by half a window or by a full
+ * release step. Fails with EINVAL for buffers not made by buffer_mmap().
+ */
+int buffer_mmap_advance(struct buffer *buf)
+{
+	struct mmap_buffer *mbuf;
+	size_t page_mask;
+	size_t from, to;
+	int ret = 0;
+
+	if (buf->type != BUFFER_TYPE_MMAP) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	mbuf		= (struct mmap_buffer *) buf;
+	page_mask	= ~(mbuf->page_size - 1);
+
+	if (mbuf->cfg.readahead && mbuf->willneed < buf->capacity &&
+	    buf->start + mbuf->cfg.readahead / 2 >= mbuf->willneed) {
+		from	= buf->start & page_mask;
+		to	= from + mbuf->cfg.readahead;
+
+		if (to > buf->capacity)
+			to = buf->capacity;
+
+		if (madvise(buf->data + from, to - from, MADV_WILLNEED) < 0)
+			ret = -1;
+
+		mbuf->willneed = to;
+	}
+
+	if (mbuf->cfg.release && buf->start - mbuf->released >= mbuf->cfg.release) {
+		to = buf->start & page_mask;
+
+		if (madvise(buf->data + mbuf->released, to - mbuf->released, MADV_DONTNEED) < 0)
+			ret = -1;
+
+		mbuf->released = to;
+	}
+
+	return ret;
+}
+
 void buffer_munmap(struct buffer *buf)
 {
 	munmap(buf->data, buf->capacity);
@@ -7,28 +7,42 @@
 #define BOE_MAGIC_LEN		sizeof(u16)
 #define BOE_MSG_LENGTH_LEN	sizeof(u16)
 
-int boe_message_decode(struct buffer *buf, struct boe_message *msg, size_t size)
+struct boe_message *boe_message_view(struct buffer *buf)
 {
-	u16 magic, len;
-	void *start;
+	struct buffer_view view;
 	size_t count;
 
-	start = buffer_start(buf);
+	if (!buffer_view(buf, BOE_MAGIC_LEN + BOE_MSG_LENGTH_LEN, &view))
+		return NULL;
 
-	magic = buffer_get_le16(buf);
-	if (magic != BOE_MAGIC)
-		return -1;
+	if (view_le16(&view, 0) != BOE_MAGIC)
+		return NULL;
 
-	len = buffer_get_le16(buf);
+	count = BOE_MAGIC_LEN + view_le16(&view, BOE_MAGIC_LEN);
 
-	count = BOE_MAGIC_LEN + len;
+	if (!buffer_view(buf, count, &view))
+		return NULL;
+
+	buffer_advance(buf, count);
+
+	return (void *) view_ptr(&view, 0);
+}
+
+int boe_message_decode(struct buffer *buf, struct boe_message *msg, size_t size)
+{
+	struct boe_message *frame;
+	size_t count;
+
+	frame = boe_message_view(buf);
+	if (!frame)
+		return -1;
+
+	count = BOE_MAGIC_LEN + le16_to_cpu(frame->header.MessageLength);
 
 	if (count > size)
 		count = size;
 
-	memcpy(msg, start, count);
-
-	buffer_advance(buf, len - BOE_MSG_LENGTH_LEN);
+	memcpy(msg, frame, count);
 
 	return 0;
 }
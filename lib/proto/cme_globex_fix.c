@@ -0,0 +1,1929 @@
+#include "libtrading/proto/cme_globex_fix.h"
+
+#include "libtrading/proto/fix_message.h"
+
+#include "fix_parse.h"
+
+#include <string.h>
+
+fix_parse_inline enum fix_type cme_globex_fix_tag_type(int tag)
+{
+	switch (tag) {
+	case CME_GLOBEX_TAG_MsgSeqNum: return FIX_TYPE_MSGSEQNUM;
+	case CME_GLOBEX_TAG_PossDupFlag: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_SenderCompID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_SenderSubID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_SendingTime: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_LastMsgSeqNumProcessed: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_TargetCompID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_TargetSubID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_PossResend: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_OrigSendingTime: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_SenderLocationID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_TargetLocationID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_CheckSum: return FIX_TYPE_CHECKSUM;
+	case CME_GLOBEX_TAG_RawDataLength: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_RawData: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_EncryptMethod: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_HeartBtInt: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_ResetSeqNumFlag: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_ApplicationSystemName: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_TradingSystemVersion: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_ApplicationSystemVendor: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_TestReqID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_BeginSeqNo: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_EndSeqNo: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_RefSeqNum: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_Text: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_RefTagID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_RefMsgType: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_SessionRejectReason: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_BusinessRejectRefID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_BusinessRejectReason: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_NewSeqNo: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_GapFillFlag: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_NextExpectedMsgSeqNum: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_ManualOrderIndicator: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_CustOrderHandlingInst: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_Account: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_ClOrdID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_HandlInst: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_OrderQty: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_OrdType: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_Price: return FIX_TYPE_FLOAT;
+	case CME_GLOBEX_TAG_Side: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_Symbol: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_TimeInForce: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_TransactTime: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_PreTradeAnonymity: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_NoAllocs: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_AllocAccount: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_StopPx: return FIX_TYPE_FLOAT;
+	case CME_GLOBEX_TAG_SecurityDesc: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_MinQty: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_SecurityType: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_CustomerOrFirm: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_MaxShow: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_ExpireDate: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_SelfMatchPreventionID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_SelfMatchPreventionInstruction: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_CtiCode: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_GiveUpFirm: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_CmtaGiveupCD: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_CorrelationClOrdID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_OrderID: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_OrigClOrdID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_OFMOverride: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_AvgPx: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_CumQty: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_ExecID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_ExecTransType: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_LastPx: return FIX_TYPE_FLOAT;
+	case CME_GLOBEX_TAG_LastQty: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_OrdStatus: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_SecurityID: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_ExecType: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_LeavesQty: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_ExecRestatementReason: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_CrossID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_CrossType: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_HostCrossID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_MassStatusReqID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_TradeDate: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_LastRptRequested: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_ContraTrader: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_ContraBroker: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_TotalNumSecurities: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_MultiLegReportingType: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_SecondaryExecID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_UnderlyingPx: return FIX_TYPE_FLOAT;
+	case CME_GLOBEX_TAG_OptionDelta: return FIX_TYPE_FLOAT;
+	case CME_GLOBEX_TAG_AggressorIndicator: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_Volatility: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_ExpirationTimeValue: return FIX_TYPE_FLOAT;
+	case CME_GLOBEX_TAG_RiskFreeRate: return FIX_TYPE_FLOAT;
+	case CME_GLOBEX_TAG_OrdRejReason: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_CxlRejReason: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_CxlRejResponseTo: return FIX_TYPE_CHAR;
+	case CME_GLOBEX_TAG_MassStatusReqType: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_OrdStatusReqType: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_MassActionType: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_MassActionScope: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_MarketSegmentID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_MassCancelRequestType: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_MassActionReportID: return FIX_TYPE_STRING;
+	case CME_GLOBEX_TAG_MassActionResponse: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_TotalAffectedOrders: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_NoAffectedOrders: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_CxlQty: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_AffectedOrderID: return FIX_TYPE_INT;
+	case CME_GLOBEX_TAG_LastFragment: return FIX_TYPE_CHAR;
+	default: return FIX_TYPE_STRING;
+	}
+}
+
+static int cme_globex_fix_parse_body(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
+{
+	return fix_parse_body(self, dialect, cme_globex_fix_tag_type, buffer, flags);
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_logon_parse(struct cme_globex_logon *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "A\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_RawDataLength:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_LOGON_RAW_DATA_LENGTH))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->raw_data_length = field->int_value;
+			self->present |= CME_GLOBEX_LOGON_RAW_DATA_LENGTH;
+			break;
+		case CME_GLOBEX_TAG_RawData:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_LOGON_RAW_DATA))
+				break;
+			self->raw_data = field->string_value;
+			self->raw_data_len = field->value_len;
+			self->present |= CME_GLOBEX_LOGON_RAW_DATA;
+			break;
+		case CME_GLOBEX_TAG_EncryptMethod:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_LOGON_ENCRYPT_METHOD))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->encrypt_method = field->int_value;
+			self->present |= CME_GLOBEX_LOGON_ENCRYPT_METHOD;
+			break;
+		case CME_GLOBEX_TAG_HeartBtInt:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_LOGON_HEART_BT_INT))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->heart_bt_int = field->int_value;
+			self->present |= CME_GLOBEX_LOGON_HEART_BT_INT;
+			break;
+		case CME_GLOBEX_TAG_ResetSeqNumFlag:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_LOGON_RESET_SEQ_NUM_FLAG))
+				break;
+			self->reset_seq_num_flag = field->char_value;
+			self->present |= CME_GLOBEX_LOGON_RESET_SEQ_NUM_FLAG;
+			break;
+		case CME_GLOBEX_TAG_ApplicationSystemName:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_LOGON_APPLICATION_SYSTEM_NAME))
+				break;
+			self->application_system_name = field->string_value;
+			self->application_system_name_len = field->value_len;
+			self->present |= CME_GLOBEX_LOGON_APPLICATION_SYSTEM_NAME;
+			break;
+		case CME_GLOBEX_TAG_TradingSystemVersion:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_LOGON_TRADING_SYSTEM_VERSION))
+				break;
+			self->trading_system_version = field->string_value;
+			self->trading_system_version_len = field->value_len;
+			self->present |= CME_GLOBEX_LOGON_TRADING_SYSTEM_VERSION;
+			break;
+		case CME_GLOBEX_TAG_ApplicationSystemVendor:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_LOGON_APPLICATION_SYSTEM_VENDOR))
+				break;
+			self->application_system_vendor = field->string_value;
+			self->application_system_vendor_len = field->value_len;
+			self->present |= CME_GLOBEX_LOGON_APPLICATION_SYSTEM_VENDOR;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_heart_beat_parse(struct cme_globex_heart_beat *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "0\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_TestReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_HEART_BEAT_TEST_REQ_ID))
+				break;
+			self->test_req_id = field->string_value;
+			self->test_req_id_len = field->value_len;
+			self->present |= CME_GLOBEX_HEART_BEAT_TEST_REQ_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_test_request_parse(struct cme_globex_test_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "1\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_TestReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_TEST_REQUEST_TEST_REQ_ID))
+				break;
+			self->test_req_id = field->string_value;
+			self->test_req_id_len = field->value_len;
+			self->present |= CME_GLOBEX_TEST_REQUEST_TEST_REQ_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_resend_request_parse(struct cme_globex_resend_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "2\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_BeginSeqNo:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_RESEND_REQUEST_BEGIN_SEQ_NO))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->begin_seq_no = field->int_value;
+			self->present |= CME_GLOBEX_RESEND_REQUEST_BEGIN_SEQ_NO;
+			break;
+		case CME_GLOBEX_TAG_EndSeqNo:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_RESEND_REQUEST_END_SEQ_NO))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->end_seq_no = field->int_value;
+			self->present |= CME_GLOBEX_RESEND_REQUEST_END_SEQ_NO;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_session_level_reject_parse(struct cme_globex_session_level_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "3\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_RefSeqNum:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_SESSION_LEVEL_REJECT_REF_SEQ_NUM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->ref_seq_num = field->int_value;
+			self->present |= CME_GLOBEX_SESSION_LEVEL_REJECT_REF_SEQ_NUM;
+			break;
+		case CME_GLOBEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_SESSION_LEVEL_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= CME_GLOBEX_SESSION_LEVEL_REJECT_TEXT;
+			break;
+		case CME_GLOBEX_TAG_RefTagID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_SESSION_LEVEL_REJECT_REF_TAG_ID))
+				break;
+			self->ref_tag_id = field->string_value;
+			self->ref_tag_id_len = field->value_len;
+			self->present |= CME_GLOBEX_SESSION_LEVEL_REJECT_REF_TAG_ID;
+			break;
+		case CME_GLOBEX_TAG_RefMsgType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_SESSION_LEVEL_REJECT_REF_MSG_TYPE))
+				break;
+			self->ref_msg_type = field->string_value;
+			self->ref_msg_type_len = field->value_len;
+			self->present |= CME_GLOBEX_SESSION_LEVEL_REJECT_REF_MSG_TYPE;
+			break;
+		case CME_GLOBEX_TAG_SessionRejectReason:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_SESSION_LEVEL_REJECT_SESSION_REJECT_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->session_reject_reason = field->int_value;
+			self->present |= CME_GLOBEX_SESSION_LEVEL_REJECT_SESSION_REJECT_REASON;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_SESSION_LEVEL_REJECT_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_SESSION_LEVEL_REJECT_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_SESSION_LEVEL_REJECT_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= CME_GLOBEX_SESSION_LEVEL_REJECT_CUST_ORDER_HANDLING_INST;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_business_level_reject_parse(struct cme_globex_business_level_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "j\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_RefSeqNum:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_BUSINESS_LEVEL_REJECT_REF_SEQ_NUM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->ref_seq_num = field->int_value;
+			self->present |= CME_GLOBEX_BUSINESS_LEVEL_REJECT_REF_SEQ_NUM;
+			break;
+		case CME_GLOBEX_TAG_RefMsgType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_BUSINESS_LEVEL_REJECT_REF_MSG_TYPE))
+				break;
+			self->ref_msg_type = field->string_value;
+			self->ref_msg_type_len = field->value_len;
+			self->present |= CME_GLOBEX_BUSINESS_LEVEL_REJECT_REF_MSG_TYPE;
+			break;
+		case CME_GLOBEX_TAG_BusinessRejectRefID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_BUSINESS_LEVEL_REJECT_BUSINESS_REJECT_REF_ID))
+				break;
+			self->business_reject_ref_id = field->string_value;
+			self->business_reject_ref_id_len = field->value_len;
+			self->present |= CME_GLOBEX_BUSINESS_LEVEL_REJECT_BUSINESS_REJECT_REF_ID;
+			break;
+		case CME_GLOBEX_TAG_BusinessRejectReason:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_BUSINESS_LEVEL_REJECT_BUSINESS_REJECT_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->business_reject_reason = field->int_value;
+			self->present |= CME_GLOBEX_BUSINESS_LEVEL_REJECT_BUSINESS_REJECT_REASON;
+			break;
+		case CME_GLOBEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_BUSINESS_LEVEL_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= CME_GLOBEX_BUSINESS_LEVEL_REJECT_TEXT;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_BUSINESS_LEVEL_REJECT_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_BUSINESS_LEVEL_REJECT_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_BUSINESS_LEVEL_REJECT_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= CME_GLOBEX_BUSINESS_LEVEL_REJECT_CUST_ORDER_HANDLING_INST;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_sequence_reset_parse(struct cme_globex_sequence_reset *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "4\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_NewSeqNo:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_SEQUENCE_RESET_NEW_SEQ_NO))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->new_seq_no = field->int_value;
+			self->present |= CME_GLOBEX_SEQUENCE_RESET_NEW_SEQ_NO;
+			break;
+		case CME_GLOBEX_TAG_GapFillFlag:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_SEQUENCE_RESET_GAP_FILL_FLAG))
+				break;
+			self->gap_fill_flag = field->char_value;
+			self->present |= CME_GLOBEX_SEQUENCE_RESET_GAP_FILL_FLAG;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_logout_parse(struct cme_globex_logout *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "5\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_LOGOUT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= CME_GLOBEX_LOGOUT_TEXT;
+			break;
+		case CME_GLOBEX_TAG_NextExpectedMsgSeqNum:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_LOGOUT_NEXT_EXPECTED_MSG_SEQ_NUM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->next_expected_msg_seq_num = field->int_value;
+			self->present |= CME_GLOBEX_LOGOUT_NEXT_EXPECTED_MSG_SEQ_NUM;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_new_order_single_parse(struct cme_globex_new_order_single *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "D\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_HandlInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_HANDL_INST))
+				break;
+			self->handl_inst = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_HANDL_INST;
+			break;
+		case CME_GLOBEX_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_CUST_ORDER_HANDLING_INST;
+			break;
+		case CME_GLOBEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->int_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_ORDER_QTY;
+			break;
+		case CME_GLOBEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_ORD_TYPE))
+				break;
+			self->ord_type = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_ORD_TYPE;
+			break;
+		case CME_GLOBEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_PRICE;
+			break;
+		case CME_GLOBEX_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_SIDE;
+			break;
+		case CME_GLOBEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_SYMBOL;
+			break;
+		case CME_GLOBEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_TIME_IN_FORCE;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_PreTradeAnonymity:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_PRE_TRADE_ANONYMITY))
+				break;
+			self->pre_trade_anonymity = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_PRE_TRADE_ANONYMITY;
+			break;
+		case CME_GLOBEX_TAG_NoAllocs:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_NO_ALLOCS))
+				break;
+			self->no_allocs = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_NO_ALLOCS;
+			break;
+		case CME_GLOBEX_TAG_AllocAccount:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_ALLOC_ACCOUNT))
+				break;
+			self->alloc_account = field->string_value;
+			self->alloc_account_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_ALLOC_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_StopPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_STOP_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->stop_px = field->float_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_STOP_PX;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_MinQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_MIN_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->min_qty = field->int_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_MIN_QTY;
+			break;
+		case CME_GLOBEX_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_SECURITY_TYPE;
+			break;
+		case CME_GLOBEX_TAG_CustomerOrFirm:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_CUSTOMER_OR_FIRM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->customer_or_firm = field->int_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_CUSTOMER_OR_FIRM;
+			break;
+		case CME_GLOBEX_TAG_MaxShow:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_MAX_SHOW))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->max_show = field->int_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_MAX_SHOW;
+			break;
+		case CME_GLOBEX_TAG_ExpireDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_EXPIRE_DATE))
+				break;
+			self->expire_date = field->string_value;
+			self->expire_date_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_EXPIRE_DATE;
+			break;
+		case CME_GLOBEX_TAG_SelfMatchPreventionID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_SELF_MATCH_PREVENTION_ID))
+				break;
+			self->self_match_prevention_id = field->string_value;
+			self->self_match_prevention_id_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_SELF_MATCH_PREVENTION_ID;
+			break;
+		case CME_GLOBEX_TAG_SelfMatchPreventionInstruction:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_SELF_MATCH_PREVENTION_INSTRUCTION))
+				break;
+			self->self_match_prevention_instruction = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_SELF_MATCH_PREVENTION_INSTRUCTION;
+			break;
+		case CME_GLOBEX_TAG_CtiCode:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_CTI_CODE))
+				break;
+			self->cti_code = field->char_value;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_CTI_CODE;
+			break;
+		case CME_GLOBEX_TAG_GiveUpFirm:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_GIVE_UP_FIRM))
+				break;
+			self->give_up_firm = field->string_value;
+			self->give_up_firm_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_GIVE_UP_FIRM;
+			break;
+		case CME_GLOBEX_TAG_CmtaGiveupCD:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_CMTA_GIVEUP_CD))
+				break;
+			self->cmta_giveup_cd = field->string_value;
+			self->cmta_giveup_cd_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_CMTA_GIVEUP_CD;
+			break;
+		case CME_GLOBEX_TAG_CorrelationClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_NEW_ORDER_SINGLE_CORRELATION_CL_ORD_ID))
+				break;
+			self->correlation_cl_ord_id = field->string_value;
+			self->correlation_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_NEW_ORDER_SINGLE_CORRELATION_CL_ORD_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_execution_report_parse(struct cme_globex_execution_report *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "8\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_AvgPx:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_AVG_PX))
+				break;
+			self->avg_px = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_AVG_PX;
+			break;
+		case CME_GLOBEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_CumQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_CUM_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->cum_qty = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CUM_QTY;
+			break;
+		case CME_GLOBEX_TAG_ExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_EXEC_ID))
+				break;
+			self->exec_id = field->string_value;
+			self->exec_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_EXEC_ID;
+			break;
+		case CME_GLOBEX_TAG_ExecTransType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_EXEC_TRANS_TYPE))
+				break;
+			self->exec_trans_type = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_EXEC_TRANS_TYPE;
+			break;
+		case CME_GLOBEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_ORDER_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_id = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ORDER_ID;
+			break;
+		case CME_GLOBEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ORDER_QTY;
+			break;
+		case CME_GLOBEX_TAG_OrdStatus:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_ORD_STATUS))
+				break;
+			self->ord_status = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ORD_STATUS;
+			break;
+		case CME_GLOBEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_ORD_TYPE))
+				break;
+			self->ord_type = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ORD_TYPE;
+			break;
+		case CME_GLOBEX_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ORIG_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_EXECUTION_REPORT_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_PRICE;
+			break;
+		case CME_GLOBEX_TAG_SecurityID:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_SECURITY_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->security_id = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SECURITY_ID;
+			break;
+		case CME_GLOBEX_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SIDE;
+			break;
+		case CME_GLOBEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SYMBOL;
+			break;
+		case CME_GLOBEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_TIME_IN_FORCE;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_NoAllocs:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_NO_ALLOCS))
+				break;
+			self->no_allocs = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_NO_ALLOCS;
+			break;
+		case CME_GLOBEX_TAG_AllocAccount:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_ALLOC_ACCOUNT))
+				break;
+			self->alloc_account = field->string_value;
+			self->alloc_account_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ALLOC_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_StopPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_EXECUTION_REPORT_STOP_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->stop_px = field->float_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_STOP_PX;
+			break;
+		case CME_GLOBEX_TAG_MinQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_MIN_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->min_qty = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_MIN_QTY;
+			break;
+		case CME_GLOBEX_TAG_ExecType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_EXEC_TYPE))
+				break;
+			self->exec_type = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_EXEC_TYPE;
+			break;
+		case CME_GLOBEX_TAG_LeavesQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_LEAVES_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->leaves_qty = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_LEAVES_QTY;
+			break;
+		case CME_GLOBEX_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SECURITY_TYPE;
+			break;
+		case CME_GLOBEX_TAG_ExecRestatementReason:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_EXEC_RESTATEMENT_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->exec_restatement_reason = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_EXEC_RESTATEMENT_REASON;
+			break;
+		case CME_GLOBEX_TAG_MaxShow:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_MAX_SHOW))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->max_show = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_MAX_SHOW;
+			break;
+		case CME_GLOBEX_TAG_ExpireDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_EXPIRE_DATE))
+				break;
+			self->expire_date = field->string_value;
+			self->expire_date_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_EXPIRE_DATE;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CUST_ORDER_HANDLING_INST;
+			break;
+		case CME_GLOBEX_TAG_PreTradeAnonymity:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_PRE_TRADE_ANONYMITY))
+				break;
+			self->pre_trade_anonymity = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_PRE_TRADE_ANONYMITY;
+			break;
+		case CME_GLOBEX_TAG_SelfMatchPreventionID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_SELF_MATCH_PREVENTION_ID))
+				break;
+			self->self_match_prevention_id = field->string_value;
+			self->self_match_prevention_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SELF_MATCH_PREVENTION_ID;
+			break;
+		case CME_GLOBEX_TAG_SelfMatchPreventionInstruction:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_SELF_MATCH_PREVENTION_INSTRUCTION))
+				break;
+			self->self_match_prevention_instruction = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SELF_MATCH_PREVENTION_INSTRUCTION;
+			break;
+		case CME_GLOBEX_TAG_CorrelationClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_CORRELATION_CL_ORD_ID))
+				break;
+			self->correlation_cl_ord_id = field->string_value;
+			self->correlation_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CORRELATION_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_CrossID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_CROSS_ID))
+				break;
+			self->cross_id = field->string_value;
+			self->cross_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CROSS_ID;
+			break;
+		case CME_GLOBEX_TAG_CrossType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_CROSS_TYPE))
+				break;
+			self->cross_type = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CROSS_TYPE;
+			break;
+		case CME_GLOBEX_TAG_HostCrossID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_HOST_CROSS_ID))
+				break;
+			self->host_cross_id = field->string_value;
+			self->host_cross_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_HOST_CROSS_ID;
+			break;
+		case CME_GLOBEX_TAG_MassStatusReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_MASS_STATUS_REQ_ID))
+				break;
+			self->mass_status_req_id = field->string_value;
+			self->mass_status_req_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_MASS_STATUS_REQ_ID;
+			break;
+		case CME_GLOBEX_TAG_RefMsgType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_REF_MSG_TYPE))
+				break;
+			self->ref_msg_type = field->string_value;
+			self->ref_msg_type_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_REF_MSG_TYPE;
+			break;
+		case CME_GLOBEX_TAG_BusinessRejectReason:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_BUSINESS_REJECT_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->business_reject_reason = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_BUSINESS_REJECT_REASON;
+			break;
+		case CME_GLOBEX_TAG_TradeDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_TRADE_DATE))
+				break;
+			self->trade_date = field->string_value;
+			self->trade_date_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_TRADE_DATE;
+			break;
+		case CME_GLOBEX_TAG_LastRptRequested:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_LAST_RPT_REQUESTED))
+				break;
+			self->last_rpt_requested = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_LAST_RPT_REQUESTED;
+			break;
+		case CME_GLOBEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_TEXT;
+			break;
+		case CME_GLOBEX_TAG_LastPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_EXECUTION_REPORT_LAST_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->last_px = field->float_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_LAST_PX;
+			break;
+		case CME_GLOBEX_TAG_LastQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_LAST_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->last_qty = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_LAST_QTY;
+			break;
+		case CME_GLOBEX_TAG_ContraTrader:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_CONTRA_TRADER))
+				break;
+			self->contra_trader = field->string_value;
+			self->contra_trader_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CONTRA_TRADER;
+			break;
+		case CME_GLOBEX_TAG_ContraBroker:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_CONTRA_BROKER))
+				break;
+			self->contra_broker = field->string_value;
+			self->contra_broker_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_CONTRA_BROKER;
+			break;
+		case CME_GLOBEX_TAG_TotalNumSecurities:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_TOTAL_NUM_SECURITIES))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->total_num_securities = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_TOTAL_NUM_SECURITIES;
+			break;
+		case CME_GLOBEX_TAG_MultiLegReportingType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_MULTI_LEG_REPORTING_TYPE))
+				break;
+			self->multi_leg_reporting_type = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_MULTI_LEG_REPORTING_TYPE;
+			break;
+		case CME_GLOBEX_TAG_SecondaryExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_SECONDARY_EXEC_ID))
+				break;
+			self->secondary_exec_id = field->string_value;
+			self->secondary_exec_id_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_SECONDARY_EXEC_ID;
+			break;
+		case CME_GLOBEX_TAG_UnderlyingPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_EXECUTION_REPORT_UNDERLYING_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->underlying_px = field->float_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_UNDERLYING_PX;
+			break;
+		case CME_GLOBEX_TAG_OptionDelta:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_EXECUTION_REPORT_OPTION_DELTA))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->option_delta = field->float_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_OPTION_DELTA;
+			break;
+		case CME_GLOBEX_TAG_AggressorIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_EXECUTION_REPORT_AGGRESSOR_INDICATOR))
+				break;
+			self->aggressor_indicator = field->char_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_AGGRESSOR_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_Volatility:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_EXECUTION_REPORT_VOLATILITY))
+				break;
+			self->volatility = field->string_value;
+			self->volatility_len = field->value_len;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_VOLATILITY;
+			break;
+		case CME_GLOBEX_TAG_ExpirationTimeValue:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_EXECUTION_REPORT_EXPIRATION_TIME_VALUE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->expiration_time_value = field->float_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_EXPIRATION_TIME_VALUE;
+			break;
+		case CME_GLOBEX_TAG_RiskFreeRate:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_EXECUTION_REPORT_RISK_FREE_RATE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->risk_free_rate = field->float_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_RISK_FREE_RATE;
+			break;
+		case CME_GLOBEX_TAG_OrdRejReason:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_EXECUTION_REPORT_ORD_REJ_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->ord_rej_reason = field->int_value;
+			self->present |= CME_GLOBEX_EXECUTION_REPORT_ORD_REJ_REASON;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_order_cancel_request_parse(struct cme_globex_order_cancel_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "F\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_ORDER_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_id = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_ORDER_ID;
+			break;
+		case CME_GLOBEX_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_SIDE;
+			break;
+		case CME_GLOBEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_SYMBOL;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_SECURITY_TYPE;
+			break;
+		case CME_GLOBEX_TAG_CorrelationClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REQUEST_CORRELATION_CL_ORD_ID))
+				break;
+			self->correlation_cl_ord_id = field->string_value;
+			self->correlation_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REQUEST_CORRELATION_CL_ORD_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_order_cancel_replace_request_parse(struct cme_globex_order_cancel_replace_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "G\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_id = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_ID;
+			break;
+		case CME_GLOBEX_TAG_HandlInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST))
+				break;
+			self->handl_inst = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST;
+			break;
+		case CME_GLOBEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY;
+			break;
+		case CME_GLOBEX_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CUST_ORDER_HANDLING_INST;
+			break;
+		case CME_GLOBEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE))
+				break;
+			self->ord_type = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE;
+			break;
+		case CME_GLOBEX_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_PRICE;
+			break;
+		case CME_GLOBEX_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SIDE;
+			break;
+		case CME_GLOBEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL;
+			break;
+		case CME_GLOBEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TEXT;
+			break;
+		case CME_GLOBEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TIME_IN_FORCE;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_PreTradeAnonymity:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_PRE_TRADE_ANONYMITY))
+				break;
+			self->pre_trade_anonymity = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_PRE_TRADE_ANONYMITY;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_NoAllocs:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_NO_ALLOCS))
+				break;
+			self->no_allocs = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_NO_ALLOCS;
+			break;
+		case CME_GLOBEX_TAG_AllocAccount:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ALLOC_ACCOUNT))
+				break;
+			self->alloc_account = field->string_value;
+			self->alloc_account_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_ALLOC_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_StopPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_STOP_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->stop_px = field->float_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_STOP_PX;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_MinQty:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MIN_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->min_qty = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MIN_QTY;
+			break;
+		case CME_GLOBEX_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_TYPE;
+			break;
+		case CME_GLOBEX_TAG_CustomerOrFirm:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CUSTOMER_OR_FIRM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->customer_or_firm = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CUSTOMER_OR_FIRM;
+			break;
+		case CME_GLOBEX_TAG_MaxShow:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->max_show = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW;
+			break;
+		case CME_GLOBEX_TAG_ExpireDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_EXPIRE_DATE))
+				break;
+			self->expire_date = field->string_value;
+			self->expire_date_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_EXPIRE_DATE;
+			break;
+		case CME_GLOBEX_TAG_SelfMatchPreventionID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SELF_MATCH_PREVENTION_ID))
+				break;
+			self->self_match_prevention_id = field->string_value;
+			self->self_match_prevention_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SELF_MATCH_PREVENTION_ID;
+			break;
+		case CME_GLOBEX_TAG_SelfMatchPreventionInstruction:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SELF_MATCH_PREVENTION_INSTRUCTION))
+				break;
+			self->self_match_prevention_instruction = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_SELF_MATCH_PREVENTION_INSTRUCTION;
+			break;
+		case CME_GLOBEX_TAG_CtiCode:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CTI_CODE))
+				break;
+			self->cti_code = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CTI_CODE;
+			break;
+		case CME_GLOBEX_TAG_GiveUpFirm:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_GIVE_UP_FIRM))
+				break;
+			self->give_up_firm = field->string_value;
+			self->give_up_firm_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_GIVE_UP_FIRM;
+			break;
+		case CME_GLOBEX_TAG_CmtaGiveupCD:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CMTA_GIVEUP_CD))
+				break;
+			self->cmta_giveup_cd = field->string_value;
+			self->cmta_giveup_cd_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CMTA_GIVEUP_CD;
+			break;
+		case CME_GLOBEX_TAG_CorrelationClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CORRELATION_CL_ORD_ID))
+				break;
+			self->correlation_cl_ord_id = field->string_value;
+			self->correlation_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_CORRELATION_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_OFMOverride:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_OFM_OVERRIDE))
+				break;
+			self->ofm_override = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REPLACE_REQUEST_OFM_OVERRIDE;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_order_cancel_reject_parse(struct cme_globex_order_cancel_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "9\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_ExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_EXEC_ID))
+				break;
+			self->exec_id = field->string_value;
+			self->exec_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_EXEC_ID;
+			break;
+		case CME_GLOBEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_ORDER_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_id = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_ORDER_ID;
+			break;
+		case CME_GLOBEX_TAG_OrdStatus:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_ORD_STATUS))
+				break;
+			self->ord_status = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_ORD_STATUS;
+			break;
+		case CME_GLOBEX_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_SecurityID:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_SECURITY_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->security_id = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_SECURITY_ID;
+			break;
+		case CME_GLOBEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_TEXT;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_CxlRejReason:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_CXL_REJ_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->cxl_rej_reason = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_CXL_REJ_REASON;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_CxlRejResponseTo:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_CXL_REJ_RESPONSE_TO))
+				break;
+			self->cxl_rej_response_to = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_CXL_REJ_RESPONSE_TO;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_PreTradeAnonymity:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_PRE_TRADE_ANONYMITY))
+				break;
+			self->pre_trade_anonymity = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_PRE_TRADE_ANONYMITY;
+			break;
+		case CME_GLOBEX_TAG_SelfMatchPreventionID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_SELF_MATCH_PREVENTION_ID))
+				break;
+			self->self_match_prevention_id = field->string_value;
+			self->self_match_prevention_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_SELF_MATCH_PREVENTION_ID;
+			break;
+		case CME_GLOBEX_TAG_CorrelationClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_CANCEL_REJECT_CORRELATION_CL_ORD_ID))
+				break;
+			self->correlation_cl_ord_id = field->string_value;
+			self->correlation_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_CANCEL_REJECT_CORRELATION_CL_ORD_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_order_status_request_parse(struct cme_globex_order_status_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "H\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_ORDER_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_id = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_ORDER_ID;
+			break;
+		case CME_GLOBEX_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_SIDE;
+			break;
+		case CME_GLOBEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_SYMBOL;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_MANUAL_ORDER_INDICATOR;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_SECURITY_TYPE;
+			break;
+		case CME_GLOBEX_TAG_CorrelationClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_STATUS_REQUEST_CORRELATION_CL_ORD_ID))
+				break;
+			self->correlation_cl_ord_id = field->string_value;
+			self->correlation_cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_STATUS_REQUEST_CORRELATION_CL_ORD_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_order_mass_status_request_parse(struct cme_globex_order_mass_status_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "AF\001", 3))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_MassStatusReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MASS_STATUS_REQ_ID))
+				break;
+			self->mass_status_req_id = field->string_value;
+			self->mass_status_req_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MASS_STATUS_REQ_ID;
+			break;
+		case CME_GLOBEX_TAG_MassStatusReqType:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MASS_STATUS_REQ_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->mass_status_req_type = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MASS_STATUS_REQ_TYPE;
+			break;
+		case CME_GLOBEX_TAG_OrdStatusReqType:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_ORD_STATUS_REQ_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->ord_status_req_type = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_ORD_STATUS_REQ_TYPE;
+			break;
+		case CME_GLOBEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_SYMBOL;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_TIME_IN_FORCE;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_STATUS_REQUEST_MANUAL_ORDER_INDICATOR;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int cme_globex_order_mass_action_request_parse(struct cme_globex_order_mass_action_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "CA\001", 3))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case CME_GLOBEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_CL_ORD_ID;
+			break;
+		case CME_GLOBEX_TAG_MassActionType:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_ACTION_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->mass_action_type = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_ACTION_TYPE;
+			break;
+		case CME_GLOBEX_TAG_MassActionScope:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_ACTION_SCOPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->mass_action_scope = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_ACTION_SCOPE;
+			break;
+		case CME_GLOBEX_TAG_MarketSegmentID:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MARKET_SEGMENT_ID))
+				break;
+			self->market_segment_id = field->string_value;
+			self->market_segment_id_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MARKET_SEGMENT_ID;
+			break;
+		case CME_GLOBEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SYMBOL;
+			break;
+		case CME_GLOBEX_TAG_SecurityDesc:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SECURITY_DESC))
+				break;
+			self->security_desc = field->string_value;
+			self->security_desc_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SECURITY_DESC;
+			break;
+		case CME_GLOBEX_TAG_MassCancelRequestType:
+			if (field->type != FIX_TYPE_INT || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_CANCEL_REQUEST_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->mass_cancel_request_type = field->int_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MASS_CANCEL_REQUEST_TYPE;
+			break;
+		case CME_GLOBEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_ACCOUNT;
+			break;
+		case CME_GLOBEX_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_SIDE;
+			break;
+		case CME_GLOBEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_ORD_TYPE))
+				break;
+			self->ord_type = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_ORD_TYPE;
+			break;
+		case CME_GLOBEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_TIME_IN_FORCE;
+			break;
+		case CME_GLOBEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_TRANSACT_TIME;
+			break;
+		case CME_GLOBEX_TAG_ManualOrderIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MANUAL_ORDER_INDICATOR))
+				break;
+			self->manual_order_indicator = field->char_value;
+			self->present |= CME_GLOBEX_ORDER_MASS_ACTION_REQUEST_MANUAL_ORDER_INDICATOR;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+struct fix_dialect cme_globex_fix_dialect = {
+	.version = FIX_4_2,
+	.tag_type = cme_globex_fix_tag_type,
+	.parse_body = cme_globex_fix_parse_body,
+};
+
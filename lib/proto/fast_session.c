@@ -1,9 +1,11 @@
 #include "libtrading/proto/fast_session.h"
 #include "libtrading/read-write.h"
 
+#include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <stdlib.h>
+#include <string.h>
 
 static ssize_t xwritev0(int fd, const struct msghdr *msg, int flags)
 {
@@ -15,6 +17,66 @@ static ssize_t buffer_nread0(struct buffer *buf, int fd, size_t size, int flags)
 	return buffer_nread(buf, fd, size);
 }
 
+static bool is_dgram_socket(int sockfd)
+{
+	socklen_t len = sizeof(int);
+	int type;
+
+	if (getsockopt(sockfd, SOL_SOCKET, SO_TYPE, &type, &len))
+		return false;
+
+	return type == SOCK_DGRAM;
+}
+
+static int fast_session_batch_init(struct fast_session *self, int batch_size)
+{
+	int i;
+
+	self->rx_mmsgs = calloc(batch_size, sizeof(struct mmsghdr));
+	if (!self->rx_mmsgs)
+		return -1;
+
+	self->rx_iovs = calloc(batch_size, sizeof(struct iovec));
+	if (!self->rx_iovs)
+		return -1;
+
+	self->rx_packets = calloc(batch_size, FAST_MESSAGE_MAX_SIZE);
+	if (!self->rx_packets)
+		return -1;
+
+	if (self->rx_timestamps) {
+		self->rx_controls = calloc(batch_size, RX_TIMESTAMP_CMSG_SPACE);
+		if (!self->rx_controls)
+			return -1;
+	}
+
+	for (i = 0; i < batch_size; i++) {
+		self->rx_iovs[i] = (struct iovec) {
+			.iov_base	= self->rx_packets + i * FAST_MESSAGE_MAX_SIZE,
+			.iov_len	= FAST_MESSAGE_MAX_SIZE,
+		};
+
+		self->rx_mmsgs[i].msg_hdr = (struct msghdr) {
+			.msg_iov	= &self->rx_iovs[i],
+			.msg_iovlen	= 1,
+		};
+
+		if (self->rx_controls)
+			self->rx_mmsgs[i].msg_hdr.msg_control = self->rx_controls + i * RX_TIMESTAMP_CMSG_SPACE;
+	}
+
+	self->batch_size	= batch_size;
+	self->nr_packets	= 0;
+	self->packet		= 0;
+
+	return 0;
+}
+
+void fast_session_cfg_init(struct fast_session_cfg *cfg)
+{
+	memset(cfg, 0, sizeof(*cfg));
+}
+
 struct fast_session *fast_session_new(struct fast_session_cfg *cfg)
 {
 	struct fast_session *self = calloc(1, sizeof *self);
@@ -23,12 +85,46 @@ struct fast_session *fast_session_new(struct fast_session_cfg *cfg)
 	if (!self)
 		return NULL;
 
-	self->rx_buffer		= buffer_new(FAST_RECV_BUFFER_SIZE);
-	if (!self->rx_buffer) {
+	if (fstat(cfg->sockfd, &statbuf)) {
 		fast_session_free(self);
 		return NULL;
 	}
 
+	if (cfg->rx_timestamps && S_ISSOCK(statbuf.st_mode)) {
+		if (rx_timestamps_enable(cfg->sockfd) < 0) {
+			fast_session_free(self);
+			return NULL;
+		}
+
+		self->rx_timestamps = true;
+	}
+
+	/*
+	 * Batching only makes sense for datagram sockets. The rx buffer then
+	 * points into the packet array and owns no data of its own.
+	 */
+	if (cfg->batch_size > 1 && S_ISSOCK(statbuf.st_mode) && is_dgram_socket(cfg->sockfd)) {
+		self->rx_buffer	= buffer_new(0);
+		if (!self->rx_buffer) {
+			fast_session_free(self);
+			return NULL;
+		}
+
+		if (fast_session_batch_init(self, cfg->batch_size)) {
+			fast_session_free(self);
+			return NULL;
+		}
+	} else {
+		if (cfg->rx_buffer_type == BUFFER_TYPE_MIRROR)
+			self->rx_buffer	= buffer_mirror_new(FAST_RECV_BUFFER_SIZE);
+		else
+			self->rx_buffer	= buffer_new(FAST_RECV_BUFFER_SIZE);
+		if (!self->rx_buffer) {
+			fast_session_free(self);
+			return NULL;
+		}
+	}
+
 	self->tx_message_buffer		= buffer_new(FAST_TX_BUFFER_SIZE);
 	if (!self->tx_message_buffer) {
 		fast_session_free(self);
@@ -53,11 +149,6 @@ struct fast_session *fast_session_new(struct fast_session_cfg *cfg)
 	} else
 		self->preamble.nr_bytes = cfg->preamble_bytes;
 
-	if (fstat(cfg->sockfd, &statbuf)) {
-		fast_session_free(self);
-		return NULL;
-	}
-
 	if (!S_ISSOCK(statbuf.st_mode)) {
 		self->send = xwritev0;
 		self->recv = buffer_nread0;
@@ -84,9 +175,83 @@ void fast_session_free(struct fast_session *self)
 	buffer_delete(self->tx_message_buffer);
 	buffer_delete(self->tx_pmap_buffer);
 	buffer_delete(self->rx_buffer);
+	free(self->rx_packets);
+	free(self->rx_controls);
+	free(self->rx_iovs);
+	free(self->rx_mmsgs);
 	free(self);
 }
 
+/*
+ * Point the rx buffer at the next received datagram. Decoder state left
+ * over from a truncated or garbled packet is dropped so that every packet
+ * is decoded on its own.
+ */
+static void fast_session_next_packet(struct fast_session *self)
+{
+	struct buffer *buffer = self->rx_buffer;
+	int i = self->packet++;
+
+	buffer->data		= self->rx_packets + i * FAST_MESSAGE_MAX_SIZE;
+	buffer->start		= 0;
+	buffer->end		= self->rx_mmsgs[i].msg_len;
+	buffer->capacity	= FAST_MESSAGE_MAX_SIZE;
+
+	if (self->rx_timestamps && !rx_timestamp_get(&self->rx_mmsgs[i].msg_hdr, &self->rx_timestamp))
+		self->rx_timestamp = (struct timespec) { 0, 0 };
+
+	if (self->rx_message)
+		self->rx_message->decoded = 0;
+
+	self->rx_message	= NULL;
+	self->preamble.is_valid	= false;
+	self->pmap.is_valid	= false;
+}
+
+static struct fast_message *fast_session_recv_batch(struct fast_session *self, int flags)
+{
+	struct fast_message *msg;
+	int nr;
+
+	for (;;) {
+		msg = fast_message_decode(self);
+		if (msg) {
+			msg->rx_timestamp = self->rx_timestamp;
+			self->nr_recv_messages++;
+			return msg;
+		}
+
+		if (self->packet < self->nr_packets) {
+			fast_session_next_packet(self);
+			continue;
+		}
+
+		/* recvmmsg() shrinks msg_controllen to what was used. */
+		if (self->rx_controls) {
+			int i;
+
+			for (i = 0; i < self->batch_size; i++)
+				self->rx_mmsgs[i].msg_hdr.msg_controllen = RX_TIMESTAMP_CMSG_SPACE;
+		}
+
+		/* A blocking receive returns once a datagram is in, not a full batch. */
+		if (!(flags & MSG_DONTWAIT))
+			flags |= MSG_WAITFORONE;
+
+		nr = recvmmsg(self->sockfd, self->rx_mmsgs, self->batch_size, flags, NULL);
+		if (nr <= 0)
+			return NULL;
+
+		self->nr_recv_calls++;
+		self->nr_recv_packets += nr;
+
+		self->nr_packets	= nr;
+		self->packet		= 0;
+
+		fast_session_next_packet(self);
+	}
+}
+
 struct fast_message *fast_session_recv(struct fast_session *self, int flags)
 {
 	struct buffer *buffer = self->rx_buffer;
@@ -94,9 +259,12 @@ struct fast_message *fast_session_recv(struct fast_session *self, int flags)
 	size_t size;
 	ssize_t nr;
 
+	if (self->batch_size)
+		return fast_session_recv_batch(self, flags);
+
 	msg = fast_message_decode(self);
 	if (msg)
-		return msg;
+		goto done;
 
 	size = buffer_remaining(buffer);
 	if (size <= FAST_MESSAGE_MAX_SIZE)
@@ -107,11 +275,25 @@ struct fast_message *fast_session_recv(struct fast_session *self, int flags)
 	* 2 times FAST_MESSAGE_MAX_SIZE then,
 	* remaining > FAST_MESSAGE_MAX_SIZE
 	*/
-	nr = self->recv(buffer, self->sockfd, FAST_MESSAGE_MAX_SIZE, flags);
+	if (self->rx_timestamps)
+		nr = buffer_recv_ts(buffer, self->sockfd, FAST_MESSAGE_MAX_SIZE, flags, &self->rx_timestamp);
+	else
+		nr = self->recv(buffer, self->sockfd, FAST_MESSAGE_MAX_SIZE, flags);
 	if (nr <= 0)
 		return NULL;
 
-	return fast_message_decode(self);
+	self->nr_recv_calls++;
+	self->nr_recv_packets++;
+
+	msg = fast_message_decode(self);
+	if (!msg)
+		return NULL;
+
+done:
+	msg->rx_timestamp = self->rx_timestamp;
+	self->nr_recv_messages++;
+
+	return msg;
 }
 
 int fast_session_send(struct fast_session *self, struct fast_message *msg, int flags)
@@ -0,0 +1,181 @@
+#include "libtrading/proto/fix_journal.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define FIX_JOURNAL_DEFAULT_SIZE	(64UL * 1024 * 1024)
+#define FIX_JOURNAL_DEFAULT_MAX_MSGS	(1024UL * 1024)
+
+void fix_journal_cfg_init(struct fix_journal_cfg *cfg)
+{
+	memset(cfg, 0, sizeof(*cfg));
+
+	cfg->size	= FIX_JOURNAL_DEFAULT_SIZE;
+	cfg->max_msgs	= FIX_JOURNAL_DEFAULT_MAX_MSGS;
+}
+
+/*
+ * Open the journal at cfg->path, creating it if it doesn't exist. An
+ * existing journal must have been created with the same size and
+ * max_msgs; its messages are kept.
+ */
+struct fix_journal *fix_journal_new(const struct fix_journal_cfg *cfg)
+{
+	struct fix_journal_header *header;
+	struct fix_journal *self;
+	struct stat st;
+	size_t map_size;
+	void *p;
+	int fd;
+
+	if (!cfg->size || cfg->size > UINT32_MAX || !cfg->max_msgs)
+		return NULL;
+
+	map_size = sizeof(*header) + cfg->max_msgs * sizeof(struct fix_journal_entry) + cfg->size;
+
+	self = calloc(1, sizeof(*self));
+	if (!self)
+		return NULL;
+
+	fd = open(cfg->path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		goto fail_open;
+
+	if (fstat(fd, &st) < 0)
+		goto fail_map;
+
+	if (!st.st_size && ftruncate(fd, map_size) < 0)
+		goto fail_map;
+	else if (st.st_size && (size_t) st.st_size != map_size)
+		goto fail_map;
+
+	p = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (p == MAP_FAILED)
+		goto fail_map;
+
+	close(fd);
+
+	header = p;
+
+	if (!header->magic) {
+		header->size		= cfg->size;
+		header->max_msgs	= cfg->max_msgs;
+		header->magic		= FIX_JOURNAL_MAGIC;
+	} else if (header->magic != FIX_JOURNAL_MAGIC || header->size != cfg->size || header->max_msgs != cfg->max_msgs) {
+		munmap(p, map_size);
+		goto fail_open;
+	}
+
+	self->header	= header;
+	self->index	= (void *) (header + 1);
+	self->data	= (char *) (self->index + header->max_msgs);
+	self->map_size	= map_size;
+
+	return self;
+
+fail_map:
+	close(fd);
+fail_open:
+	free(self);
+	return NULL;
+}
+
+void fix_journal_free(struct fix_journal *self)
+{
+	if (!self)
+		return;
+
+	munmap(self->header, self->map_size);
+	free(self);
+}
+
+/* Drop every message, e.g. when the sequence numbers start over. */
+void fix_journal_reset(struct fix_journal *self)
+{
+	struct fix_journal_header *header = self->header;
+
+	header->nr_msgs		= 0;
+	header->end		= 0;
+	header->first_seq_num	= 0;
+}
+
+/*
+ * Copy a serialized message into the journal. MsgSeqNums only go up: one
+ * that isn't past the last message journaled means that the sequence
+ * numbers were reset, and the journal starts over from it. Returns -1
+ * when the journal is full.
+ */
+int fix_journal_append(struct fix_journal *self, unsigned long msg_seq_num, const struct iovec *iov, int iovcnt)
+{
+	struct fix_journal_header *header = self->header;
+	unsigned long pos;
+	size_t len = 0;
+	char *dst;
+	int i;
+
+	if (header->nr_msgs && (msg_seq_num < header->first_seq_num ||
+				msg_seq_num - header->first_seq_num < header->nr_msgs))
+		fix_journal_reset(self);
+
+	if (!header->nr_msgs)
+		header->first_seq_num = msg_seq_num;
+
+	pos = msg_seq_num - header->first_seq_num;
+
+	if (pos >= header->max_msgs)
+		return -1;
+
+	for (i = 0; i < iovcnt; i++)
+		len += iov[i].iov_len;
+
+	if (header->end + len > header->size)
+		return -1;
+
+	dst = self->data + header->end;
+
+	for (i = 0; i < iovcnt; i++) {
+		memcpy(dst, iov[i].iov_base, iov[i].iov_len);
+		dst += iov[i].iov_len;
+	}
+
+	/* Skipped sequence numbers have no message. */
+	memset(&self->index[header->nr_msgs], 0, (pos - header->nr_msgs) * sizeof(*self->index));
+
+	self->index[pos] = (struct fix_journal_entry) {
+		.offset	= header->end,
+		.len	= len,
+	};
+
+	/* Publish the message only once its bytes are in place. */
+	header->end	+= len;
+	header->nr_msgs	 = pos + 1;
+
+	return 0;
+}
+
+/* The message sent as 'msg_seq_num', or NULL if it isn't journaled. */
+const char *fix_journal_get(struct fix_journal *self, unsigned long msg_seq_num, size_t *len)
+{
+	struct fix_journal_header *header = self->header;
+	struct fix_journal_entry *entry;
+	unsigned long pos;
+
+	if (msg_seq_num < header->first_seq_num)
+		return NULL;
+
+	pos = msg_seq_num - header->first_seq_num;
+	if (pos >= header->nr_msgs)
+		return NULL;
+
+	entry = &self->index[pos];
+	if (!entry->len)
+		return NULL;
+
+	*len = entry->len;
+
+	return self->data + entry->offset;
+}
@@ -0,0 +1,284 @@
+#include "libtrading/proto/fix_log.h"
+
+#include "libtrading/proto/fix_message.h"
+#include "libtrading/read-write.h"
+
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <stdio.h>
+
+#define FIX_LOG_DEFAULT_RING_SIZE	(4UL * 1024 * 1024)
+#define FIX_LOG_IDLE_USEC		100
+
+/* Records start at multiples of the header size, so that padding fits one. */
+#define FIX_LOG_RECORD_ALIGN		32UL
+#define FIX_LOG_ALIGN(size)		(((size) + FIX_LOG_RECORD_ALIGN - 1) & ~(FIX_LOG_RECORD_ALIGN - 1))
+
+#define FIX_LOG_PAD			UINT_MAX	/* dir of the filler up to the end of the ring */
+
+struct fix_log_record {
+	u32			size;	/* of the record, header included */
+	u32			len;	/* of the message */
+	u32			dir;
+	struct timespec		ts;
+	char			msg[];
+};
+
+void fix_log_cfg_init(struct fix_log_cfg *cfg)
+{
+	memset(cfg, 0, sizeof(*cfg));
+
+	cfg->ring_size	= FIX_LOG_DEFAULT_RING_SIZE;
+	cfg->full	= FIX_LOG_FULL_DROP;
+}
+
+static int fix_log_open(struct fix_log *self)
+{
+	char name[PATH_MAX];
+	struct stat st;
+
+	snprintf(name, sizeof(name), "%s.%lu", self->path, self->file_index);
+
+	self->fd = open(name, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (self->fd < 0)
+		return -1;
+
+	if (fstat(self->fd, &st) < 0)
+		return -1;
+
+	self->file_size = st.st_size;
+
+	return 0;
+}
+
+static void fix_log_rotate(struct fix_log *self)
+{
+	close(self->fd);
+
+	self->file_index++;
+
+	if (fix_log_open(self) < 0)
+		self->nr_errors++;
+}
+
+/* Hand the records between 'tail' and 'head' to writev(), at most a batch. */
+static u64 fix_log_flush(struct fix_log *self, struct fix_timestamp *timestamp, u64 tail, u64 head)
+{
+	static const char *dirs[] = {
+		[FIX_LOG_IN]	= "IN ",
+		[FIX_LOG_OUT]	= "OUT",
+	};
+	unsigned int len = fix_timestamp_len(timestamp);
+	int iovcnt = 0;
+	int nr = 0;
+	ssize_t ret;
+
+	while (tail != head && nr < FIX_LOG_BATCH) {
+		struct fix_log_record *rec = (void *) (self->ring + (tail & (self->ring_size - 1)));
+		char *prefix = self->prefix[nr];
+
+		tail += rec->size;
+
+		if (rec->dir == FIX_LOG_PAD)
+			continue;
+
+		fix_timestamp_update(timestamp, &rec->ts);
+
+		memcpy(prefix, timestamp->str, len);
+		prefix[len] = ' ';
+		memcpy(prefix + len + 1, dirs[rec->dir], 3);
+		prefix[len + 4] = ' ';
+
+		self->iov[iovcnt++] = (struct iovec) { prefix, len + 5 };
+		self->iov[iovcnt++] = (struct iovec) { rec->msg, rec->len };
+		self->iov[iovcnt++] = (struct iovec) { (void *) "\n", 1 };
+
+		nr++;
+	}
+
+	if (iovcnt) {
+		ret = xwritev(self->fd, self->iov, iovcnt);
+		if (ret < 0) {
+			self->nr_errors++;
+		} else {
+			self->file_size	+= ret;
+			self->nr_written += nr;
+		}
+	}
+
+	return tail;
+}
+
+static void *fix_log_thread(void *arg)
+{
+	char str[FIX_TIMESTAMP_LEN(FIX_TIME_NANO)];
+	struct fix_timestamp timestamp;
+	struct fix_log *self = arg;
+
+	fix_timestamp_init(&timestamp, str, FIX_TIME_NANO);
+
+	for (;;) {
+		bool stop = __atomic_load_n(&self->stop, __ATOMIC_ACQUIRE);
+		u64 head = __atomic_load_n(&self->head, __ATOMIC_ACQUIRE);
+		u64 tail = self->tail;
+
+		if (tail == head) {
+			if (stop)
+				break;
+
+			usleep(FIX_LOG_IDLE_USEC);
+			continue;
+		}
+
+		tail = fix_log_flush(self, &timestamp, tail, head);
+
+		/* The records are in the file, their room can be reused. */
+		__atomic_store_n(&self->tail, tail, __ATOMIC_RELEASE);
+
+		if (self->rotate_size && self->file_size >= self->rotate_size)
+			fix_log_rotate(self);
+	}
+
+	return NULL;
+}
+
+/*
+ * Start logging to <cfg->path>.<n>, appending to the highest numbered
+ * file that already exists.
+ */
+struct fix_log *fix_log_new(const struct fix_log_cfg *cfg)
+{
+	struct fix_log *self;
+	char name[PATH_MAX];
+
+	if (cfg->ring_size < 4 * FIX_LOG_RECORD_ALIGN || (cfg->ring_size & (cfg->ring_size - 1)))
+		return NULL;
+
+	self = calloc(1, sizeof(*self));
+	if (!self)
+		return NULL;
+
+	self->ring = malloc(cfg->ring_size);
+	if (!self->ring)
+		goto fail_ring;
+
+	self->ring_size		= cfg->ring_size;
+	self->full		= cfg->full;
+	self->path		= cfg->path;
+	self->rotate_size	= cfg->rotate_size;
+
+	for (;;) {
+		snprintf(name, sizeof(name), "%s.%lu", self->path, self->file_index + 1);
+		if (access(name, F_OK))
+			break;
+
+		self->file_index++;
+	}
+
+	if (fix_log_open(self) < 0)
+		goto fail_open;
+
+	if (pthread_create(&self->thread, NULL, fix_log_thread, self))
+		goto fail_thread;
+
+	return self;
+
+fail_thread:
+	close(self->fd);
+fail_open:
+	free(self->ring);
+fail_ring:
+	free(self);
+	return NULL;
+}
+
+/* Write out the records still in the ring and stop the writer thread. */
+void fix_log_free(struct fix_log *self)
+{
+	if (!self)
+		return;
+
+	__atomic_store_n(&self->stop, true, __ATOMIC_RELEASE);
+
+	pthread_join(self->thread, NULL);
+
+	close(self->fd);
+	free(self->ring);
+	free(self);
+}
+
+/*
+ * Queue a message for the writer thread. Called from the session thread
+ * only. Returns -1 if the record was dropped.
+ */
+int fix_log_write(struct fix_log *self, enum fix_log_dir dir, const struct iovec *iov, int iovcnt)
+{
+	struct fix_log_record *rec;
+	size_t size, offset, pad;
+	u64 head = self->head;
+	size_t len = 0;
+	char *dst;
+	int i;
+
+	for (i = 0; i < iovcnt; i++)
+		len += iov[i].iov_len;
+
+	size = FIX_LOG_ALIGN(sizeof(*rec) + len);
+
+	if (size > self->ring_size / 2) {
+		self->nr_dropped++;
+		return -1;
+	}
+
+	/* Records don't wrap: skip to the start of the ring if need be. */
+	offset	= head & (self->ring_size - 1);
+	pad	= offset + size > self->ring_size ? self->ring_size - offset : 0;
+
+	while (head + pad + size - self->tail_cache > self->ring_size) {
+		self->tail_cache = __atomic_load_n(&self->tail, __ATOMIC_ACQUIRE);
+
+		if (head + pad + size - self->tail_cache <= self->ring_size)
+			break;
+
+		if (self->full == FIX_LOG_FULL_DROP) {
+			self->nr_dropped++;
+			return -1;
+		}
+
+		sched_yield();
+	}
+
+	if (pad) {
+		rec = (void *) (self->ring + offset);
+
+		rec->size	= pad;
+		rec->dir	= FIX_LOG_PAD;
+
+		head	+= pad;
+		offset	 = 0;
+	}
+
+	rec = (void *) (self->ring + offset);
+
+	rec->size	= size;
+	rec->len	= len;
+	rec->dir	= dir;
+
+	clock_gettime(CLOCK_REALTIME, &rec->ts);
+
+	dst = rec->msg;
+
+	for (i = 0; i < iovcnt; i++) {
+		memcpy(dst, iov[i].iov_base, iov[i].iov_len);
+		dst += iov[i].iov_len;
+	}
+
+	__atomic_store_n(&self->head, head + size, __ATOMIC_RELEASE);
+
+	return 0;
+}
@@ -4,11 +4,15 @@
 #include "libtrading/read-write.h"
 #include "libtrading/buffer.h"
 #include "libtrading/array.h"
+#include "libtrading/arena.h"
 #include "libtrading/trace.h"
 #include "libtrading/itoa.h"
+#include "libtrading/scan.h"
 
 #include "modp_numtoa.h"
 
+#include "fix_parse.h"
+
 #include <sys/socket.h>
 #include <inttypes.h>
 #include <sys/uio.h>
@@ -128,99 +132,178 @@ inline int fix_uatoi(const char *p, const char **end)
 	return ret;
 }
 
-static int parse_tag(struct buffer *self, int *tag)
+/*
+ * Parse "[-]digits[.digits]" into a fixed-point decimal. Significant digits
+ * past FIX_DECIMAL_MAX_DIGITS do not fit in the mantissa: they are dropped
+ * from the fraction, or counted in the exponent in the integer part.
+ */
+struct fix_decimal fix_decimal_parse(const char *p, const char **end)
 {
-	const char *delim;
-	const char *start;
-	const char *end;
-	int ret;
+	struct fix_decimal ret = { 0, 0 };
+	bool neg = false;
+	int digits = 0;
 
-	start = buffer_start(self);
-	delim = buffer_find(self, '=');
+	if (*p == '-') {
+		neg = true;
+		p++;
+	}
 
-	if (!delim || *delim != '=')
-		return FIX_MSG_STATE_PARTIAL;
-	ret = fix_uatoi(start, &end);
-	if (end != delim)
-		return FIX_MSG_STATE_GARBLED;
+	for (; *p >= '0' && *p <= '9'; p++) {
+		if (digits < FIX_DECIMAL_MAX_DIGITS) {
+			ret.mantissa = ret.mantissa * 10 + (*p - '0');
+			digits += ret.mantissa != 0;
+		} else if (ret.exponent < INT8_MAX)
+			ret.exponent++;
+	}
 
-	buffer_advance(self, 1);
+	if (*p == '.') {
+		for (p++; *p >= '0' && *p <= '9'; p++) {
+			if (digits >= FIX_DECIMAL_MAX_DIGITS || -ret.exponent >= FIX_DECIMAL_MAX_DIGITS)
+				continue;
 
-	*tag = ret;
+			ret.mantissa = ret.mantissa * 10 + (*p - '0');
+			digits += ret.mantissa != 0;
+			ret.exponent--;
+		}
+	}
 
-	return 0;
+	if (neg)
+		ret.mantissa = -ret.mantissa;
+
+	if (end)
+		*end = p;
+
+	return ret;
 }
 
-static int parse_value(struct buffer *self, const char **value)
+/* Format 'value' into 's' with exactly -exponent fraction digits. */
+int fix_decimal_unparse(struct fix_decimal value, char *s)
 {
-	char *start, *end;
+	char digits[20];
+	int len = 0, n = 0;
+	int frac;
+	u64 m;
+
+	if (value.mantissa < 0) {
+		s[len++] = '-';
+		m = -(u64) value.mantissa;
+	} else
+		m = value.mantissa;
 
-	start = buffer_start(self);
+	do {
+		digits[n++] = '0' + m % 10;
+		m /= 10;
+	} while (m);
 
-	end = buffer_find(self, 0x01);
+	if (value.exponent >= 0) {
+		while (n)
+			s[len++] = digits[--n];
 
-	if (!end || *end != 0x01)
-		return FIX_MSG_STATE_PARTIAL;
+		for (frac = 0; frac < value.exponent; frac++)
+			s[len++] = '0';
 
-	buffer_advance(self, 1);
+		return len;
+	}
 
-	*value = start;
+	frac = -value.exponent;
 
-	return 0;
-}
+	if (n <= frac)
+		s[len++] = '0';
 
-static void next_tag(struct buffer *self)
-{
-	char *delim;
+	while (n > frac)
+		s[len++] = digits[--n];
 
-	delim = buffer_find(self, 0x01);
+	s[len++] = '.';
 
-	if (!delim)
-		return;
+	for (; frac > n; frac--)
+		s[len++] = '0';
 
-	if (*delim != 0x01)
-		return;
+	while (n)
+		s[len++] = digits[--n];
 
-	buffer_advance(self, 1);
+	return len;
 }
 
-static int match_field(struct buffer *self, int tag, const char **value)
+/*
+ * Nearest double to 'value' as long as the mantissa and the power of ten
+ * are both exact in a double, i.e. up to 15 digits and exponents of +-22.
+ */
+double fix_decimal_to_double(struct fix_decimal value)
 {
-	int ptag, ret;
+	static const double pow10[] = {
+		1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+	};
+	double ret = value.mantissa;
+	int exp = value.exponent;
 
-	ret = parse_tag(self, &ptag);
+	for (; exp > 22; exp -= 22)
+		ret *= pow10[22];
 
-	if (ret)
-		goto fail;
-	else if (ptag != tag) {
-		ret = FIX_MSG_STATE_GARBLED;
-		goto fail;
-	}
+	for (; exp < -22; exp += 22)
+		ret /= pow10[22];
 
-	return parse_value(self, value);
+	if (exp >= 0)
+		return ret * pow10[exp];
 
-fail:
-	next_tag(self);
-	return ret;
+	return ret / pow10[-exp];
 }
 
-static int parse_field(struct buffer *self, int *tag, const char **value)
+static const unsigned long fix_time_divisors[] = {
+	[FIX_TIME_MILLI]	= 1000000,
+	[FIX_TIME_MICRO]	= 1000,
+	[FIX_TIME_NANO]		= 1,
+};
+
+/* Anything but milli-, micro- or nanoseconds means milliseconds. */
+void fix_timestamp_init(struct fix_timestamp *self, char *str, enum fix_time_precision precision)
 {
-	int ret;
+	if (precision != FIX_TIME_MICRO && precision != FIX_TIME_NANO)
+		precision = FIX_TIME_MILLI;
 
-	ret = parse_tag(self, tag);
+	self->str	= str;
+	self->precision	= precision;
+	self->minute	= -1;
+}
 
-	if (ret)
-		goto fail;
+int fix_timestamp_update(struct fix_timestamp *self, const struct timespec *realtime)
+{
+	time_t minute = realtime->tv_sec - realtime->tv_sec % 60;
+	unsigned int sec = realtime->tv_sec - minute;
+	unsigned long frac;
+	char *p;
+	int i;
 
-	return parse_value(self, value);
+	if (minute != self->minute) {
+		struct tm tm;
 
-fail:
-	next_tag(self);
-	return ret;
+		if (!gmtime_r(&minute, &tm))
+			return -1;
+
+		/* The terminator lands where the seconds go. */
+		if (strftime(self->str, sizeof("YYYYMMDD-HH:MM:"), "%Y%m%d-%H:%M:", &tm) != 15)
+			return -1;
+
+		self->minute = minute;
+	}
+
+	p = self->str + 15;
+
+	p[0] = '0' + sec / 10;
+	p[1] = '0' + sec % 10;
+	p[2] = '.';
+
+	frac = realtime->tv_nsec / fix_time_divisors[self->precision];
+
+	for (i = self->precision + 2; i > 2; i--) {
+		p[i] = '0' + frac % 10;
+		frac /= 10;
+	}
+
+	return 0;
 }
 
-static enum fix_type fix_tag_type(int tag)
+fix_parse_inline enum fix_type fix_tag_type(int tag)
 {
 	switch (tag) {
 	case CheckSum:			return FIX_TYPE_CHECKSUM;
@@ -233,6 +316,7 @@ static enum fix_type fix_tag_type(int tag)
 	case RptSeq:			return FIX_TYPE_INT;
 	case GapFillFlag:		return FIX_TYPE_STRING;
 	case PossDupFlag:		return FIX_TYPE_STRING;
+	case OrigSendingTime:		return FIX_TYPE_STRING;
 	case SecurityID:		return FIX_TYPE_STRING;
 	case TestReqID:			return FIX_TYPE_STRING;
 	case MsgSeqNum:			return FIX_TYPE_MSGSEQNUM;
@@ -251,6 +335,7 @@ static enum fix_type fix_tag_type(int tag)
 	case ExecTransType:		return FIX_TYPE_STRING;
 	case OrigClOrdID:		return FIX_TYPE_STRING;
 	case MDEntryType:		return FIX_TYPE_STRING;
+	case NoMDEntries:		return FIX_TYPE_GROUP;
 	case OrdStatus:			return FIX_TYPE_STRING;
 	case ExecType:			return FIX_TYPE_STRING;
 	case Password:			return FIX_TYPE_STRING;
@@ -268,44 +353,181 @@ static enum fix_type fix_tag_type(int tag)
 	}
 }
 
-static void rest_of_message(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer)
+static const int fix_md_entry_members[] = {
+	MDUpdateAction, MDEntryType, MDEntryID, MDEntryPx, MDEntrySize, MDEntryTime,
+	MDPriceLevel, NumberOfOrders, Symbol, SecurityID, RptSeq, TradingSessionID, 0,
+};
+
+static const struct fix_group_def fix_md_entries = { NoMDEntries, fix_md_entry_members };
+
+static const struct fix_group_def *fix_group_def(int tag)
+{
+	switch (tag) {
+	case NoMDEntries:		return &fix_md_entries;
+	default:			return NULL;
+	}
+}
+
+static void fix_tag_index_reset(struct fix_tag_index *index)
+{
+	if (!++index->gen) {
+		memset(index->direct, 0, sizeof(index->direct));
+		memset(index->hash, 0, sizeof(index->hash));
+		index->gen = 1;
+	}
+
+	index->nr_fields	= 0;
+	index->nr_hashed	= 0;
+	index->overflow		= false;
+}
+
+/*
+ * The fields array is the caller's own: parse into it up to
+ * FIX_MAX_FIELD_NUMBER fields. Group entries still come from the arena,
+ * groups are only recorded if the caller also set the groups array.
+ */
+static unsigned long fix_message_prepare_caller(struct fix_message *self)
+{
+	if (self->arena && self->arena_fields) {
+		arena_reset(self->arena);
+
+		self->arena_fields	= NULL;
+		self->group_entries	= NULL;
+		self->max_fields	= 0;
+	}
+
+	if (self->arena && !self->group_entries)
+		self->group_entries = arena_alloc(self->arena, FIX_MAX_FIELD_NUMBER * sizeof(unsigned long));
+
+	return FIX_MAX_FIELD_NUMBER;
+}
+
+/*
+ * Start over with empty fields and room for every field that the bytes
+ * from 'start' to 'end' can hold, so that add_field() never runs out of
+ * space in the arena. A field takes at least two bytes, "=\x01". The arena
+ * is only reset when the arrays of an earlier message are too small.
+ * Returns the room in the fields array, 0 if there is none.
+ */
+unsigned long fix_message_prepare(struct fix_message *self, const char *start, const char *end)
 {
-	int tag = 0;
-	const char *tag_ptr = NULL;
-	unsigned long nr_fields = 0;
-	enum fix_type type;
+	unsigned long nr = (end - start) / 2 + 1;
 
 	self->nr_fields = 0;
+	self->nr_groups = 0;
 
-retry:
-	if (parse_field(buffer, &tag, &tag_ptr))
-		return;
+	if (self->index)
+		fix_tag_index_reset(self->index);
 
-	type = dialect->tag_type(tag);
+	if (self->fields && self->fields != self->arena_fields)
+		return fix_message_prepare_caller(self);
 
-	switch (type) {
-	case FIX_TYPE_INT:
-		self->fields[nr_fields++] = FIX_INT_FIELD(tag, fix_atoi64(tag_ptr, NULL));
-		goto retry;
-	case FIX_TYPE_FLOAT:
-		self->fields[nr_fields++] = FIX_FLOAT_FIELD(tag, strtod(tag_ptr, NULL));
-		goto retry;
-	case FIX_TYPE_CHAR:
-		self->fields[nr_fields++] = FIX_CHAR_FIELD(tag, tag_ptr[0]);
-		goto retry;
-	case FIX_TYPE_STRING:
-		self->fields[nr_fields++] = FIX_STRING_FIELD(tag, tag_ptr);
-		goto retry;
-	case FIX_TYPE_CHECKSUM:
-		break;
-	case FIX_TYPE_MSGSEQNUM:
-		self->msg_seq_num = fix_uatoi(tag_ptr, NULL);
-		goto retry;
-	default:
-		goto retry;
+	if (nr <= self->max_fields && self->group_entries)
+		return self->max_fields;
+
+	if (!self->arena)
+		return 0;
+
+	arena_reset(self->arena);
+
+	self->fields		= arena_alloc(self->arena, nr * sizeof(struct fix_field));
+	self->group_entries	= arena_alloc(self->arena, nr * sizeof(unsigned long));
+	self->arena_fields	= self->fields;
+	self->max_fields	= 0;
+
+	if (!self->fields || !self->group_entries)
+		return 0;
+
+	self->max_fields	= nr;
+
+	return nr;
+}
+
+static bool fix_group_member(const struct fix_group_def *def, int tag)
+{
+	const int *member;
+
+	for (member = def->members; *member; member++) {
+		if (*member == tag)
+			return true;
+	}
+
+	return false;
+}
+
+/* Track group entries as field 'tag' is stored at index state->nr_fields. */
+static void fix_group_add_field(struct fix_message *self, struct fix_parse_state *state, int tag)
+{
+	struct fix_group *group = state->group;
+
+	if (tag != state->delim_tag) {
+		if (!fix_group_member(state->def, tag))
+			goto end;
+
+		/* Rest of the current entry */
+		if (state->delim_tag)
+			return;
+
+		state->delim_tag = tag;
 	}
 
-	self->nr_fields = nr_fields;
+	if (group->nr_entries == group->count)
+		goto end;
+
+	self->group_entries[state->nr_entries++] = state->nr_fields;
+	group->nr_entries++;
+
+	return;
+
+end:
+	group->end	= state->nr_fields;
+	state->group	= NULL;
+}
+
+static void fix_group_start(struct fix_message *self, struct fix_dialect *dialect, struct fix_parse_state *state, struct fix_field *field)
+{
+	const struct fix_group_def *def;
+	struct fix_group *group;
+
+	if (state->group || state->nr_groups == FIX_MAX_GROUP_NUMBER || !dialect->group_def || !self->groups || !self->group_entries)
+		return;
+
+	def = dialect->group_def(field->tag);
+	if (!def)
+		return;
+
+	group = &self->groups[state->nr_groups++];
+
+	group->tag		= field->tag;
+	group->count		= field->int_value > 0 ? field->int_value : 0;
+	group->nr_entries	= 0;
+	group->entries		= self->group_entries + state->nr_entries;
+	group->end		= state->nr_fields + 1;
+
+	state->group		= group;
+	state->def		= def;
+	state->delim_tag	= 0;
+}
+
+/* Group bookkeeping for the field just stored at index state->nr_fields */
+void fix_group_field(struct fix_message *self, struct fix_dialect *dialect, struct fix_parse_state *state, enum fix_type type)
+{
+	struct fix_field *field = &self->fields[state->nr_fields];
+
+	if (state->group)
+		fix_group_add_field(self, state, field->tag);
+
+	if (type == FIX_TYPE_GROUP)
+		fix_group_start(self, dialect, state, field);
+}
+
+void fix_parse_finish(struct fix_message *self, struct fix_parse_state *state)
+{
+	if (state->group)
+		state->group->end = state->nr_fields;
+
+	self->nr_fields	= state->nr_fields;
+	self->nr_groups	= state->nr_groups;
 }
 
 static bool verify_checksum(struct fix_message *self, struct buffer *buffer)
@@ -437,6 +659,11 @@ exit:
 	return ret;
 }
 
+static int fix_dialect_parse_body(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
+{
+	return fix_parse_body(self, dialect, fix_tag_type, buffer, flags);
+}
+
 int fix_message_parse(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
 {
 	const char *start;
@@ -457,12 +684,20 @@ retry:
 	if (ret)
 		goto fail;
 
-	ret = checksum(self, buffer, flags);
+	if (!(flags & FIX_PARSE_FLAG_ONE_PASS)) {
+		ret = checksum(self, buffer, flags);
+		if (ret)
+			goto fail;
+	}
+
+	/* Dialects without a parser of their own go through tag_type(). */
+	if (dialect->parse_body)
+		ret = dialect->parse_body(self, dialect, buffer, flags);
+	else
+		ret = fix_parse_body(self, dialect, dialect->tag_type, buffer, flags);
 	if (ret)
 		goto fail;
 
-	rest_of_message(self, dialect, buffer);
-
 	self->iov[0].iov_base	= (void *)start;
 	self->iov[0].iov_len 	= buffer_start(buffer) - start;
 
@@ -485,12 +720,41 @@ int fix_get_field_count(struct fix_message *self) {
 	return self->nr_fields;
 }
 
+/* Convert a FIX_PARSE_FLAG_LAZY field on first access and cache the value. */
+static struct fix_field *fix_field_convert(struct fix_field *field)
+{
+	if (!field || !field->lazy)
+		return field;
+
+	switch (field->type) {
+	case FIX_TYPE_INT:
+		field->int_value = fix_atoi64(field->string_value, NULL);
+		break;
+	case FIX_TYPE_FLOAT:
+		field->float_value = strtod(field->string_value, NULL);
+		break;
+	case FIX_TYPE_DECIMAL: {
+		struct fix_decimal decimal = fix_decimal_parse(field->string_value, NULL);
+
+		field->decimal_mantissa = decimal.mantissa;
+		field->decimal_exponent = decimal.exponent;
+		break;
+	}
+	default:
+		break;
+	}
+
+	field->lazy = false;
+
+	return field;
+}
+
 struct fix_field *fix_get_field_at(struct fix_message *self, int i)
 {
-	return i < self->nr_fields ? &self->fields[i] : NULL;
+	return i < self->nr_fields ? fix_field_convert(&self->fields[i]) : NULL;
 }
 
-struct fix_field *fix_get_field(struct fix_message *self, int tag)
+static struct fix_field *fix_find_field(struct fix_message *self, int tag)
 {
 	unsigned long i;
 
@@ -502,6 +766,42 @@ struct fix_field *fix_get_field(struct fix_message *self, int tag)
 	return NULL;
 }
 
+static struct fix_field *fix_lookup_field(struct fix_message *self, int tag)
+{
+	struct fix_tag_index *index = self->index;
+	unsigned long h;
+
+	/* Fields added after parsing are not indexed. */
+	if (!index || index->nr_fields != self->nr_fields)
+		return fix_find_field(self, tag);
+
+	if ((unsigned int) tag < FIX_TAG_DIRECT_SIZE) {
+		struct fix_tag_slot *direct = &index->direct[tag];
+
+		if (direct->gen != index->gen)
+			return NULL;
+
+		return &self->fields[direct->pos];
+	}
+
+	for (h = fix_tag_hash(tag);; h = (h + 1) & (FIX_TAG_HASH_SIZE - 1)) {
+		struct fix_tag_hash_slot *slot = &index->hash[h];
+
+		if (slot->gen != index->gen)
+			break;
+
+		if (slot->tag == tag)
+			return &self->fields[slot->pos];
+	}
+
+	return index->overflow ? fix_find_field(self, tag) : NULL;
+}
+
+struct fix_field *fix_get_field(struct fix_message *self, int tag)
+{
+	return fix_field_convert(fix_lookup_field(self, tag));
+}
+
 void fix_message_validate(struct fix_message *self)
 {
 	// if MsgSeqNum is missing -> logout, terminate
@@ -531,9 +831,17 @@ const char *fix_get_string(struct fix_field *field, char *buffer, unsigned long
 	return buffer;
 }
 
+/* FIX_TYPE_DECIMAL fields are converted, see fix_decimal_to_double() */
 double fix_get_float(struct fix_message *self, int tag, double _default_) {
 	struct fix_field *field = fix_get_field(self, tag);
-	return field ? field->float_value : _default_;
+
+	if (!field)
+		return _default_;
+
+	if (field->type == FIX_TYPE_DECIMAL)
+		return fix_decimal_to_double(fix_field_decimal(field));
+
+	return field->float_value;
 }
 
 int64_t fix_get_int(struct fix_message *self, int tag, int64_t _default_)
@@ -548,6 +856,41 @@ char fix_get_char(struct fix_message *self, int tag, char _default_)
 	return field ? field->char_value : _default_;
 }
 
+struct fix_decimal fix_get_decimal(struct fix_message *self, int tag, struct fix_decimal _default_)
+{
+	struct fix_field *field = fix_get_field(self, tag);
+	return field ? fix_field_decimal(field) : _default_;
+}
+
+struct fix_group *fix_get_group(struct fix_message *self, int tag)
+{
+	unsigned long i;
+
+	for (i = 0; i < self->nr_groups; i++) {
+		if (self->groups[i].tag == tag)
+			return &self->groups[i];
+	}
+
+	return NULL;
+}
+
+struct fix_field *fix_group_get_field(struct fix_message *self, struct fix_group *group, unsigned long entry, int tag)
+{
+	unsigned long nr_fields, i;
+	struct fix_field *fields;
+
+	fields = fix_group_entry(self, group, entry, &nr_fields);
+	if (!fields)
+		return NULL;
+
+	for (i = 0; i < nr_fields; i++) {
+		if (fields[i].tag == tag)
+			return fix_field_convert(&fields[i]);
+	}
+
+	return NULL;
+}
+
 struct fix_message *fix_message_new(void)
 {
 	struct fix_message *self = calloc(1, sizeof *self);
@@ -555,8 +898,23 @@ struct fix_message *fix_message_new(void)
 	if (!self)
 		return NULL;
 
-	self->fields = calloc(FIX_MAX_FIELD_NUMBER, sizeof(struct fix_field));
-	if (!self->fields) {
+	self->arena = arena_new(FIX_ARENA_CHUNK_SIZE);
+	if (!self->arena) {
+		fix_message_free(self);
+		return NULL;
+	}
+
+	self->index = calloc(1, sizeof(struct fix_tag_index));
+	if (!self->index) {
+		fix_message_free(self);
+		return NULL;
+	}
+
+	/* Slots start out in generation zero, i.e. empty. */
+	self->index->gen = 1;
+
+	self->groups = calloc(FIX_MAX_GROUP_NUMBER, sizeof(struct fix_group));
+	if (!self->groups) {
 		fix_message_free(self);
 		return NULL;
 	}
@@ -564,21 +922,72 @@ struct fix_message *fix_message_new(void)
 	return self;
 }
 
+/* A fields array set by the caller is freed as well. */
 void fix_message_free(struct fix_message *self)
 {
 	if (!self)
 		return;
 
-	free(self->fields);
+	if (self->fields != self->arena_fields)
+		free(self->fields);
+
+	arena_delete(self->arena);
+	free(self->groups);
+	free(self->index);
 	free(self);
 }
 
+/* Drop all fields, e.g. to build an outbound message in a parsed one. */
+void fix_message_reset(struct fix_message *self)
+{
+	self->nr_fields	= 0;
+	self->nr_groups	= 0;
+
+	if (self->index)
+		fix_tag_index_reset(self->index);
+
+	if (self->arena && self->fields == self->arena_fields) {
+		arena_reset(self->arena);
+
+		self->fields		= NULL;
+		self->arena_fields	= NULL;
+		self->group_entries	= NULL;
+		self->max_fields	= 0;
+	}
+}
+
+/*
+ * Append a field, growing the fields array in the message's arena. A
+ * fields array set by the caller is assumed to hold FIX_MAX_FIELD_NUMBER.
+ */
 void fix_message_add_field(struct fix_message *self, struct fix_field *field)
 {
-	if (self->nr_fields < FIX_MAX_FIELD_NUMBER) {
-		self->fields[self->nr_fields] = *field;
-		self->nr_fields++;
+	if (self->fields && self->fields != self->arena_fields) {
+		if (self->nr_fields < FIX_MAX_FIELD_NUMBER)
+			self->fields[self->nr_fields++] = *field;
+		return;
+	}
+
+	if (!self->arena)
+		return;
+
+	if (self->nr_fields == self->max_fields) {
+		unsigned long nr = self->max_fields ? self->max_fields * 2 : FIX_MAX_FIELD_NUMBER;
+		struct fix_field *fields;
+
+		fields = arena_grow(self->arena, self->fields, self->nr_fields * sizeof(*fields), nr * sizeof(*fields));
+		if (!fields)
+			return;
+
+		self->fields		= fields;
+		self->arena_fields	= fields;
+		self->max_fields	= nr;
+
+		/* Sized for the old max_fields, the next parse allocates anew */
+		self->group_entries	= NULL;
 	}
+
+	self->fields[self->nr_fields++] = *field;
 }
 
 bool fix_message_type_is(struct fix_message *self, enum fix_msg_type type)
@@ -620,6 +1029,10 @@ bool fix_field_unparse(struct fix_field *self, struct buffer *buffer)
 		buffer->end += i64toa(self->int_value, buffer_end(buffer));
 		break;
 	}
+	case FIX_TYPE_DECIMAL: {
+		buffer->end += fix_decimal_unparse(fix_field_decimal(self), buffer_end(buffer));
+		break;
+	}
 	case FIX_TYPE_CHECKSUM: {
 		buffer->end += checksumtoa(self->int_value, buffer_end(buffer));
 		break;
@@ -718,26 +1131,38 @@ struct fix_dialect fix_dialects[] = {
 	[FIXT_1_1] = {
 		.version	= FIXT_1_1,
 		.tag_type	= fix_tag_type,
+		.group_def	= fix_group_def,
+		.parse_body	= fix_dialect_parse_body,
 	},
 	[FIX_4_4] = {
 		.version	= FIX_4_4,
 		.tag_type	= fix_tag_type,
+		.group_def	= fix_group_def,
+		.parse_body	= fix_dialect_parse_body,
 	},
 	[FIX_4_3] = {
 		.version	= FIX_4_3,
 		.tag_type	= fix_tag_type,
+		.group_def	= fix_group_def,
+		.parse_body	= fix_dialect_parse_body,
 	},
 	[FIX_4_2] = {
 		.version	= FIX_4_2,
 		.tag_type	= fix_tag_type,
+		.group_def	= fix_group_def,
+		.parse_body	= fix_dialect_parse_body,
 	},
 	[FIX_4_1] = {
 		.version	= FIX_4_1,
 		.tag_type	= fix_tag_type,
+		.group_def	= fix_group_def,
+		.parse_body	= fix_dialect_parse_body,
 	},
 	[FIX_4_0] = {
 		.version	= FIX_4_0,
 		.tag_type	= fix_tag_type,
+		.group_def	= fix_group_def,
+		.parse_body	= fix_dialect_parse_body,
 	},
 
 };
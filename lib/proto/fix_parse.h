@@ -0,0 +1,396 @@
+#ifndef LIBTRADING_FIX_PARSE_H
+#define LIBTRADING_FIX_PARSE_H
+
+/*
+ * FIX body parser, shared by fix_message.c and the sources that
+ * fixdialectc generates. The parser is instantiated once per dialect with
+ * that dialect's tag_type() so that the tag switch and the conversion of
+ * the value get inlined into the field loop. Not part of the public API.
+ */
+
+#include "libtrading/proto/fix_message.h"
+#include "libtrading/proto/fix_session.h"
+#include "libtrading/buffer.h"
+#include "libtrading/types.h"
+#include "libtrading/scan.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define fix_parse_inline	static inline __attribute__((always_inline))
+
+/*
+ * Tag to field lookup for parsed messages. Tags below FIX_TAG_DIRECT_SIZE
+ * map straight to a slot, the rest go to a small open-addressed hash.
+ * Slots carry the generation they were filled in, so that resetting the
+ * index for the next message is just a generation bump. Only the first
+ * occurrence of a repeated tag is indexed, which is the one a linear scan
+ * would find.
+ */
+#define FIX_TAG_DIRECT_SIZE	1024
+#define FIX_TAG_HASH_SIZE	64	/* power of two */
+
+struct fix_tag_slot {
+	u16				gen;
+	u16				pos;
+};
+
+struct fix_tag_hash_slot {
+	int				tag;
+	u16				gen;
+	u16				pos;
+};
+
+struct fix_tag_index {
+	u16				gen;
+	unsigned long			nr_fields;	/* fields seen since reset */
+	unsigned long			nr_hashed;
+	bool				overflow;	/* hash too full, some tags left out */
+	struct fix_tag_slot		direct[FIX_TAG_DIRECT_SIZE];
+	struct fix_tag_hash_slot	hash[FIX_TAG_HASH_SIZE];
+};
+
+static inline unsigned long fix_tag_hash(int tag)
+{
+	return ((u32) tag * 2654435761U) >> 26;
+}
+
+static inline void fix_tag_index_add(struct fix_tag_index *index, int tag, unsigned long pos)
+{
+	struct fix_tag_hash_slot *slot;
+	unsigned long h;
+
+	index->nr_fields++;
+
+	if ((unsigned int) tag < FIX_TAG_DIRECT_SIZE) {
+		struct fix_tag_slot *direct = &index->direct[tag];
+
+		if (direct->gen != index->gen) {
+			direct->gen = index->gen;
+			direct->pos = pos;
+		}
+		return;
+	}
+
+	for (h = fix_tag_hash(tag);; h = (h + 1) & (FIX_TAG_HASH_SIZE - 1)) {
+		slot = &index->hash[h];
+
+		if (slot->gen != index->gen)
+			break;
+
+		if (slot->tag == tag)
+			return;
+	}
+
+	/* Keep the load factor at one half so that probes stay short. */
+	if (index->nr_hashed >= FIX_TAG_HASH_SIZE / 2) {
+		index->overflow = true;
+		return;
+	}
+
+	slot->tag = tag;
+	slot->gen = index->gen;
+	slot->pos = pos;
+
+	index->nr_hashed++;
+}
+
+/* Body parsing progress, shared by the parsers through add_field() */
+struct fix_parse_state {
+	unsigned long			nr_fields;
+	unsigned long			max_fields;	/* room in the fields array */
+	unsigned long			nr_groups;
+	unsigned long			nr_entries;	/* of all groups so far */
+
+	/* Group whose entries are being parsed, or NULL */
+	struct fix_group		*group;
+	const struct fix_group_def	*def;
+	int				delim_tag;	/* first tag of every entry */
+};
+
+unsigned long fix_message_prepare(struct fix_message *self, const char *start, const char *end);
+void fix_group_field(struct fix_message *self, struct fix_dialect *dialect, struct fix_parse_state *state, enum fix_type type);
+void fix_parse_finish(struct fix_message *self, struct fix_parse_state *state);
+
+/*
+ * Parse the field that ends at 'delim' and consume it, SOH included. The
+ * tag is all digits up to the '=', so only the SOH needs to be searched
+ * for.
+ */
+static inline int parse_field_at(struct buffer *self, const char *delim, int *tag, const char **value)
+{
+	const char *start;
+	const char *end;
+
+	start = buffer_start(self);
+
+	*tag = fix_uatoi(start, &end);
+
+	buffer_advance(self, delim + 1 - start);
+
+	if (*end != '=')
+		return FIX_MSG_STATE_GARBLED;
+
+	*value = end + 1;
+
+	return 0;
+}
+
+static inline int parse_field(struct buffer *self, int *tag, const char **value)
+{
+	const char *delim;
+
+	delim = scan_byte(buffer_start(self), buffer_end(self), 0x01);
+	if (!delim) {
+		buffer_advance(self, buffer_size(self));
+		return FIX_MSG_STATE_PARTIAL;
+	}
+
+	return parse_field_at(self, delim, tag, value);
+}
+
+static inline int match_field(struct buffer *self, int tag, const char **value)
+{
+	int ptag, ret;
+
+	ret = parse_field(self, &ptag, value);
+	if (ret)
+		return ret;
+
+	if (ptag != tag)
+		return FIX_MSG_STATE_GARBLED;
+
+	return 0;
+}
+
+/*
+ * Store the field whose value runs from 'value' up to the SOH at 'delim'.
+ * With FIX_PARSE_FLAG_LAZY numeric values are kept as text and only
+ * converted by fix_get_field(). Returns false once the CheckSum field is
+ * reached. Fields that don't fit in a caller's fields array are skipped.
+ */
+fix_parse_inline bool add_field(struct fix_message *self, struct fix_dialect *dialect, enum fix_type (*tag_type)(int), int tag, const char *value, const char *delim, unsigned long flags, struct fix_parse_state *state)
+{
+	enum fix_type type = tag_type(tag);
+	unsigned long nr = state->nr_fields;
+
+	if (__builtin_expect(nr == state->max_fields, 0))
+		return type != FIX_TYPE_CHECKSUM;
+
+	if ((flags & FIX_PARSE_FLAG_LAZY) && (type == FIX_TYPE_INT || type == FIX_TYPE_FLOAT || type == FIX_TYPE_DECIMAL)) {
+		self->fields[nr] = FIX_LAZY_FIELD(tag, type, value);
+		goto out;
+	}
+
+	switch (type) {
+	case FIX_TYPE_INT:
+	case FIX_TYPE_GROUP:
+		self->fields[nr] = FIX_INT_FIELD(tag, fix_atoi64(value, NULL));
+		break;
+	case FIX_TYPE_FLOAT:
+		self->fields[nr] = FIX_FLOAT_FIELD(tag, strtod(value, NULL));
+		break;
+	case FIX_TYPE_DECIMAL: {
+		struct fix_decimal decimal = fix_decimal_parse(value, NULL);
+
+		self->fields[nr] = FIX_DECIMAL_FIELD(tag, decimal.mantissa, decimal.exponent);
+		break;
+	}
+	case FIX_TYPE_CHAR:
+		self->fields[nr] = FIX_CHAR_FIELD(tag, value[0]);
+		break;
+	case FIX_TYPE_STRING:
+		self->fields[nr] = FIX_STRING_FIELD(tag, value);
+		break;
+	case FIX_TYPE_CHECKSUM:
+		return false;
+	case FIX_TYPE_MSGSEQNUM:
+		self->msg_seq_num = fix_uatoi(value, NULL);
+		return true;
+	default:
+		return true;
+	}
+out:
+	self->fields[nr].value_len = delim - value;
+
+	if (self->index)
+		fix_tag_index_add(self->index, tag, nr);
+
+	if (state->group || type == FIX_TYPE_GROUP)
+		fix_group_field(self, dialect, state, type);
+
+	state->nr_fields++;
+
+	return true;
+}
+
+/*
+ * Locate all SOH delimiters up to the end of the message in one pass and
+ * then walk the fields from bitmap to bitmap.
+ */
+fix_parse_inline int rest_of_message(struct fix_message *self, struct fix_dialect *dialect, enum fix_type (*tag_type)(int), struct buffer *buffer, unsigned long flags)
+{
+	u64 bitmap[SCAN_BITMAP_WORDS(FIX_MAX_MESSAGE_SIZE + 7)];
+	struct fix_parse_state state = { 0 };
+	const char *value = NULL;
+	const char *start, *end;
+	unsigned long i, words;
+	int tag = 0;
+
+	start	= buffer_start(buffer);
+
+	/* The CheckSum may be anywhere up to the end of the buffer. */
+	state.max_fields = fix_message_prepare(self, start, buffer_end(buffer));
+	if (!state.max_fields)
+		return FIX_MSG_STATE_GARBLED;
+
+	end	= self->msg_type - 3 + self->body_length + 7;
+
+	if (end > buffer_end(buffer))
+		end = buffer_end(buffer);
+	if (end < start)
+		end = start;
+
+	scan_bitmap(start, end - start, 0x01, bitmap);
+
+	words = SCAN_BITMAP_WORDS(end - start);
+
+	for (i = 0; i < words; i++) {
+		u64 bits = bitmap[i];
+
+		while (bits) {
+			const char *delim = start + i * 64 + __builtin_ctzll(bits);
+
+			bits &= bits - 1;
+
+			if (parse_field_at(buffer, delim, &tag, &value))
+				return 0;
+
+			if (!add_field(self, dialect, tag_type, tag, value, delim, flags, &state))
+				goto done;
+		}
+	}
+
+	/* No CheckSum within BodyLength: keep looking past it. */
+	while (!parse_field(buffer, &tag, &value)) {
+		if (!add_field(self, dialect, tag_type, tag, value, buffer_start(buffer) - 1, flags, &state))
+			goto done;
+	}
+
+	return 0;
+
+done:
+	fix_parse_finish(self, &state);
+
+	return 0;
+}
+
+/*
+ * Tokenize the body and checksum it in the same sweep: every 64-byte block
+ * is loaded once to both find its SOH delimiters and add up its bytes, and
+ * the fields ending in it are converted straight away. The sweep starts
+ * at BeginString so that the first three fields are summed too. The
+ * CheckSum field must start where BodyLength says it does, even with
+ * NO_CSUM.
+ */
+fix_parse_inline int rest_of_message_one_pass(struct fix_message *self, struct fix_dialect *dialect, enum fix_type (*tag_type)(int), struct buffer *buffer, unsigned long flags)
+{
+	struct fix_parse_state state = { 0 };
+	unsigned long sum = 0;
+	const char *start, *end;
+	const char *field, *p;
+	const char *value;
+	char tail[64];
+	long skip;
+	int offset;
+	int ret;
+
+	start = buffer_start(buffer);
+
+	/* The number of bytes between tag MsgType and buffer's start */
+	offset = start - (self->msg_type - 3);
+
+	/* Room for the trailing "10=***\x01" as in checksum() */
+	if (buffer_size(buffer) + offset < self->body_length + 7)
+		return FIX_MSG_STATE_PARTIAL;
+
+	/* CheckSum field */
+	end = self->msg_type - 3 + self->body_length;
+
+	if (end < start || end[-1] != 0x01)
+		return FIX_MSG_STATE_GARBLED;
+
+	state.max_fields = fix_message_prepare(self, start, end);
+	if (!state.max_fields)
+		return FIX_MSG_STATE_GARBLED;
+
+	field = start;
+
+	for (p = self->begin_string - 2; p < end; p += 64) {
+		unsigned int n = end - p < 64 ? end - p : 64;
+		const char *block = p;
+		u64 bits;
+
+		/* The last block may run past the end of the buffer. */
+		if (p + 64 > buffer->data + buffer->capacity) {
+			memcpy(tail, p, n);
+			block = tail;
+		}
+
+		bits = scan_block_sum(block, n, 0x01, &sum);
+
+		/* Skip the delimiters of the fields already parsed */
+		skip = start - p;
+		if (skip >= 64)
+			bits = 0;
+		else if (skip > 0)
+			bits &= ~0ULL << skip;
+
+		while (bits) {
+			const char *delim = p + __builtin_ctzll(bits);
+			int tag;
+
+			bits &= bits - 1;
+
+			tag = fix_uatoi(field, &value);
+			if (*value++ != '=')
+				return FIX_MSG_STATE_GARBLED;
+
+			/* CheckSum ahead of where BodyLength puts it */
+			if (!add_field(self, dialect, tag_type, tag, value, delim, flags, &state))
+				return FIX_MSG_STATE_GARBLED;
+
+			field = delim + 1;
+		}
+	}
+
+	buffer_advance(buffer, end - start);
+
+	ret = match_field(buffer, CheckSum, &self->check_sum);
+	if (ret)
+		return ret;
+
+	if (!(flags & FIX_PARSE_FLAG_NO_CSUM)) {
+		if (sum % 256 != (unsigned long) fix_uatoi(self->check_sum, NULL))
+			return FIX_MSG_STATE_GARBLED;
+	}
+
+	fix_parse_finish(self, &state);
+
+	return 0;
+}
+
+/*
+ * Parse the fields that follow MsgType, see struct fix_dialect's
+ * parse_body(). Without FIX_PARSE_FLAG_ONE_PASS the checksum has been
+ * verified already.
+ */
+fix_parse_inline int fix_parse_body(struct fix_message *self, struct fix_dialect *dialect, enum fix_type (*tag_type)(int), struct buffer *buffer, unsigned long flags)
+{
+	if (flags & FIX_PARSE_FLAG_ONE_PASS)
+		return rest_of_message_one_pass(self, dialect, tag_type, buffer, flags);
+
+	return rest_of_message(self, dialect, tag_type, buffer, flags);
+}
+
+#endif /* LIBTRADING_FIX_PARSE_H */
@@ -1,13 +1,20 @@
 #include "libtrading/proto/fix_session.h"
 
+#include "libtrading/read-write.h"
 #include "libtrading/compat.h"
+#include "libtrading/array.h"
 #include "libtrading/trace.h"
+#include "libtrading/time.h"
 
 #include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <errno.h>
 #include <stdio.h>
 
 static const char *begin_strings[] = {
@@ -54,6 +61,83 @@ struct fix_session_cfg *fix_session_cfg_new(
 	return cfg;
 }
 
+/* Map the session state file, creating it if it doesn't exist. */
+static struct fix_session_state *fix_session_state_map(const char *path)
+{
+	struct fix_session_state *state;
+	struct stat st;
+	int fd;
+
+	fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		return NULL;
+
+	if (fstat(fd, &st) < 0)
+		goto fail;
+
+	if (!st.st_size && ftruncate(fd, sizeof(*state)) < 0)
+		goto fail;
+	else if (st.st_size && (size_t) st.st_size != sizeof(*state))
+		goto fail;
+
+	state = mmap(NULL, sizeof(*state), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (state == MAP_FAILED)
+		goto fail;
+
+	close(fd);
+
+	return state;
+
+fail:
+	close(fd);
+	return NULL;
+}
+
+static inline void fix_session_state_store(struct fix_session *self)
+{
+	self->state->in_msg_seq_num	= self->in_msg_seq_num;
+	self->state->out_msg_seq_num	= self->out_msg_seq_num;
+}
+
+/*
+ * Write the sequence numbers back to the state file and wait for them to
+ * reach the disk. Also picks up changes made to the counters directly.
+ */
+int fix_session_state_sync(struct fix_session *self)
+{
+	if (!self->state)
+		return 0;
+
+	fix_session_state_store(self);
+
+	return msync(self->state, sizeof(*self->state), MS_SYNC);
+}
+
+/*
+ * Set the MsgSeqNum expected next, e.g. on SequenceReset, and keep the state
+ * file in step as fix_session_recv() would.
+ */
+int fix_session_set_in_msg_seq_num(struct fix_session *self, unsigned long seq_num)
+{
+	self->in_msg_seq_num = seq_num;
+
+	if (!self->state)
+		return 0;
+
+	fix_session_state_store(self);
+
+	if (self->state_sync == FIX_STATE_SYNC_ALWAYS)
+		return fix_session_state_sync(self);
+
+	return 0;
+}
+
+/* Count the next message as received, as fix_session_recv() does itself. */
+int fix_session_consume(struct fix_session *self)
+{
+	return fix_session_set_in_msg_seq_num(self, self->in_msg_seq_num + 1);
+}
+
 struct fix_session *fix_session_new(struct fix_session_cfg *cfg)
 {
 	struct fix_session *self = calloc(1, sizeof *self);
@@ -63,7 +147,23 @@ struct fix_session *fix_session_new(struct fix_session_cfg *cfg)
 
 	self->dialect		= cfg->dialect;
 
-	self->rx_buffer		= buffer_new(RECV_BUFFER_SIZE);
+#ifdef SO_BUSY_POLL
+	if (cfg->busy_poll_usec > 0 &&
+	    setsockopt(cfg->sockfd, SOL_SOCKET, SO_BUSY_POLL, &cfg->busy_poll_usec, sizeof(cfg->busy_poll_usec)) < 0) {
+		fix_session_free(self);
+		return NULL;
+	}
+#endif
+
+	if (cfg->rx_timestamps && rx_timestamps_enable(cfg->sockfd) < 0) {
+		fix_session_free(self);
+		return NULL;
+	}
+
+	if (cfg->rx_buffer_type == BUFFER_TYPE_MIRROR)
+		self->rx_buffer	= buffer_mirror_new(RECV_BUFFER_SIZE);
+	else
+		self->rx_buffer	= buffer_new(RECV_BUFFER_SIZE);
 	if (!self->rx_buffer) {
 		fix_session_free(self);
 		return NULL;
@@ -81,12 +181,43 @@ struct fix_session *fix_session_new(struct fix_session_cfg *cfg)
 		return NULL;
 	}
 
+	if (cfg->tx_ring_size) {
+		unsigned long i;
+
+		if (cfg->tx_ring_size > FIX_TX_RING_MAX_SIZE) {
+			fix_session_free(self);
+			return NULL;
+		}
+
+		self->tx_ring_size	= cfg->tx_ring_size;
+
+		self->tx_ring		= calloc(self->tx_ring_size, sizeof(*self->tx_ring));
+		self->tx_iov		= calloc(2 * self->tx_ring_size, sizeof(*self->tx_iov));
+		if (!self->tx_ring || !self->tx_iov) {
+			fix_session_free(self);
+			return NULL;
+		}
+
+		for (i = 0; i < self->tx_ring_size; i++) {
+			struct fix_tx_slot *slot = &self->tx_ring[i];
+
+			slot->head_buf	= buffer_new(FIX_TX_HEAD_BUFFER_SIZE);
+			slot->body_buf	= buffer_new(FIX_TX_BODY_BUFFER_SIZE);
+			if (!slot->head_buf || !slot->body_buf) {
+				fix_session_free(self);
+				return NULL;
+			}
+		}
+	}
+
 	self->rx_message	= fix_message_new();
 	if (!self->rx_message) {
 		fix_session_free(self);
 		return NULL;
 	}
 
+	fix_timestamp_init(&self->timestamp, self->str_now, cfg->time_precision);
+
 	if (fix_session_time_update(self)) {
 		fix_session_free(self);
 		return NULL;
@@ -101,18 +232,67 @@ struct fix_session *fix_session_new(struct fix_session_cfg *cfg)
 	self->heartbtint	= cfg->heartbtint;
 	self->password		= cfg->password;
 	self->sockfd		= cfg->sockfd;
+	self->journal		= cfg->journal;
+	self->log		= cfg->log;
 	self->tr_pending	= 0;
+	self->spin_usec		= cfg->spin_usec;
+	self->spin_count	= cfg->spin_count;
+	self->rx_timestamps	= cfg->rx_timestamps;
+	self->update_time_on_send = cfg->update_time_on_send;
 	self->in_msg_seq_num	= cfg->in_msg_seq_num  > 0 ? cfg->in_msg_seq_num  : 0;
 	self->out_msg_seq_num	= cfg->out_msg_seq_num > 1 ? cfg->out_msg_seq_num : 1;
 
+	if (cfg->state_path) {
+		self->state = fix_session_state_map(cfg->state_path);
+		if (!self->state) {
+			fix_session_free(self);
+			return NULL;
+		}
+
+		self->state_sync = cfg->state_sync;
+
+		if (self->state->magic == FIX_SESSION_STATE_MAGIC) {
+			self->in_msg_seq_num	= self->state->in_msg_seq_num;
+			self->out_msg_seq_num	= self->state->out_msg_seq_num;
+		} else if (self->state->magic) {
+			munmap(self->state, sizeof(*self->state));
+			self->state = NULL;
+			fix_session_free(self);
+			return NULL;
+		} else {
+			fix_session_state_store(self);
+			self->state->magic = FIX_SESSION_STATE_MAGIC;
+
+			if (fix_session_state_sync(self) < 0) {
+				fix_session_free(self);
+				return NULL;
+			}
+		}
+	}
+
 	return self;
 }
 
+/* Messages still queued in the tx ring are dropped. */
 void fix_session_free(struct fix_session *self)
 {
+	unsigned long i;
+
 	if (!self)
 		return;
 
+	if (self->state) {
+		fix_session_state_sync(self);
+		munmap(self->state, sizeof(*self->state));
+	}
+
+	for (i = 0; self->tx_ring && i < self->tx_ring_size; i++) {
+		buffer_delete(self->tx_ring[i].head_buf);
+		buffer_delete(self->tx_ring[i].body_buf);
+	}
+	free(self->tx_ring);
+	free(self->tx_iov);
+
 	buffer_delete(self->rx_buffer);
 	buffer_delete(self->tx_head_buffer);
 	buffer_delete(self->tx_body_buffer);
@@ -128,23 +308,7 @@ int fix_session_time_update_monotonic(struct fix_session *self, struct timespec
 
 int fix_session_time_update_realtime(struct fix_session *self, struct timespec *realtime)
 {
-	struct timeval tv;
-	struct tm *tm;
-	char fmt[64];
-
-	TIMESPEC_TO_TIMEVAL(&tv, realtime);
-
-	tm = gmtime(&tv.tv_sec);
-	if (!tm)
-		goto fail;
-
-	strftime(fmt, sizeof(fmt), "%Y%m%d-%H:%M:%S", tm);
-
-	snprintf(self->str_now, sizeof(self->str_now), "%s.%03ld", fmt, (long)tv.tv_usec / 1000);
-
-	return 0;
-fail:
-	return -1;
+	return fix_timestamp_update(&self->timestamp, realtime);
 }
 
 int fix_session_time_update(struct fix_session *self)
@@ -164,24 +328,331 @@ fail:
 	return -1;
 }
 
+/*
+ * Send the messages queued in the tx ring with a single sendmsg(). Returns
+ * the number of bytes left unsent or a negative value on error, like
+ * fix_session_send(). Whatever didn't go out stays queued and the next
+ * flush resumes where this one stopped.
+ */
+int fix_session_flush(struct fix_session *self)
+{
+	struct iovec *iov = &self->tx_iov[self->tx_iov_pos];
+	unsigned long iovcnt = 2 * self->nr_tx_queued - self->tx_iov_pos;
+	size_t size, sent;
+	ssize_t ret;
+
+	if (!iovcnt)
+		return 0;
+
+	size = iov_byte_length(iov, iovcnt);
+
+	ret = io_sendmsg(self->sockfd, iov, iovcnt, 0);
+	if (ret < 0)
+		return ret;
+
+	if ((size_t) ret == size) {
+		self->nr_tx_queued	= 0;
+		self->tx_iov_pos	= 0;
+		return 0;
+	}
+
+	for (sent = ret; sent >= iov->iov_len; iov++) {
+		sent -= iov->iov_len;
+		self->tx_iov_pos++;
+	}
+
+	iov->iov_base	= (char *) iov->iov_base + sent;
+	iov->iov_len	-= sent;
+
+	return size - ret;
+}
+
+/*
+ * Journal and log a message fix_session_send() has just serialized. The
+ * journal keeps a copy for fix_session_resend(); messages sent with
+ * FIX_SEND_FLAG_PRESERVE_MSG_NUM reuse an old MsgSeqNum and are left out.
+ */
+static void fix_session_record(struct fix_session *self, struct fix_message *msg, unsigned long flags)
+{
+	struct iovec iov[2];
+
+	buffer_to_iovec(msg->head_buf, &iov[0]);
+	buffer_to_iovec(msg->body_buf, &iov[1]);
+
+	if (self->journal && !(flags & FIX_SEND_FLAG_PRESERVE_MSG_NUM) &&
+	    fix_journal_append(self->journal, msg->msg_seq_num, iov, ARRAY_SIZE(iov)) < 0)
+		self->nr_journal_errors++;
+
+	if (self->log)
+		fix_log_write(self->log, FIX_LOG_OUT, iov, ARRAY_SIZE(iov));
+}
+
+/*
+ * With a tx ring, serialize the message into the next free slot. Corked
+ * messages stay there until the ring is full, anything else flushes the
+ * ring together with the message so that the order on the wire is the
+ * order of fix_session_send() calls.
+ */
+static int fix_session_queue(struct fix_session *self, struct fix_message *msg, unsigned long flags)
+{
+	unsigned long i = self->nr_tx_queued++;
+	struct fix_tx_slot *slot = &self->tx_ring[i];
+
+	msg->head_buf = slot->head_buf;
+	buffer_reset(msg->head_buf);
+	msg->body_buf = slot->body_buf;
+	buffer_reset(msg->body_buf);
+
+	fix_message_unparse(msg);
+
+	if (self->journal || self->log)
+		fix_session_record(self, msg, flags);
+
+	buffer_to_iovec(msg->head_buf, &self->tx_iov[2 * i]);
+	buffer_to_iovec(msg->body_buf, &self->tx_iov[2 * i + 1]);
+
+	msg->head_buf = msg->body_buf = NULL;
+
+	if ((flags & FIX_SEND_FLAG_CORK) && self->nr_tx_queued < self->tx_ring_size)
+		return 0;
+
+	return fix_session_flush(self);
+}
+
+static void fix_session_send_time(struct fix_session *self)
+{
+	if (self->update_time_on_send) {
+		struct timespec realtime;
+
+		if (!clock_gettime(CLOCK_REALTIME, &realtime))
+			fix_session_time_update_realtime(self, &realtime);
+	}
+
+	self->tx_timestamp = self->now;
+}
+
 int fix_session_send(struct fix_session *self, struct fix_message *msg, unsigned long flags)
 {
+	int ret;
+
+	/* A full ring that couldn't be flushed takes no more messages. */
+	if (self->tx_ring && self->nr_tx_queued == self->tx_ring_size) {
+		ret = fix_session_flush(self);
+		if (ret > 0)
+			errno = EAGAIN;
+		if (ret)
+			return -1;
+	}
+
 	msg->begin_string	= self->begin_string;
 	msg->sender_comp_id	= self->sender_comp_id;
 	msg->target_comp_id	= self->target_comp_id;
 
-	if (!(flags && FIX_SEND_FLAG_PRESERVE_MSG_NUM))
+	if (!(flags & FIX_SEND_FLAG_PRESERVE_MSG_NUM))
 		msg->msg_seq_num	= self->out_msg_seq_num++;
 
+	if (self->state) {
+		fix_session_state_store(self);
+
+		if (self->state_sync != FIX_STATE_SYNC_NONE && fix_session_state_sync(self) < 0)
+			return -1;
+	}
+
+	fix_session_send_time(self);
+
+	msg->str_now = self->str_now;
+
+	if (self->tx_ring)
+		return fix_session_queue(self, msg, flags);
+
 	msg->head_buf = self->tx_head_buffer;
 	buffer_reset(msg->head_buf);
 	msg->body_buf = self->tx_body_buffer;
 	buffer_reset(msg->body_buf);
 
-	self->tx_timestamp = self->now;
-	msg->str_now = self->str_now;
+	if (!self->journal && !self->log)
+		return fix_message_send(msg, self->sockfd, flags);
+
+	/* Serialize here so that the message is recorded before it goes out. */
+	fix_message_unparse(msg);
+	fix_session_record(self, msg, flags);
+
+	ret = fix_message_send(msg, self->sockfd, flags | FIX_SEND_FLAG_PRESERVE_BUFFER);
+
+	msg->head_buf = msg->body_buf = NULL;
+
+	return ret;
+}
+
+/*
+ * Locate the parts of a journaled message that a resend changes: 'body'
+ * is where MsgType starts, 'time' the value of SendingTime and 'end' the
+ * start of CheckSum.
+ */
+static bool fix_replay_split(const char *msg, size_t len, const char **body, const char **time, const char **end)
+{
+	const char *p;
+
+	/* BeginString and BodyLength */
+	p = memchr(msg, 0x01, len);
+	if (!p)
+		return false;
+
+	p = memchr(p + 1, 0x01, msg + len - p - 1);
+	if (!p)
+		return false;
+
+	*body = p + 1;
+
+	*end = msg + len - strlen("10=000\001");
+	if (*end < *body || memcmp(*end, "10=", 3))
+		return false;
+
+	p = memmem(*body - 1, *end - *body + 1, "\00152=", 4);
+	if (!p)
+		return false;
+
+	*time = p + 4;
+
+	return true;
+}
+
+/* Session level messages other than Reject are gap filled, not resent. */
+static bool fix_replay_is_admin(const char *body)
+{
+	if (memcmp(body, "35=", 3) || body[4] != 0x01)
+		return false;
+
+	switch (body[3]) {
+	case '0': case '1': case '2': case '4': case '5': case 'A':
+		return true;
+	default:
+		return false;
+	}
+}
+
+/*
+ * Send a journaled message again as it was, except that it gets
+ * PossDupFlag and the current SendingTime, with the original one moved to
+ * OrigSendingTime.
+ */
+static int fix_session_replay(struct fix_session *self, const char *msg, size_t len)
+{
+	struct buffer *head_buf = self->tx_head_buffer;
+	struct buffer *body_buf = self->tx_body_buffer;
+	const char *body, *time, *end;
+	struct iovec iov[2];
+	unsigned long cksum;
+	ssize_t ret;
+	size_t size;
+
+	if (!fix_replay_split(msg, len, &body, &time, &end))
+		return -1;
+
+	fix_session_send_time(self);
+
+	buffer_reset(head_buf);
+	buffer_reset(body_buf);
+
+	if (!buffer_printf(body_buf, "%.*s%.*s\00143=Y\001122=%.*s",
+			   (int) (time - body), body,
+			   (int) fix_timestamp_len(&self->timestamp), self->str_now,
+			   (int) (end - time), time))
+		return -1;
+
+	if (!buffer_printf(head_buf, "%.*s9=%lu\001", (int) (strchr(msg, 0x01) + 1 - msg), msg, buffer_size(body_buf)))
+		return -1;
+
+	cksum = buffer_sum(head_buf) + buffer_sum(body_buf);
 
-	return fix_message_send(msg, self->sockfd, flags);
+	if (!buffer_printf(body_buf, "10=%03lu\001", cksum % 256))
+		return -1;
+
+	buffer_to_iovec(head_buf, &iov[0]);
+	buffer_to_iovec(body_buf, &iov[1]);
+
+	size = iov_byte_length(iov, ARRAY_SIZE(iov));
+
+	if (self->log)
+		fix_log_write(self->log, FIX_LOG_OUT, iov, ARRAY_SIZE(iov));
+
+	ret = io_sendmsg(self->sockfd, iov, ARRAY_SIZE(iov), 0);
+	if (ret < 0)
+		return ret;
+
+	return size - ret;
+}
+
+static int fix_session_gap_fill(struct fix_session *self, unsigned long msg_seq_num, unsigned long new_seq_num)
+{
+	struct fix_field fields[] = {
+		FIX_INT_FIELD(NewSeqNo, new_seq_num),
+		FIX_STRING_FIELD(GapFillFlag, "Y"),
+		FIX_STRING_FIELD(PossDupFlag, "Y"),
+	};
+	struct fix_message msg = {
+		.type		= FIX_MSG_TYPE_SEQUENCE_RESET,
+		.msg_seq_num	= msg_seq_num,
+		.nr_fields	= ARRAY_SIZE(fields),
+		.fields		= fields,
+	};
+
+	return fix_session_send(self, &msg, FIX_SEND_FLAG_PRESERVE_MSG_NUM);
+}
+
+/*
+ * Answer a ResendRequest: replay the application messages found in the
+ * journal and cover everything else with SequenceReset-GapFill. Without a
+ * journal the whole range is gap filled. An 'end_seq_num' of 0 stands for
+ * the last message sent. Returns 0 when all of it was sent.
+ */
+int fix_session_resend(struct fix_session *self, unsigned long begin_seq_num, unsigned long end_seq_num)
+{
+	unsigned long gap = 0;
+	unsigned long seq;
+	int ret;
+
+	if (!begin_seq_num)
+		begin_seq_num = 1;
+
+	if (!end_seq_num || end_seq_num >= self->out_msg_seq_num)
+		end_seq_num = self->out_msg_seq_num - 1;
+
+	ret = fix_session_flush(self);
+	if (ret)
+		return ret;
+
+	for (seq = begin_seq_num; seq <= end_seq_num; seq++) {
+		const char *body, *time, *end;
+		const char *msg = NULL;
+		size_t len;
+
+		if (self->journal)
+			msg = fix_journal_get(self->journal, seq, &len);
+
+		if (!msg || !fix_replay_split(msg, len, &body, &time, &end) || fix_replay_is_admin(body)) {
+			if (!gap)
+				gap = seq;
+			continue;
+		}
+
+		if (gap) {
+			ret = fix_session_gap_fill(self, gap, seq);
+			if (ret)
+				return ret;
+
+			gap = 0;
+		}
+
+		ret = fix_session_replay(self, msg, len);
+		if (ret)
+			return ret;
+	}
+
+	if (gap)
+		return fix_session_gap_fill(self, gap, end_seq_num + 1);
+
+	return 0;
 }
 
 static inline bool fix_session_buffer_full(struct fix_session *session)
@@ -194,23 +665,103 @@ static int translate_recv_flags(unsigned long flags)
 	return flags & FIX_RECV_FLAG_MSG_DONTWAIT ? MSG_DONTWAIT : 0;
 }
 
-int fix_session_recv(struct fix_session *self, struct fix_message **res, unsigned long flags)
+static bool fix_session_spin_done(struct fix_session *self, unsigned long nr, struct timespec *start)
 {
-	struct fix_message *msg = self->rx_message;
-	struct buffer *buffer = self->rx_buffer;
+	struct timespec now;
+
+	if (!self->spin_count && !self->spin_usec)
+		return true;
+
+	if (self->spin_count && nr >= self->spin_count)
+		return true;
+
+	if (self->spin_usec) {
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		if (timespec_delta(start, &now) >= self->spin_usec * 1000)
+			return true;
+	}
+
+	return false;
+}
+
+/*
+ * Poll the socket without blocking until a message arrives or the spin
+ * budget runs out, then fall back to blocking receives.
+ */
+static int fix_session_recv_spin(struct fix_session *self, struct fix_message **res, unsigned long flags)
+{
+	struct timespec start;
+	unsigned long nr = 0;
+	int ret;
+
+	flags &= ~(FIX_RECV_FLAG_SPIN | FIX_RECV_FLAG_MSG_DONTWAIT);
+
+	if (self->spin_usec)
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (;;) {
+		ret = fix_session_recv(self, res, flags | FIX_RECV_FLAG_MSG_DONTWAIT);
+		if (ret > 0) {
+			self->nr_spin_hits++;
+			return ret;
+		}
+
+		if (ret < 0 && (self->failure_reason != FIX_FAILURE_SYSTEM ||
+				(errno != EAGAIN && errno != EWOULDBLOCK)))
+			return ret;
+
+		self->nr_spin_polls++;
+
+		if (fix_session_spin_done(self, ++nr, &start))
+			break;
+	}
 
 	self->failure_reason = FIX_SUCCESS;
+	self->nr_sleeps++;
 
-	size_t size;
+	do {
+		ret = fix_session_recv(self, res, flags);
+	} while (!ret);
 
-	TRACE(LIBTRADING_FIX_MESSAGE_RECV(msg, flags));
+	return ret;
+}
 
-	if (!fix_message_parse(msg, self->dialect, buffer, flags)) {
-		self->rx_timestamp = self->now;
-		if (!(flags & FIX_RECV_KEEP_IN_MSGSEQNUM)) self->in_msg_seq_num++;
-		goto parsed;
+/* Parse the next complete message in the rx buffer into 'msg'. */
+static bool fix_session_parse(struct fix_session *self, struct fix_message *msg, unsigned long flags)
+{
+	if (fix_message_parse(msg, self->dialect, self->rx_buffer, flags))
+		return false;
+
+	if (self->log) {
+		struct iovec iov;
+
+		/* The message runs from "8=" up to where the parser stopped */
+		iov.iov_base	= (void *) (msg->begin_string - 2);
+		iov.iov_len	= buffer_start(self->rx_buffer) - (msg->begin_string - 2);
+
+		fix_log_write(self->log, FIX_LOG_IN, &iov, 1);
 	}
 
+	self->rx_timestamp = self->now;
+	if (!(flags & FIX_RECV_KEEP_IN_MSGSEQNUM))
+		fix_session_consume(self);
+
+	/*
+	 * Messages are parsed before reading more data, so the last read is
+	 * the one that completed this message.
+	 */
+	msg->rx_timestamp = self->rx_kernel_timestamp;
+
+	return true;
+}
+
+/* Make room in the rx buffer and read from the socket once. */
+static int fix_session_fill(struct fix_session *self, unsigned long flags)
+{
+	struct buffer *buffer = self->rx_buffer;
+	size_t size;
+
 	if (fix_session_buffer_full(self))
 		buffer_compact(buffer);
 
@@ -220,7 +771,10 @@ int fix_session_recv(struct fix_session *self, struct fix_message **res, unsigne
 
 		size -= FIX_MAX_MESSAGE_SIZE;
 
-		nr = buffer_recv(buffer, self->sockfd, size, translate_recv_flags(flags));
+		if (self->rx_timestamps)
+			nr = buffer_recv_ts(buffer, self->sockfd, size, translate_recv_flags(flags), &self->rx_kernel_timestamp);
+		else
+			nr = buffer_recv(buffer, self->sockfd, size, translate_recv_flags(flags));
 
 		if (nr <= 0) {
 			self->failure_reason = nr == 0 ? FIX_FAILURE_CONN_CLOSED : FIX_FAILURE_SYSTEM;
@@ -228,11 +782,28 @@ int fix_session_recv(struct fix_session *self, struct fix_message **res, unsigne
 		}
 	}
 
-	if (!fix_message_parse(msg, self->dialect, buffer, flags)) {
-		self->rx_timestamp = self->now;
-		if (!(flags & FIX_RECV_KEEP_IN_MSGSEQNUM)) self->in_msg_seq_num++;
+	return 0;
+}
+
+int fix_session_recv(struct fix_session *self, struct fix_message **res, unsigned long flags)
+{
+	struct fix_message *msg = self->rx_message;
+
+	if (flags & FIX_RECV_FLAG_SPIN)
+		return fix_session_recv_spin(self, res, flags);
+
+	self->failure_reason = FIX_SUCCESS;
+
+	TRACE(LIBTRADING_FIX_MESSAGE_RECV(msg, flags));
+
+	if (fix_session_parse(self, msg, flags))
+		goto parsed;
+
+	if (fix_session_fill(self, flags))
+		return -1;
+
+	if (fix_session_parse(self, msg, flags))
 		goto parsed;
-	}
 
 	TRACE(LIBTRADING_FIX_MESSAGE_RECV_ERR());
 
@@ -244,3 +815,38 @@ parsed:
 	*res = msg;
 	return 1;
 }
+
+/*
+ * Parse every complete message in the rx buffer into msgs[0..nr), reading
+ * from the socket once only if there is none. The messages point into the
+ * rx buffer, which is not compacted until the next receive call, so they
+ * stay valid until then. in_msg_seq_num is left alone: call
+ * fix_session_consume() before handling each message, in order, so that
+ * fix_msg_expected() and fix_session_admin() see it as they would after
+ * fix_session_recv(). Returns the number of messages, 0 if the data read
+ * completes none or -1 on error. As with fix_session_recv(), an empty
+ * socket read with FIX_RECV_FLAG_MSG_DONTWAIT is an error: -1 with
+ * FIX_FAILURE_SYSTEM and errno set to EAGAIN. FIX_RECV_FLAG_SPIN is ignored.
+ */
+int fix_session_recv_batch(struct fix_session *self, struct fix_message **msgs, unsigned long nr, unsigned long flags)
+{
+	unsigned long i = 0;
+
+	self->failure_reason = FIX_SUCCESS;
+
+	flags |= FIX_RECV_KEEP_IN_MSGSEQNUM;
+
+	while (i < nr && fix_session_parse(self, msgs[i], flags))
+		i++;
+
+	if (i || !nr)
+		return i;
+
+	if (fix_session_fill(self, flags))
+		return -1;
+
+	while (i < nr && fix_session_parse(self, msgs[i], flags))
+		i++;
+
+	return i;
+}
@@ -47,6 +47,10 @@ char *fix_field_unparse_zpad(struct fix_field *self, int zpad, struct buffer *bu
 		buffer->end += modp_litoa10_zpad(self->int_value, zpad, buffer_end(buffer));
 		break;
 	}
+	case FIX_TYPE_DECIMAL: {
+		buffer->end += fix_decimal_unparse(fix_field_decimal(self), buffer_end(buffer));
+		break;
+	}
 	case FIX_TYPE_CHECKSUM: {
 		buffer->end += checksumtoa(self->int_value, buffer_end(buffer));
 		break;
@@ -87,10 +91,64 @@ void fix_template_free(struct fix_template *self)
 	free(self);
 }
 
+static void fix_template_add_slot(struct fix_template_cfg *cfg, int tag, enum fix_type type, unsigned long width)
+{
+	assert(cfg->nr_slots < FIX_TEMPLATE_MAX_SLOTS);
+
+	cfg->slots[cfg->nr_slots++] = (struct fix_template_slot) {
+		.tag	= tag,
+		.type	= type,
+		.width	= width,
+	};
+}
+
+/*
+ * Ready-made layouts for the common order messages. They add the fields
+ * that change from order to order as slots and leave the header and the
+ * constant fields (Symbol, OrdType, ...) to the caller.
+ */
+void fix_template_cfg_new_order_single(struct fix_template_cfg *cfg, unsigned long cl_ord_id_len)
+{
+	cfg->msg_type = FIX_MSG_TYPE_NEW_ORDER_SINGLE;
+	cfg->manage_transact_time = true;
+
+	fix_template_add_slot(cfg, ClOrdID, FIX_TYPE_STRING, cl_ord_id_len);
+	fix_template_add_slot(cfg, Side, FIX_TYPE_CHAR, 1);
+	fix_template_add_slot(cfg, OrderQty, FIX_TYPE_FLOAT, FIX_TEMPLATE_QTY_WIDTH);
+	fix_template_add_slot(cfg, Price, FIX_TYPE_FLOAT, FIX_TEMPLATE_PRICE_WIDTH);
+}
+
+void fix_template_cfg_order_cancel_request(struct fix_template_cfg *cfg, unsigned long cl_ord_id_len)
+{
+	cfg->msg_type = FIX_MSG_ORDER_CANCEL_REQUEST;
+	cfg->manage_transact_time = true;
+
+	fix_template_add_slot(cfg, OrigClOrdID, FIX_TYPE_STRING, cl_ord_id_len);
+	fix_template_add_slot(cfg, ClOrdID, FIX_TYPE_STRING, cl_ord_id_len);
+	fix_template_add_slot(cfg, Side, FIX_TYPE_CHAR, 1);
+	fix_template_add_slot(cfg, OrderQty, FIX_TYPE_FLOAT, FIX_TEMPLATE_QTY_WIDTH);
+}
+
+void fix_template_cfg_order_cancel_replace(struct fix_template_cfg *cfg, unsigned long cl_ord_id_len)
+{
+	cfg->msg_type = FIX_MSG_ORDER_CANCEL_REPLACE;
+	cfg->manage_transact_time = true;
+
+	fix_template_add_slot(cfg, OrigClOrdID, FIX_TYPE_STRING, cl_ord_id_len);
+	fix_template_add_slot(cfg, ClOrdID, FIX_TYPE_STRING, cl_ord_id_len);
+	fix_template_add_slot(cfg, Side, FIX_TYPE_CHAR, 1);
+	fix_template_add_slot(cfg, OrderQty, FIX_TYPE_FLOAT, FIX_TEMPLATE_QTY_WIDTH);
+	fix_template_add_slot(cfg, Price, FIX_TYPE_FLOAT, FIX_TEMPLATE_PRICE_WIDTH);
+}
+
 void fix_template_prepare(struct fix_template *self, struct fix_template_cfg *cfg)
 {
+	char placeholder[] = "YYYYMMDD-HH:MM:SS.sssssssss";
 	int i;
 
+	fix_timestamp_init(&self->sending_time, NULL, cfg->time_precision);
+	placeholder[fix_timestamp_len(&self->sending_time)] = 0;
+
 	// head
 	fix_field_unparse(&FIX_STRING_FIELD(BeginString, cfg->begin_string), &self->buf);
 	self->marker_body_length = fix_field_unparse_zpad(&FIX_INT_FIELD(BodyLength, 0), FIX_TEMPLATE_BODY_LEN_ZPAD, &self->buf);
@@ -98,20 +156,35 @@ void fix_template_prepare(struct fix_template *self, struct fix_template_cfg *cf
 	self->marker_msg_seq_num = fix_field_unparse_zpad(&FIX_INT_FIELD(MsgSeqNum, 0), FIX_TEMPLATE_MSG_SEQ_NUM_ZPAD, &self->buf);
 	self->marker_sender_comp_id = fix_field_unparse_zpad(&FIX_STRING_FIELD(SenderCompID, cfg->sender_comp_id), 0, &self->buf); // assume all sender_comp_id are of the same size
 	self->sender_comp_id_len = strlen(cfg->sender_comp_id);
-	self->marker_sending_time = fix_field_unparse_zpad(&FIX_STRING_FIELD(SendingTime, "YYYYMMDD-HH:MM:SS.sss"), 0, &self->buf);
+	self->marker_sending_time = fix_field_unparse_zpad(&FIX_STRING_FIELD(SendingTime, placeholder), 0, &self->buf);
+	self->sending_time.str = self->marker_sending_time;
 	fix_field_unparse(&FIX_STRING_FIELD(TargetCompID, cfg->target_comp_id), &self->buf); // assume target_comp_id is static
 
 	if (cfg->manage_transact_time)
-		self->marker_transact_time = fix_field_unparse_zpad(&FIX_STRING_FIELD(TransactTime, "YYYYMMDD-HH:MM:SS.sss"), 0, &self->buf);
+		self->marker_transact_time = fix_field_unparse_zpad(&FIX_STRING_FIELD(TransactTime, placeholder), 0, &self->buf);
 
 	self->marker_const_start = buffer_end(&self->buf);
 
 	for (i = 0; i < cfg->nr_const_fields; i++)
 		fix_field_unparse(&cfg->const_fields[i], &self->buf);
 
+	// slots start out as zeros, which is a valid value of every type
+	for (i = 0; i < cfg->nr_slots; i++) {
+		struct fix_template_slot *slot = &self->slots[i];
+
+		*slot = cfg->slots[i];
+
+		self->buf.end += uitoa(slot->tag, buffer_end(&self->buf));
+		buffer_put(&self->buf, '=');
+		slot->marker = buffer_end(&self->buf);
+		memset(slot->marker, '0', slot->width);
+		self->buf.end += slot->width;
+		buffer_put(&self->buf, 0x01);
+	}
+	self->nr_slots = cfg->nr_slots;
+
 	self->marker_const_end = buffer_end(&self->buf);
-	self->const_csum =  buffer_sum_range(self->marker_const_start, self->marker_const_end) +
-			    buffer_sum_range(self->buf.data, self->marker_body_length);
+	self->sum = buffer_sum_range(self->buf.data, self->marker_const_end);
 
 	assert(self->marker_body_length != NULL);
 	assert(self->marker_msg_seq_num != NULL);
@@ -121,15 +194,134 @@ void fix_template_prepare(struct fix_template *self, struct fix_template_cfg *cf
 	assert(self->marker_const_end != NULL);
 }
 
-void fix_template_update_time(struct fix_template *self, const char *str_now)
+/*
+ * The fields patched in place are short, so plain loops beat the
+ * vectorized buffer_sum_range() for them.
+ */
+static inline uint8_t fix_template_sum(const char *p, unsigned long len)
+{
+	uint8_t sum = 0;
+	unsigned long i;
+
+	for (i = 0; i < len; i++)
+		sum += p[i];
+
+	return sum;
+}
+
+/*
+ * Overwrite 'len' bytes of the prepared part of the buffer and update its
+ * checksum from the bytes that changed only.
+ */
+static inline void fix_template_patch(struct fix_template *self, char *dst, const char *src, unsigned long len)
+{
+	uint8_t sum = self->sum;
+	unsigned long i;
+
+	for (i = 0; i < len; i++) {
+		sum += src[i] - dst[i];
+		dst[i] = src[i];
+	}
+
+	self->sum = sum;
+}
+
+int fix_template_update_time(struct fix_template *self, struct timespec *realtime)
 {
-	memcpy(self->marker_sending_time, str_now, 21); // sizeof("YYYYMMDD-HH:MM:SS.sss")
+	unsigned long len = fix_timestamp_len(&self->sending_time);
+	char *str = self->marker_sending_time;
+	uint8_t old = fix_template_sum(str, len);
+	int ret;
+
+	// may have written part of the timestamp even when it fails
+	ret = fix_timestamp_update(&self->sending_time, realtime);
+
+	self->sum += fix_template_sum(str, len) - old;
+
+	if (ret)
+		return -1;
+
 	if (self->marker_transact_time)
-		memcpy(self->marker_transact_time, str_now, 21); // sizeof("YYYYMMDD-HH:MM:SS.sss")
+		fix_template_patch(self, self->marker_transact_time, str, len);
+
+	return 0;
+}
+
+static struct fix_template_slot *fix_template_slot(struct fix_template *self, int tag)
+{
+	int i;
+
+	for (i = 0; i < self->nr_slots; i++) {
+		if (self->slots[i].tag == tag)
+			return &self->slots[i];
+	}
+
+	return NULL;
+}
+
+/*
+ * Write 'field' into its slot. Returns -1 if the template has no slot for
+ * the tag or the value doesn't fit in it.
+ */
+int fix_template_set_field(struct fix_template *self, struct fix_field *field)
+{
+	struct fix_template_slot *slot;
+	char num[64];
+	char value[64];
+	unsigned long len;
+	unsigned long pad;
+	char *p = value;
+
+	slot = fix_template_slot(self, field->tag);
+	if (!slot || slot->type != field->type)
+		return -1;
+
+	switch (field->type) {
+	case FIX_TYPE_STRING:
+		if (strlen(field->string_value) != slot->width)
+			return -1;
+
+		fix_template_patch(self, slot->marker, field->string_value, slot->width);
+		return 0;
+	case FIX_TYPE_CHAR:
+		fix_template_patch(self, slot->marker, &field->char_value, 1);
+		return 0;
+	case FIX_TYPE_INT:
+		len = modp_litoa10(field->int_value, num);
+		break;
+	case FIX_TYPE_FLOAT:
+		len = modp_dtoa2(field->float_value, num, 7);
+		break;
+	case FIX_TYPE_DECIMAL:
+		len = fix_decimal_unparse(fix_field_decimal(field), num);
+		break;
+	default:
+		return -1;
+	}
+
+	if (len > slot->width || slot->width > sizeof(value))
+		return -1;
+
+	// left-pad numbers with zeros, after the sign
+	pad = slot->width - len;
+	if (num[0] == '-') {
+		*p++ = '-';
+		memset(p, '0', pad);
+		memcpy(p + pad, num + 1, len - 1);
+	} else {
+		memset(p, '0', pad);
+		memcpy(p + pad, num, len);
+	}
+
+	fix_template_patch(self, slot->marker, value, slot->width);
+
+	return 0;
 }
 
 void fix_template_unparse(struct fix_template *self, struct fix_session *session)
 {
+	char num[32];
+	unsigned long len;
 	int i;
 
 	self->buf.start = 0;
@@ -138,14 +330,16 @@ void fix_template_unparse(struct fix_template *self, struct fix_session *session
 	for (i = 0; i < self->nr_fields; i++)
 		fix_field_unparse(&self->fields[i], &self->buf);
 
-	memcpy(self->marker_sender_comp_id, session->sender_comp_id, self->sender_comp_id_len);
-	modp_litoa10_zpad(session->out_msg_seq_num, FIX_TEMPLATE_MSG_SEQ_NUM_ZPAD, self->marker_msg_seq_num);
-	modp_litoa10_zpad(self->buf.end - (self->marker_body_length - self->buf.data + FIX_TEMPLATE_BODY_LEN_ZPAD + 1),
-			  FIX_TEMPLATE_BODY_LEN_ZPAD, self->marker_body_length);
+	fix_template_patch(self, self->marker_sender_comp_id, session->sender_comp_id, self->sender_comp_id_len);
+
+	len = modp_litoa10_zpad(session->out_msg_seq_num, FIX_TEMPLATE_MSG_SEQ_NUM_ZPAD, num);
+	fix_template_patch(self, self->marker_msg_seq_num, num, len);
+
+	len = modp_litoa10_zpad(self->buf.end - (self->marker_body_length - self->buf.data + FIX_TEMPLATE_BODY_LEN_ZPAD + 1),
+				FIX_TEMPLATE_BODY_LEN_ZPAD, num);
+	fix_template_patch(self, self->marker_body_length, num, len);
 
-	self->csum_field.int_value = (buffer_sum_range(self->marker_body_length, self->marker_const_start) +
-				      self->const_csum +
-				      buffer_sum_range(self->marker_const_end, buffer_end(&self->buf))) % 256;
+	self->csum_field.int_value = (uint8_t) (self->sum + buffer_sum_range(self->marker_const_end, buffer_end(&self->buf)));
 	fix_field_unparse(&self->csum_field, &self->buf);
 
 	self->iov[0].iov_base	= &self->tx_data[0]; // prepare iovec for sending
@@ -0,0 +1,1451 @@
+#include "libtrading/proto/ice_os_fix.h"
+
+#include "libtrading/proto/fix_message.h"
+
+#include "fix_parse.h"
+
+#include <string.h>
+
+fix_parse_inline enum fix_type ice_os_fix_tag_type(int tag)
+{
+	switch (tag) {
+	case ICE_OS_TAG_MsgSeqNum: return FIX_TYPE_MSGSEQNUM;
+	case ICE_OS_TAG_SenderCompID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_TargetCompID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_TargetSubID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_SenderSubID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_PossDupFlag: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_PossResend: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_SendingTime: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_CheckSum: return FIX_TYPE_CHECKSUM;
+	case ICE_OS_TAG_UserName: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_RawData: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_EncryptMethod: return FIX_TYPE_INT;
+	case ICE_OS_TAG_ResetSeqNumFlag: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_HeartbeatInt: return FIX_TYPE_INT;
+	case ICE_OS_TAG_Text: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_TestReqID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_BeginSeqNo: return FIX_TYPE_INT;
+	case ICE_OS_TAG_EndSeqNo: return FIX_TYPE_INT;
+	case ICE_OS_TAG_NewSeqNo: return FIX_TYPE_INT;
+	case ICE_OS_TAG_GapFillFlag: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_RefSeqNum: return FIX_TYPE_INT;
+	case ICE_OS_TAG_RefTagID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_RefMsgType: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_SessionRejectReason: return FIX_TYPE_INT;
+	case ICE_OS_TAG_EncodedTextLen: return FIX_TYPE_INT;
+	case ICE_OS_TAG_EncodedText: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_ClientID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_ClOrdID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_OnBehalfOfCompID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_OnBehalfOfSubID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_OnBehalfOfLocationID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_OriginatorUserID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_HandlInst: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_Symbol: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_SecurityType: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_PutOrCall: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_StrikePrice: return FIX_TYPE_FLOAT;
+	case ICE_OS_TAG_CustOrderHandlingInst: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_Side: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_TransactTime: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_OrderQty: return FIX_TYPE_INT;
+	case ICE_OS_TAG_MaxShow: return FIX_TYPE_INT;
+	case ICE_OS_TAG_OrdType: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_Price: return FIX_TYPE_FLOAT;
+	case ICE_OS_TAG_PriceType: return FIX_TYPE_INT;
+	case ICE_OS_TAG_StopPx: return FIX_TYPE_FLOAT;
+	case ICE_OS_TAG_PositionEffect: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_TimeInForce: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_NoAllocs: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_AllocHandlInst: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_GiveUpClearingFirm: return FIX_TYPE_INT;
+	case ICE_OS_TAG_AllocAccount: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_AllocQty: return FIX_TYPE_INT;
+	case ICE_OS_TAG_ClearingAccount: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_ClearingFirm: return FIX_TYPE_INT;
+	case ICE_OS_TAG_MemoField: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_AccountCode: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_CTICode: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_CustomerAccountRefId: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_OrigClOrdID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_OrderID: return FIX_TYPE_INT;
+	case ICE_OS_TAG_OrdStatus: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_CxlRejectresponseTo: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_CxlRejectReason: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_ExecID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_ExecTransType: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_ExecRefID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_ExecType: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_OrdRejReason: return FIX_TYPE_INT;
+	case ICE_OS_TAG_OrderState: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_LiquidityIndicator: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_ExecRestatementReason: return FIX_TYPE_INT;
+	case ICE_OS_TAG_LeavesQty: return FIX_TYPE_INT;
+	case ICE_OS_TAG_CumQty: return FIX_TYPE_INT;
+	case ICE_OS_TAG_AvgPx: return FIX_TYPE_FLOAT;
+	case ICE_OS_TAG_LastPx: return FIX_TYPE_FLOAT;
+	case ICE_OS_TAG_LastParPx: return FIX_TYPE_FLOAT;
+	case ICE_OS_TAG_LastQty: return FIX_TYPE_INT;
+	case ICE_OS_TAG_MultiLegReportingType: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_SecondaryExecID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_CrossID: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_CrossType: return FIX_TYPE_CHAR;
+	case ICE_OS_TAG_DeliveryStartDate: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_DeliveryEndDate: return FIX_TYPE_STRING;
+	case ICE_OS_TAG_CrossExecutionType: return FIX_TYPE_INT;
+	default: return FIX_TYPE_STRING;
+	}
+}
+
+static int ice_os_fix_parse_body(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
+{
+	return fix_parse_body(self, dialect, ice_os_fix_tag_type, buffer, flags);
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_logon_parse(struct ice_os_logon *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "A\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_UserName:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_LOGON_USER_NAME))
+				break;
+			self->user_name = field->string_value;
+			self->user_name_len = field->value_len;
+			self->present |= ICE_OS_LOGON_USER_NAME;
+			break;
+		case ICE_OS_TAG_RawData:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_LOGON_RAW_DATA))
+				break;
+			self->raw_data = field->string_value;
+			self->raw_data_len = field->value_len;
+			self->present |= ICE_OS_LOGON_RAW_DATA;
+			break;
+		case ICE_OS_TAG_EncryptMethod:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_LOGON_ENCRYPT_METHOD))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->encrypt_method = field->int_value;
+			self->present |= ICE_OS_LOGON_ENCRYPT_METHOD;
+			break;
+		case ICE_OS_TAG_ResetSeqNumFlag:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_LOGON_RESET_SEQ_NUM_FLAG))
+				break;
+			self->reset_seq_num_flag = field->char_value;
+			self->present |= ICE_OS_LOGON_RESET_SEQ_NUM_FLAG;
+			break;
+		case ICE_OS_TAG_HeartbeatInt:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_LOGON_HEARTBEAT_INT))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->heartbeat_int = field->int_value;
+			self->present |= ICE_OS_LOGON_HEARTBEAT_INT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_logout_parse(struct ice_os_logout *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "5\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_LOGOUT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= ICE_OS_LOGOUT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_heartbeat_parse(struct ice_os_heartbeat *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "0\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_TestReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_HEARTBEAT_TEST_REQ_ID))
+				break;
+			self->test_req_id = field->string_value;
+			self->test_req_id_len = field->value_len;
+			self->present |= ICE_OS_HEARTBEAT_TEST_REQ_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_test_request_parse(struct ice_os_test_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "1\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_TestReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_TEST_REQUEST_TEST_REQ_ID))
+				break;
+			self->test_req_id = field->string_value;
+			self->test_req_id_len = field->value_len;
+			self->present |= ICE_OS_TEST_REQUEST_TEST_REQ_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_resend_request_parse(struct ice_os_resend_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "2\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_BeginSeqNo:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_RESEND_REQUEST_BEGIN_SEQ_NO))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->begin_seq_no = field->int_value;
+			self->present |= ICE_OS_RESEND_REQUEST_BEGIN_SEQ_NO;
+			break;
+		case ICE_OS_TAG_EndSeqNo:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_RESEND_REQUEST_END_SEQ_NO))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->end_seq_no = field->int_value;
+			self->present |= ICE_OS_RESEND_REQUEST_END_SEQ_NO;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_sequence_reset_parse(struct ice_os_sequence_reset *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "4\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_NewSeqNo:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_SEQUENCE_RESET_NEW_SEQ_NO))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->new_seq_no = field->int_value;
+			self->present |= ICE_OS_SEQUENCE_RESET_NEW_SEQ_NO;
+			break;
+		case ICE_OS_TAG_GapFillFlag:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_SEQUENCE_RESET_GAP_FILL_FLAG))
+				break;
+			self->gap_fill_flag = field->char_value;
+			self->present |= ICE_OS_SEQUENCE_RESET_GAP_FILL_FLAG;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_session_level_reject_parse(struct ice_os_session_level_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "3\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_RefSeqNum:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_SESSION_LEVEL_REJECT_REF_SEQ_NUM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->ref_seq_num = field->int_value;
+			self->present |= ICE_OS_SESSION_LEVEL_REJECT_REF_SEQ_NUM;
+			break;
+		case ICE_OS_TAG_RefTagID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_SESSION_LEVEL_REJECT_REF_TAG_ID))
+				break;
+			self->ref_tag_id = field->string_value;
+			self->ref_tag_id_len = field->value_len;
+			self->present |= ICE_OS_SESSION_LEVEL_REJECT_REF_TAG_ID;
+			break;
+		case ICE_OS_TAG_RefMsgType:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_SESSION_LEVEL_REJECT_REF_MSG_TYPE))
+				break;
+			self->ref_msg_type = field->string_value;
+			self->ref_msg_type_len = field->value_len;
+			self->present |= ICE_OS_SESSION_LEVEL_REJECT_REF_MSG_TYPE;
+			break;
+		case ICE_OS_TAG_SessionRejectReason:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_SESSION_LEVEL_REJECT_SESSION_REJECT_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->session_reject_reason = field->int_value;
+			self->present |= ICE_OS_SESSION_LEVEL_REJECT_SESSION_REJECT_REASON;
+			break;
+		case ICE_OS_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_SESSION_LEVEL_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= ICE_OS_SESSION_LEVEL_REJECT_TEXT;
+			break;
+		case ICE_OS_TAG_EncodedTextLen:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_SESSION_LEVEL_REJECT_ENCODED_TEXT_LEN))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->encoded_text_len = field->int_value;
+			self->present |= ICE_OS_SESSION_LEVEL_REJECT_ENCODED_TEXT_LEN;
+			break;
+		case ICE_OS_TAG_EncodedText:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_SESSION_LEVEL_REJECT_ENCODED_TEXT))
+				break;
+			self->encoded_text = field->string_value;
+			self->present |= ICE_OS_SESSION_LEVEL_REJECT_ENCODED_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_trader_login_parse(struct ice_os_trader_login *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "CG\001", 3))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_TRADER_LOGIN_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= ICE_OS_TRADER_LOGIN_CLIENT_ID;
+			break;
+		case ICE_OS_TAG_UserName:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_TRADER_LOGIN_USER_NAME))
+				break;
+			self->user_name = field->string_value;
+			self->user_name_len = field->value_len;
+			self->present |= ICE_OS_TRADER_LOGIN_USER_NAME;
+			break;
+		case ICE_OS_TAG_RawData:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_TRADER_LOGIN_RAW_DATA))
+				break;
+			self->raw_data = field->string_value;
+			self->raw_data_len = field->value_len;
+			self->present |= ICE_OS_TRADER_LOGIN_RAW_DATA;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_trader_logout_parse(struct ice_os_trader_logout *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "CH\001", 3))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_TRADER_LOGOUT_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= ICE_OS_TRADER_LOGOUT_CLIENT_ID;
+			break;
+		case ICE_OS_TAG_UserName:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_TRADER_LOGOUT_USER_NAME))
+				break;
+			self->user_name = field->string_value;
+			self->user_name_len = field->value_len;
+			self->present |= ICE_OS_TRADER_LOGOUT_USER_NAME;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_new_order_single_parse(struct ice_os_new_order_single *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "D\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_CLIENT_ID;
+			break;
+		case ICE_OS_TAG_OnBehalfOfCompID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_COMP_ID))
+				break;
+			self->on_behalf_of_comp_id = field->string_value;
+			self->on_behalf_of_comp_id_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_COMP_ID;
+			break;
+		case ICE_OS_TAG_OnBehalfOfSubID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_SUB_ID))
+				break;
+			self->on_behalf_of_sub_id = field->string_value;
+			self->on_behalf_of_sub_id_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_SUB_ID;
+			break;
+		case ICE_OS_TAG_OnBehalfOfLocationID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_LOCATION_ID))
+				break;
+			self->on_behalf_of_location_id = field->string_value;
+			self->on_behalf_of_location_id_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ON_BEHALF_OF_LOCATION_ID;
+			break;
+		case ICE_OS_TAG_OriginatorUserID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_ORIGINATOR_USER_ID))
+				break;
+			self->originator_user_id = field->string_value;
+			self->originator_user_id_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ORIGINATOR_USER_ID;
+			break;
+		case ICE_OS_TAG_HandlInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_HANDL_INST))
+				break;
+			self->handl_inst = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_HANDL_INST;
+			break;
+		case ICE_OS_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_SYMBOL;
+			break;
+		case ICE_OS_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_SECURITY_TYPE;
+			break;
+		case ICE_OS_TAG_PutOrCall:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_PUT_OR_CALL))
+				break;
+			self->put_or_call = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_PUT_OR_CALL;
+			break;
+		case ICE_OS_TAG_StrikePrice:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_NEW_ORDER_SINGLE_STRIKE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->strike_price = field->float_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_STRIKE_PRICE;
+			break;
+		case ICE_OS_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_CUST_ORDER_HANDLING_INST;
+			break;
+		case ICE_OS_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_SIDE;
+			break;
+		case ICE_OS_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_TRANSACT_TIME;
+			break;
+		case ICE_OS_TAG_OrderQty:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_NEW_ORDER_SINGLE_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->int_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ORDER_QTY;
+			break;
+		case ICE_OS_TAG_MaxShow:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_NEW_ORDER_SINGLE_MAX_SHOW))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->max_show = field->int_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_MAX_SHOW;
+			break;
+		case ICE_OS_TAG_OrdType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_ORD_TYPE))
+				break;
+			self->ord_type = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ORD_TYPE;
+			break;
+		case ICE_OS_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_NEW_ORDER_SINGLE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_PRICE;
+			break;
+		case ICE_OS_TAG_PriceType:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_NEW_ORDER_SINGLE_PRICE_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price_type = field->int_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_PRICE_TYPE;
+			break;
+		case ICE_OS_TAG_StopPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_NEW_ORDER_SINGLE_STOP_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->stop_px = field->float_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_STOP_PX;
+			break;
+		case ICE_OS_TAG_PositionEffect:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_POSITION_EFFECT))
+				break;
+			self->position_effect = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_POSITION_EFFECT;
+			break;
+		case ICE_OS_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_TIME_IN_FORCE;
+			break;
+		case ICE_OS_TAG_NoAllocs:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_NO_ALLOCS))
+				break;
+			self->no_allocs = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_NO_ALLOCS;
+			break;
+		case ICE_OS_TAG_AllocHandlInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_ALLOC_HANDL_INST))
+				break;
+			self->alloc_handl_inst = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ALLOC_HANDL_INST;
+			break;
+		case ICE_OS_TAG_GiveUpClearingFirm:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_NEW_ORDER_SINGLE_GIVE_UP_CLEARING_FIRM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->give_up_clearing_firm = field->int_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_GIVE_UP_CLEARING_FIRM;
+			break;
+		case ICE_OS_TAG_AllocAccount:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_ALLOC_ACCOUNT))
+				break;
+			self->alloc_account = field->string_value;
+			self->alloc_account_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ALLOC_ACCOUNT;
+			break;
+		case ICE_OS_TAG_AllocQty:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_NEW_ORDER_SINGLE_ALLOC_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->alloc_qty = field->int_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ALLOC_QTY;
+			break;
+		case ICE_OS_TAG_ClearingAccount:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_CLEARING_ACCOUNT))
+				break;
+			self->clearing_account = field->string_value;
+			self->clearing_account_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_CLEARING_ACCOUNT;
+			break;
+		case ICE_OS_TAG_ClearingFirm:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_NEW_ORDER_SINGLE_CLEARING_FIRM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->clearing_firm = field->int_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_CLEARING_FIRM;
+			break;
+		case ICE_OS_TAG_MemoField:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_MEMO_FIELD))
+				break;
+			self->memo_field = field->string_value;
+			self->memo_field_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_MEMO_FIELD;
+			break;
+		case ICE_OS_TAG_AccountCode:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_ACCOUNT_CODE))
+				break;
+			self->account_code = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_ACCOUNT_CODE;
+			break;
+		case ICE_OS_TAG_CTICode:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_NEW_ORDER_SINGLE_CTI_CODE))
+				break;
+			self->cti_code = field->char_value;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_CTI_CODE;
+			break;
+		case ICE_OS_TAG_CustomerAccountRefId:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_NEW_ORDER_SINGLE_CUSTOMER_ACCOUNT_REF_ID))
+				break;
+			self->customer_account_ref_id = field->string_value;
+			self->customer_account_ref_id_len = field->value_len;
+			self->present |= ICE_OS_NEW_ORDER_SINGLE_CUSTOMER_ACCOUNT_REF_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_execution_report_parse(struct ice_os_execution_report *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "8\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_OrderID:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_ORDER_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_id = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORDER_ID;
+			break;
+		case ICE_OS_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORIG_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_CLIENT_ID;
+			break;
+		case ICE_OS_TAG_OriginatorUserID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_ORIGINATOR_USER_ID))
+				break;
+			self->originator_user_id = field->string_value;
+			self->originator_user_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORIGINATOR_USER_ID;
+			break;
+		case ICE_OS_TAG_ExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_EXEC_ID))
+				break;
+			self->exec_id = field->string_value;
+			self->exec_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_EXEC_ID;
+			break;
+		case ICE_OS_TAG_ExecTransType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_EXEC_TRANS_TYPE))
+				break;
+			self->exec_trans_type = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_EXEC_TRANS_TYPE;
+			break;
+		case ICE_OS_TAG_ExecRefID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_EXEC_REF_ID))
+				break;
+			self->exec_ref_id = field->string_value;
+			self->exec_ref_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_EXEC_REF_ID;
+			break;
+		case ICE_OS_TAG_ExecType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_EXEC_TYPE))
+				break;
+			self->exec_type = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_EXEC_TYPE;
+			break;
+		case ICE_OS_TAG_OrdStatus:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_ORD_STATUS))
+				break;
+			self->ord_status = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORD_STATUS;
+			break;
+		case ICE_OS_TAG_OrdRejReason:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_ORD_REJ_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->ord_rej_reason = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORD_REJ_REASON;
+			break;
+		case ICE_OS_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_SYMBOL;
+			break;
+		case ICE_OS_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_SIDE;
+			break;
+		case ICE_OS_TAG_OrderQty:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORDER_QTY;
+			break;
+		case ICE_OS_TAG_PutOrCall:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_PUT_OR_CALL))
+				break;
+			self->put_or_call = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_PUT_OR_CALL;
+			break;
+		case ICE_OS_TAG_StrikePrice:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_EXECUTION_REPORT_STRIKE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->strike_price = field->float_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_STRIKE_PRICE;
+			break;
+		case ICE_OS_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_CUST_ORDER_HANDLING_INST;
+			break;
+		case ICE_OS_TAG_MaxShow:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_MAX_SHOW))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->max_show = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_MAX_SHOW;
+			break;
+		case ICE_OS_TAG_OrdType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_ORD_TYPE))
+				break;
+			self->ord_type = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORD_TYPE;
+			break;
+		case ICE_OS_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_EXECUTION_REPORT_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_PRICE;
+			break;
+		case ICE_OS_TAG_OrderState:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_ORDER_STATE))
+				break;
+			self->order_state = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_ORDER_STATE;
+			break;
+		case ICE_OS_TAG_LiquidityIndicator:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_LIQUIDITY_INDICATOR))
+				break;
+			self->liquidity_indicator = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_LIQUIDITY_INDICATOR;
+			break;
+		case ICE_OS_TAG_ExecRestatementReason:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_EXEC_RESTATEMENT_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->exec_restatement_reason = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_EXEC_RESTATEMENT_REASON;
+			break;
+		case ICE_OS_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_TIME_IN_FORCE;
+			break;
+		case ICE_OS_TAG_LeavesQty:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_LEAVES_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->leaves_qty = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_LEAVES_QTY;
+			break;
+		case ICE_OS_TAG_CumQty:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_CUM_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->cum_qty = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_CUM_QTY;
+			break;
+		case ICE_OS_TAG_AvgPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_EXECUTION_REPORT_AVG_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->avg_px = field->float_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_AVG_PX;
+			break;
+		case ICE_OS_TAG_LastPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_EXECUTION_REPORT_LAST_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->last_px = field->float_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_LAST_PX;
+			break;
+		case ICE_OS_TAG_LastParPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_EXECUTION_REPORT_LAST_PAR_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->last_par_px = field->float_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_LAST_PAR_PX;
+			break;
+		case ICE_OS_TAG_LastQty:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_LAST_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->last_qty = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_LAST_QTY;
+			break;
+		case ICE_OS_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_TRANSACT_TIME;
+			break;
+		case ICE_OS_TAG_MultiLegReportingType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_MULTI_LEG_REPORTING_TYPE))
+				break;
+			self->multi_leg_reporting_type = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_MULTI_LEG_REPORTING_TYPE;
+			break;
+		case ICE_OS_TAG_SecondaryExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_SECONDARY_EXEC_ID))
+				break;
+			self->secondary_exec_id = field->string_value;
+			self->secondary_exec_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_SECONDARY_EXEC_ID;
+			break;
+		case ICE_OS_TAG_CrossID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_CROSS_ID))
+				break;
+			self->cross_id = field->string_value;
+			self->cross_id_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_CROSS_ID;
+			break;
+		case ICE_OS_TAG_CrossType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_EXECUTION_REPORT_CROSS_TYPE))
+				break;
+			self->cross_type = field->char_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_CROSS_TYPE;
+			break;
+		case ICE_OS_TAG_ClearingFirm:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_CLEARING_FIRM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->clearing_firm = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_CLEARING_FIRM;
+			break;
+		case ICE_OS_TAG_ClearingAccount:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_CLEARING_ACCOUNT))
+				break;
+			self->clearing_account = field->string_value;
+			self->clearing_account_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_CLEARING_ACCOUNT;
+			break;
+		case ICE_OS_TAG_MemoField:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_MEMO_FIELD))
+				break;
+			self->memo_field = field->string_value;
+			self->memo_field_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_MEMO_FIELD;
+			break;
+		case ICE_OS_TAG_DeliveryStartDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_DELIVERY_START_DATE))
+				break;
+			self->delivery_start_date = field->string_value;
+			self->delivery_start_date_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_DELIVERY_START_DATE;
+			break;
+		case ICE_OS_TAG_DeliveryEndDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_DELIVERY_END_DATE))
+				break;
+			self->delivery_end_date = field->string_value;
+			self->delivery_end_date_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_DELIVERY_END_DATE;
+			break;
+		case ICE_OS_TAG_CrossExecutionType:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_EXECUTION_REPORT_CROSS_EXECUTION_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->cross_execution_type = field->int_value;
+			self->present |= ICE_OS_EXECUTION_REPORT_CROSS_EXECUTION_TYPE;
+			break;
+		case ICE_OS_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_EXECUTION_REPORT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= ICE_OS_EXECUTION_REPORT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_order_cancel_request_parse(struct ice_os_order_cancel_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "F\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_CLIENT_ID;
+			break;
+		case ICE_OS_TAG_OriginatorUserID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_ORIGINATOR_USER_ID))
+				break;
+			self->originator_user_id = field->string_value;
+			self->originator_user_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_ORIGINATOR_USER_ID;
+			break;
+		case ICE_OS_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_SYMBOL;
+			break;
+		case ICE_OS_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_SECURITY_TYPE;
+			break;
+		case ICE_OS_TAG_PutOrCall:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_PUT_OR_CALL))
+				break;
+			self->put_or_call = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_PUT_OR_CALL;
+			break;
+		case ICE_OS_TAG_StrikePrice:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_STRIKE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->strike_price = field->float_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_STRIKE_PRICE;
+			break;
+		case ICE_OS_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REQUEST_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REQUEST_SIDE;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_order_cancel_replace_request_parse(struct ice_os_order_cancel_replace_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "G\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLIENT_ID;
+			break;
+		case ICE_OS_TAG_OnBehalfOfCompID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_COMP_ID))
+				break;
+			self->on_behalf_of_comp_id = field->string_value;
+			self->on_behalf_of_comp_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_COMP_ID;
+			break;
+		case ICE_OS_TAG_OnBehalfOfSubID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_SUB_ID))
+				break;
+			self->on_behalf_of_sub_id = field->string_value;
+			self->on_behalf_of_sub_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_SUB_ID;
+			break;
+		case ICE_OS_TAG_OnBehalfOfLocationID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_LOCATION_ID))
+				break;
+			self->on_behalf_of_location_id = field->string_value;
+			self->on_behalf_of_location_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ON_BEHALF_OF_LOCATION_ID;
+			break;
+		case ICE_OS_TAG_OriginatorUserID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORIGINATOR_USER_ID))
+				break;
+			self->originator_user_id = field->string_value;
+			self->originator_user_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORIGINATOR_USER_ID;
+			break;
+		case ICE_OS_TAG_HandlInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST))
+				break;
+			self->handl_inst = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST;
+			break;
+		case ICE_OS_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL;
+			break;
+		case ICE_OS_TAG_Side:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SIDE))
+				break;
+			self->side = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SIDE;
+			break;
+		case ICE_OS_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME;
+			break;
+		case ICE_OS_TAG_OrderQty:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->int_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY;
+			break;
+		case ICE_OS_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_SECURITY_TYPE;
+			break;
+		case ICE_OS_TAG_PutOrCall:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PUT_OR_CALL))
+				break;
+			self->put_or_call = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PUT_OR_CALL;
+			break;
+		case ICE_OS_TAG_StrikePrice:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_STRIKE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->strike_price = field->float_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_STRIKE_PRICE;
+			break;
+		case ICE_OS_TAG_CustOrderHandlingInst:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CUST_ORDER_HANDLING_INST))
+				break;
+			self->cust_order_handling_inst = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CUST_ORDER_HANDLING_INST;
+			break;
+		case ICE_OS_TAG_MaxShow:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->max_show = field->int_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW;
+			break;
+		case ICE_OS_TAG_OrdType:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE))
+				break;
+			self->ord_type = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE;
+			break;
+		case ICE_OS_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PRICE;
+			break;
+		case ICE_OS_TAG_PriceType:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PRICE_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price_type = field->int_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_PRICE_TYPE;
+			break;
+		case ICE_OS_TAG_StopPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_STOP_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->stop_px = field->float_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_STOP_PX;
+			break;
+		case ICE_OS_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_TIME_IN_FORCE;
+			break;
+		case ICE_OS_TAG_ClearingAccount:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLEARING_ACCOUNT))
+				break;
+			self->clearing_account = field->string_value;
+			self->clearing_account_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLEARING_ACCOUNT;
+			break;
+		case ICE_OS_TAG_ClearingFirm:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLEARING_FIRM))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->clearing_firm = field->int_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CLEARING_FIRM;
+			break;
+		case ICE_OS_TAG_MemoField:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_MEMO_FIELD))
+				break;
+			self->memo_field = field->string_value;
+			self->memo_field_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_MEMO_FIELD;
+			break;
+		case ICE_OS_TAG_AccountCode:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT_CODE))
+				break;
+			self->account_code = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT_CODE;
+			break;
+		case ICE_OS_TAG_CTICode:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CTI_CODE))
+				break;
+			self->cti_code = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CTI_CODE;
+			break;
+		case ICE_OS_TAG_CustomerAccountRefId:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CUSTOMER_ACCOUNT_REF_ID))
+				break;
+			self->customer_account_ref_id = field->string_value;
+			self->customer_account_ref_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REPLACE_REQUEST_CUSTOMER_ACCOUNT_REF_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int ice_os_order_cancel_reject_parse(struct ice_os_order_cancel_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "9\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case ICE_OS_TAG_OrderID:
+			if (field->type != FIX_TYPE_INT || (self->present & ICE_OS_ORDER_CANCEL_REJECT_ORDER_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_id = field->int_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_ORDER_ID;
+			break;
+		case ICE_OS_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REJECT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID;
+			break;
+		case ICE_OS_TAG_OrdStatus:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REJECT_ORD_STATUS))
+				break;
+			self->ord_status = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_ORD_STATUS;
+			break;
+		case ICE_OS_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REJECT_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_CLIENT_ID;
+			break;
+		case ICE_OS_TAG_OriginatorUserID:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REJECT_ORIGINATOR_USER_ID))
+				break;
+			self->originator_user_id = field->string_value;
+			self->originator_user_id_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_ORIGINATOR_USER_ID;
+			break;
+		case ICE_OS_TAG_CxlRejectresponseTo:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REJECT_CXL_REJECTRESPONSE_TO))
+				break;
+			self->cxl_rejectresponse_to = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_CXL_REJECTRESPONSE_TO;
+			break;
+		case ICE_OS_TAG_CxlRejectReason:
+			if (field->type != FIX_TYPE_CHAR || (self->present & ICE_OS_ORDER_CANCEL_REJECT_CXL_REJECT_REASON))
+				break;
+			self->cxl_reject_reason = field->char_value;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_CXL_REJECT_REASON;
+			break;
+		case ICE_OS_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & ICE_OS_ORDER_CANCEL_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= ICE_OS_ORDER_CANCEL_REJECT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+struct fix_dialect ice_os_fix_dialect = {
+	.version = FIX_4_2,
+	.tag_type = ice_os_fix_tag_type,
+	.parse_body = ice_os_fix_parse_body,
+};
+
@@ -0,0 +1,695 @@
+#include "libtrading/proto/iex_fix.h"
+
+#include "libtrading/proto/fix_message.h"
+
+#include "fix_parse.h"
+
+#include <string.h>
+
+fix_parse_inline enum fix_type iex_fix_tag_type(int tag)
+{
+	switch (tag) {
+	case IEX_TAG_SenderCompID: return FIX_TYPE_STRING;
+	case IEX_TAG_SendingTime: return FIX_TYPE_STRING;
+	case IEX_TAG_TargetCompID: return FIX_TYPE_STRING;
+	case IEX_TAG_CheckSum: return FIX_TYPE_CHECKSUM;
+	case IEX_TAG_PossDupFlag: return FIX_TYPE_STRING;
+	case IEX_TAG_PossResend: return FIX_TYPE_STRING;
+	case IEX_TAG_OrigSendingTime: return FIX_TYPE_STRING;
+	case IEX_TAG_Account: return FIX_TYPE_STRING;
+	case IEX_TAG_ClOrdID: return FIX_TYPE_STRING;
+	case IEX_TAG_ExecInst: return FIX_TYPE_STRING;
+	case IEX_TAG_HandlInst: return FIX_TYPE_STRING;
+	case IEX_TAG_OrderQty: return FIX_TYPE_STRING;
+	case IEX_TAG_OrdType: return FIX_TYPE_STRING;
+	case IEX_TAG_OrigClOrdId: return FIX_TYPE_STRING;
+	case IEX_TAG_Price: return FIX_TYPE_FLOAT;
+	case IEX_TAG_OrderCapacity: return FIX_TYPE_STRING;
+	case IEX_TAG_SenderSubID: return FIX_TYPE_STRING;
+	case IEX_TAG_Side: return FIX_TYPE_STRING;
+	case IEX_TAG_Symbol: return FIX_TYPE_STRING;
+	case IEX_TAG_Text: return FIX_TYPE_STRING;
+	case IEX_TAG_TimeInForce: return FIX_TYPE_STRING;
+	case IEX_TAG_TransactTime: return FIX_TYPE_STRING;
+	case IEX_TAG_ClientID: return FIX_TYPE_STRING;
+	case IEX_TAG_MinQty: return FIX_TYPE_STRING;
+	case IEX_TAG_MaxFloor: return FIX_TYPE_STRING;
+	case IEX_TAG_LocateReqd: return FIX_TYPE_STRING;
+	case IEX_TAG_OnBehalfOfCompID: return FIX_TYPE_STRING;
+	case IEX_TAG_ExpireTime: return FIX_TYPE_STRING;
+	case IEX_TAG_AvgPrice: return FIX_TYPE_FLOAT;
+	case IEX_TAG_CumQty: return FIX_TYPE_FLOAT;
+	case IEX_TAG_ExecID: return FIX_TYPE_STRING;
+	case IEX_TAG_ExecRefID: return FIX_TYPE_STRING;
+	case IEX_TAG_ExecTransType: return FIX_TYPE_STRING;
+	case IEX_TAG_LastMkt: return FIX_TYPE_STRING;
+	case IEX_TAG_LastPx: return FIX_TYPE_STRING;
+	case IEX_TAG_LastShares: return FIX_TYPE_STRING;
+	case IEX_TAG_OrderID: return FIX_TYPE_STRING;
+	case IEX_TAG_OrderStatus: return FIX_TYPE_STRING;
+	case IEX_TAG_OrigTime: return FIX_TYPE_STRING;
+	case IEX_TAG_CxlRejReason: return FIX_TYPE_STRING;
+	case IEX_TAG_OrdRejReason: return FIX_TYPE_STRING;
+	case IEX_TAG_DeliverToCompID: return FIX_TYPE_STRING;
+	case IEX_TAG_ExecType: return FIX_TYPE_STRING;
+	case IEX_TAG_LeavesQty: return FIX_TYPE_STRING;
+	case IEX_TAG_CxlRejResponseTo: return FIX_TYPE_STRING;
+	case IEX_TAG_TradeLiquidityIndicator: return FIX_TYPE_STRING;
+	default: return FIX_TYPE_STRING;
+	}
+}
+
+static int iex_fix_parse_body(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
+{
+	return fix_parse_body(self, dialect, iex_fix_tag_type, buffer, flags);
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int iex_session_reject_parse(struct iex_session_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "3\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case IEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_SESSION_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= IEX_SESSION_REJECT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int iex_logout_parse(struct iex_logout *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "5\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case IEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_LOGOUT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= IEX_LOGOUT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int iex_new_order_single_parse(struct iex_new_order_single *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "D\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case IEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_CL_ORD_ID;
+			break;
+		case IEX_TAG_ExecInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_EXEC_INST))
+				break;
+			self->exec_inst = field->string_value;
+			self->exec_inst_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_EXEC_INST;
+			break;
+		case IEX_TAG_HandlInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_HANDL_INST))
+				break;
+			self->handl_inst = field->string_value;
+			self->handl_inst_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_HANDL_INST;
+			break;
+		case IEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_ORDER_QTY))
+				break;
+			self->order_qty = field->string_value;
+			self->order_qty_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_ORDER_QTY;
+			break;
+		case IEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_ORD_TYPE))
+				break;
+			self->ord_type = field->string_value;
+			self->ord_type_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_ORD_TYPE;
+			break;
+		case IEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & IEX_NEW_ORDER_SINGLE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= IEX_NEW_ORDER_SINGLE_PRICE;
+			break;
+		case IEX_TAG_OrderCapacity:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_ORDER_CAPACITY))
+				break;
+			self->order_capacity = field->string_value;
+			self->order_capacity_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_ORDER_CAPACITY;
+			break;
+		case IEX_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_SIDE;
+			break;
+		case IEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_SYMBOL;
+			break;
+		case IEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->string_value;
+			self->time_in_force_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_TIME_IN_FORCE;
+			break;
+		case IEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_TRANSACT_TIME;
+			break;
+		case IEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_ACCOUNT;
+			break;
+		case IEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_TEXT;
+			break;
+		case IEX_TAG_MinQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_MIN_QTY))
+				break;
+			self->min_qty = field->string_value;
+			self->min_qty_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_MIN_QTY;
+			break;
+		case IEX_TAG_MaxFloor:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_MAX_FLOOR))
+				break;
+			self->max_floor = field->string_value;
+			self->max_floor_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_MAX_FLOOR;
+			break;
+		case IEX_TAG_LocateReqd:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_NEW_ORDER_SINGLE_LOCATE_REQD))
+				break;
+			self->locate_reqd = field->string_value;
+			self->locate_reqd_len = field->value_len;
+			self->present |= IEX_NEW_ORDER_SINGLE_LOCATE_REQD;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int iex_order_cancel_replace_request_parse(struct iex_order_cancel_replace_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "G\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case IEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID;
+			break;
+		case IEX_TAG_HandlInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST))
+				break;
+			self->handl_inst = field->string_value;
+			self->handl_inst_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST;
+			break;
+		case IEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY))
+				break;
+			self->order_qty = field->string_value;
+			self->order_qty_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY;
+			break;
+		case IEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE))
+				break;
+			self->ord_type = field->string_value;
+			self->ord_type_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE;
+			break;
+		case IEX_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_SIDE;
+			break;
+		case IEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL;
+			break;
+		case IEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME;
+			break;
+		case IEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & IEX_ORDER_CANCEL_REPLACE_REQUEST_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= IEX_ORDER_CANCEL_REPLACE_REQUEST_PRICE;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int iex_order_cancel_request_parse(struct iex_order_cancel_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "F\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case IEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REQUEST_CL_ORD_ID;
+			break;
+		case IEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REQUEST_ORDER_QTY))
+				break;
+			self->order_qty = field->string_value;
+			self->order_qty_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REQUEST_ORDER_QTY;
+			break;
+		case IEX_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REQUEST_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REQUEST_SIDE;
+			break;
+		case IEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REQUEST_SYMBOL;
+			break;
+		case IEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_ORDER_CANCEL_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= IEX_ORDER_CANCEL_REQUEST_TRANSACT_TIME;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int iex_execution_report_parse(struct iex_execution_report *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "8\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case IEX_TAG_AvgPrice:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & IEX_EXECUTION_REPORT_AVG_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->avg_price = field->float_value;
+			self->present |= IEX_EXECUTION_REPORT_AVG_PRICE;
+			break;
+		case IEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_CL_ORD_ID;
+			break;
+		case IEX_TAG_CumQty:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & IEX_EXECUTION_REPORT_CUM_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->cum_qty = field->float_value;
+			self->present |= IEX_EXECUTION_REPORT_CUM_QTY;
+			break;
+		case IEX_TAG_ExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_EXEC_ID))
+				break;
+			self->exec_id = field->string_value;
+			self->exec_id_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_EXEC_ID;
+			break;
+		case IEX_TAG_ExecInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_EXEC_INST))
+				break;
+			self->exec_inst = field->string_value;
+			self->exec_inst_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_EXEC_INST;
+			break;
+		case IEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_ORDER_ID))
+				break;
+			self->order_id = field->string_value;
+			self->order_id_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_ORDER_ID;
+			break;
+		case IEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_ORDER_QTY))
+				break;
+			self->order_qty = field->string_value;
+			self->order_qty_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_ORDER_QTY;
+			break;
+		case IEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_ORD_TYPE))
+				break;
+			self->ord_type = field->string_value;
+			self->ord_type_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_ORD_TYPE;
+			break;
+		case IEX_TAG_OrderCapacity:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_ORDER_CAPACITY))
+				break;
+			self->order_capacity = field->string_value;
+			self->order_capacity_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_ORDER_CAPACITY;
+			break;
+		case IEX_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_SIDE;
+			break;
+		case IEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_SYMBOL;
+			break;
+		case IEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->string_value;
+			self->time_in_force_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_TIME_IN_FORCE;
+			break;
+		case IEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_TRANSACT_TIME;
+			break;
+		case IEX_TAG_LeavesQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_LEAVES_QTY))
+				break;
+			self->leaves_qty = field->string_value;
+			self->leaves_qty_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_LEAVES_QTY;
+			break;
+		case IEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_ACCOUNT;
+			break;
+		case IEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & IEX_EXECUTION_REPORT_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= IEX_EXECUTION_REPORT_PRICE;
+			break;
+		case IEX_TAG_MinQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_MIN_QTY))
+				break;
+			self->min_qty = field->string_value;
+			self->min_qty_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_MIN_QTY;
+			break;
+		case IEX_TAG_MaxFloor:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_MAX_FLOOR))
+				break;
+			self->max_floor = field->string_value;
+			self->max_floor_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_MAX_FLOOR;
+			break;
+		case IEX_TAG_ExpireTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_EXPIRE_TIME))
+				break;
+			self->expire_time = field->string_value;
+			self->expire_time_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_EXPIRE_TIME;
+			break;
+		case IEX_TAG_ExecTransType:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_EXEC_TRANS_TYPE))
+				break;
+			self->exec_trans_type = field->string_value;
+			self->exec_trans_type_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_EXEC_TRANS_TYPE;
+			break;
+		case IEX_TAG_OrderStatus:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_ORDER_STATUS))
+				break;
+			self->order_status = field->string_value;
+			self->order_status_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_ORDER_STATUS;
+			break;
+		case IEX_TAG_ExecType:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_EXEC_TYPE))
+				break;
+			self->exec_type = field->string_value;
+			self->exec_type_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_EXEC_TYPE;
+			break;
+		case IEX_TAG_LastMkt:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_LAST_MKT))
+				break;
+			self->last_mkt = field->string_value;
+			self->last_mkt_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_LAST_MKT;
+			break;
+		case IEX_TAG_LastPx:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_LAST_PX))
+				break;
+			self->last_px = field->string_value;
+			self->last_px_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_LAST_PX;
+			break;
+		case IEX_TAG_LastShares:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_LAST_SHARES))
+				break;
+			self->last_shares = field->string_value;
+			self->last_shares_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_LAST_SHARES;
+			break;
+		case IEX_TAG_TradeLiquidityIndicator:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_TRADE_LIQUIDITY_INDICATOR))
+				break;
+			self->trade_liquidity_indicator = field->string_value;
+			self->trade_liquidity_indicator_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_TRADE_LIQUIDITY_INDICATOR;
+			break;
+		case IEX_TAG_ClientID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_EXECUTION_REPORT_CLIENT_ID))
+				break;
+			self->client_id = field->string_value;
+			self->client_id_len = field->value_len;
+			self->present |= IEX_EXECUTION_REPORT_CLIENT_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int iex_cancel_reject_parse(struct iex_cancel_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "9\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case IEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_CANCEL_REJECT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= IEX_CANCEL_REJECT_CL_ORD_ID;
+			break;
+		case IEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_CANCEL_REJECT_ORDER_ID))
+				break;
+			self->order_id = field->string_value;
+			self->order_id_len = field->value_len;
+			self->present |= IEX_CANCEL_REJECT_ORDER_ID;
+			break;
+		case IEX_TAG_CxlRejReason:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_CANCEL_REJECT_CXL_REJ_REASON))
+				break;
+			self->cxl_rej_reason = field->string_value;
+			self->cxl_rej_reason_len = field->value_len;
+			self->present |= IEX_CANCEL_REJECT_CXL_REJ_REASON;
+			break;
+		case IEX_TAG_CxlRejResponseTo:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_CANCEL_REJECT_CXL_REJ_RESPONSE_TO))
+				break;
+			self->cxl_rej_response_to = field->string_value;
+			self->cxl_rej_response_to_len = field->value_len;
+			self->present |= IEX_CANCEL_REJECT_CXL_REJ_RESPONSE_TO;
+			break;
+		case IEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & IEX_CANCEL_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= IEX_CANCEL_REJECT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+struct fix_dialect iex_fix_dialect = {
+	.version = FIX_4_2,
+	.tag_type = iex_fix_tag_type,
+	.parse_body = iex_fix_parse_body,
+};
+
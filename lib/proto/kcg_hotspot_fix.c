@@ -0,0 +1,1095 @@
+#include "libtrading/proto/kcg_hotspot_fix.h"
+
+#include "libtrading/proto/fix_message.h"
+
+#include "fix_parse.h"
+
+#include <string.h>
+
+fix_parse_inline enum fix_type kcg_hotspot_fix_tag_type(int tag)
+{
+	switch (tag) {
+	case KCG_HOTSPOT_TAG_SenderCompID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_SenderSubID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_TargetCompID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_OnBehalfOfSubID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_PossDupFlag: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_PossResend: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_SendingTime: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_CheckSum: return FIX_TYPE_CHECKSUM;
+	case KCG_HOTSPOT_TAG_Username: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_Password: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_EncryptMethod: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_HeartBtInt: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ResetSeqNumFlag: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_TestReqID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_BeginSeqNo: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_EndSeqNo: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_RefSeqNum: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_RefTagID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_RefMsgType: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_SessionRejectReason: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_Text: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_NewSeqNo: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_GapFillFlag: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_Account: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ClOrdID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ExecInst: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_HandlInst: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_Currency: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_OrderQty: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_MaxShow: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_MinQty: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_Price: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_Side: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_Symbol: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_OrdType: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_TimeInForce: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_TransactTime: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_PegDifference: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ExecID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ExecTransType: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_OrderID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_OrdStatus: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_OrigClOrdID: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ExecBroker: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_LeavesQty: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_CumQty: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_OrderQty2: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_FutSetlDate: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_TradeDate: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_SettlCurrAmount: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_SettleCurrency: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_SecurityType: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ExecType: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_LastShares: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_LastPx: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_NoContraBrokers: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_ContraBroker: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_CxlRejResponseTo: return FIX_TYPE_STRING;
+	case KCG_HOTSPOT_TAG_CxlRejReason: return FIX_TYPE_STRING;
+	default: return FIX_TYPE_STRING;
+	}
+}
+
+static int kcg_hotspot_fix_parse_body(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
+{
+	return fix_parse_body(self, dialect, kcg_hotspot_fix_tag_type, buffer, flags);
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_logon_parse(struct kcg_hotspot_logon *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "A\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Username:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_LOGON_USERNAME))
+				break;
+			self->username = field->string_value;
+			self->username_len = field->value_len;
+			self->present |= KCG_HOTSPOT_LOGON_USERNAME;
+			break;
+		case KCG_HOTSPOT_TAG_Password:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_LOGON_PASSWORD))
+				break;
+			self->password = field->string_value;
+			self->password_len = field->value_len;
+			self->present |= KCG_HOTSPOT_LOGON_PASSWORD;
+			break;
+		case KCG_HOTSPOT_TAG_EncryptMethod:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_LOGON_ENCRYPT_METHOD))
+				break;
+			self->encrypt_method = field->string_value;
+			self->encrypt_method_len = field->value_len;
+			self->present |= KCG_HOTSPOT_LOGON_ENCRYPT_METHOD;
+			break;
+		case KCG_HOTSPOT_TAG_HeartBtInt:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_LOGON_HEART_BT_INT))
+				break;
+			self->heart_bt_int = field->string_value;
+			self->heart_bt_int_len = field->value_len;
+			self->present |= KCG_HOTSPOT_LOGON_HEART_BT_INT;
+			break;
+		case KCG_HOTSPOT_TAG_ResetSeqNumFlag:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_LOGON_RESET_SEQ_NUM_FLAG))
+				break;
+			self->reset_seq_num_flag = field->string_value;
+			self->reset_seq_num_flag_len = field->value_len;
+			self->present |= KCG_HOTSPOT_LOGON_RESET_SEQ_NUM_FLAG;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_heart_beat_parse(struct kcg_hotspot_heart_beat *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "0\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_TestReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_HEART_BEAT_TEST_REQ_ID))
+				break;
+			self->test_req_id = field->string_value;
+			self->test_req_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_HEART_BEAT_TEST_REQ_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_test_request_parse(struct kcg_hotspot_test_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "1\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_TestReqID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_TEST_REQUEST_TEST_REQ_ID))
+				break;
+			self->test_req_id = field->string_value;
+			self->test_req_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_TEST_REQUEST_TEST_REQ_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_resend_request_parse(struct kcg_hotspot_resend_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "2\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_BeginSeqNo:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_RESEND_REQUEST_BEGIN_SEQ_NO))
+				break;
+			self->begin_seq_no = field->string_value;
+			self->begin_seq_no_len = field->value_len;
+			self->present |= KCG_HOTSPOT_RESEND_REQUEST_BEGIN_SEQ_NO;
+			break;
+		case KCG_HOTSPOT_TAG_EndSeqNo:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_RESEND_REQUEST_END_SEQ_NO))
+				break;
+			self->end_seq_no = field->string_value;
+			self->end_seq_no_len = field->value_len;
+			self->present |= KCG_HOTSPOT_RESEND_REQUEST_END_SEQ_NO;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_reject_parse(struct kcg_hotspot_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "3\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_RefSeqNum:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_REJECT_REF_SEQ_NUM))
+				break;
+			self->ref_seq_num = field->string_value;
+			self->ref_seq_num_len = field->value_len;
+			self->present |= KCG_HOTSPOT_REJECT_REF_SEQ_NUM;
+			break;
+		case KCG_HOTSPOT_TAG_RefTagID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_REJECT_REF_TAG_ID))
+				break;
+			self->ref_tag_id = field->string_value;
+			self->ref_tag_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_REJECT_REF_TAG_ID;
+			break;
+		case KCG_HOTSPOT_TAG_RefMsgType:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_REJECT_REF_MSG_TYPE))
+				break;
+			self->ref_msg_type = field->string_value;
+			self->ref_msg_type_len = field->value_len;
+			self->present |= KCG_HOTSPOT_REJECT_REF_MSG_TYPE;
+			break;
+		case KCG_HOTSPOT_TAG_SessionRejectReason:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_REJECT_SESSION_REJECT_REASON))
+				break;
+			self->session_reject_reason = field->string_value;
+			self->session_reject_reason_len = field->value_len;
+			self->present |= KCG_HOTSPOT_REJECT_SESSION_REJECT_REASON;
+			break;
+		case KCG_HOTSPOT_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= KCG_HOTSPOT_REJECT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_sequence_reset_parse(struct kcg_hotspot_sequence_reset *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "4\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_NewSeqNo:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_SEQUENCE_RESET_NEW_SEQ_NO))
+				break;
+			self->new_seq_no = field->string_value;
+			self->new_seq_no_len = field->value_len;
+			self->present |= KCG_HOTSPOT_SEQUENCE_RESET_NEW_SEQ_NO;
+			break;
+		case KCG_HOTSPOT_TAG_GapFillFlag:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_SEQUENCE_RESET_GAP_FILL_FLAG))
+				break;
+			self->gap_fill_flag = field->string_value;
+			self->gap_fill_flag_len = field->value_len;
+			self->present |= KCG_HOTSPOT_SEQUENCE_RESET_GAP_FILL_FLAG;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_logout_parse(struct kcg_hotspot_logout *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "5\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_LOGOUT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= KCG_HOTSPOT_LOGOUT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_new_order_single_parse(struct kcg_hotspot_new_order_single *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "D\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_ACCOUNT;
+			break;
+		case KCG_HOTSPOT_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_ExecInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_EXEC_INST))
+				break;
+			self->exec_inst = field->string_value;
+			self->exec_inst_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_EXEC_INST;
+			break;
+		case KCG_HOTSPOT_TAG_HandlInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_HANDL_INST))
+				break;
+			self->handl_inst = field->string_value;
+			self->handl_inst_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_HANDL_INST;
+			break;
+		case KCG_HOTSPOT_TAG_Currency:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_CURRENCY))
+				break;
+			self->currency = field->string_value;
+			self->currency_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_CURRENCY;
+			break;
+		case KCG_HOTSPOT_TAG_OrderQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_ORDER_QTY))
+				break;
+			self->order_qty = field->string_value;
+			self->order_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_ORDER_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_MaxShow:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_MAX_SHOW))
+				break;
+			self->max_show = field->string_value;
+			self->max_show_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_MAX_SHOW;
+			break;
+		case KCG_HOTSPOT_TAG_MinQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_MIN_QTY))
+				break;
+			self->min_qty = field->string_value;
+			self->min_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_MIN_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_Price:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_PRICE))
+				break;
+			self->price = field->string_value;
+			self->price_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_PRICE;
+			break;
+		case KCG_HOTSPOT_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_SIDE;
+			break;
+		case KCG_HOTSPOT_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_SYMBOL;
+			break;
+		case KCG_HOTSPOT_TAG_OrdType:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_ORD_TYPE))
+				break;
+			self->ord_type = field->string_value;
+			self->ord_type_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_ORD_TYPE;
+			break;
+		case KCG_HOTSPOT_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->string_value;
+			self->time_in_force_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_TIME_IN_FORCE;
+			break;
+		case KCG_HOTSPOT_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_TRANSACT_TIME;
+			break;
+		case KCG_HOTSPOT_TAG_PegDifference:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_NEW_ORDER_SINGLE_PEG_DIFFERENCE))
+				break;
+			self->peg_difference = field->string_value;
+			self->peg_difference_len = field->value_len;
+			self->present |= KCG_HOTSPOT_NEW_ORDER_SINGLE_PEG_DIFFERENCE;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_execution_report_parse(struct kcg_hotspot_execution_report *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "8\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_ACCOUNT;
+			break;
+		case KCG_HOTSPOT_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_ExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_EXEC_ID))
+				break;
+			self->exec_id = field->string_value;
+			self->exec_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_EXEC_ID;
+			break;
+		case KCG_HOTSPOT_TAG_ExecInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_EXEC_INST))
+				break;
+			self->exec_inst = field->string_value;
+			self->exec_inst_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_EXEC_INST;
+			break;
+		case KCG_HOTSPOT_TAG_ExecTransType:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_EXEC_TRANS_TYPE))
+				break;
+			self->exec_trans_type = field->string_value;
+			self->exec_trans_type_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_EXEC_TRANS_TYPE;
+			break;
+		case KCG_HOTSPOT_TAG_OrderID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_ORDER_ID))
+				break;
+			self->order_id = field->string_value;
+			self->order_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_ORDER_ID;
+			break;
+		case KCG_HOTSPOT_TAG_OrdStatus:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_ORD_STATUS))
+				break;
+			self->ord_status = field->string_value;
+			self->ord_status_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_ORD_STATUS;
+			break;
+		case KCG_HOTSPOT_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_ORIG_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_OrderQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_ORDER_QTY))
+				break;
+			self->order_qty = field->string_value;
+			self->order_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_ORDER_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_Price:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_PRICE))
+				break;
+			self->price = field->string_value;
+			self->price_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_PRICE;
+			break;
+		case KCG_HOTSPOT_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->string_value;
+			self->time_in_force_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_TIME_IN_FORCE;
+			break;
+		case KCG_HOTSPOT_TAG_Currency:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_CURRENCY))
+				break;
+			self->currency = field->string_value;
+			self->currency_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_CURRENCY;
+			break;
+		case KCG_HOTSPOT_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_SIDE;
+			break;
+		case KCG_HOTSPOT_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_SYMBOL;
+			break;
+		case KCG_HOTSPOT_TAG_ExecBroker:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_EXEC_BROKER))
+				break;
+			self->exec_broker = field->string_value;
+			self->exec_broker_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_EXEC_BROKER;
+			break;
+		case KCG_HOTSPOT_TAG_LeavesQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_LEAVES_QTY))
+				break;
+			self->leaves_qty = field->string_value;
+			self->leaves_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_LEAVES_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_CumQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_CUM_QTY))
+				break;
+			self->cum_qty = field->string_value;
+			self->cum_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_CUM_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_MinQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_MIN_QTY))
+				break;
+			self->min_qty = field->string_value;
+			self->min_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_MIN_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_OrderQty2:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_ORDER_QTY2))
+				break;
+			self->order_qty2 = field->string_value;
+			self->order_qty2_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_ORDER_QTY2;
+			break;
+		case KCG_HOTSPOT_TAG_FutSetlDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_FUT_SETL_DATE))
+				break;
+			self->fut_setl_date = field->string_value;
+			self->fut_setl_date_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_FUT_SETL_DATE;
+			break;
+		case KCG_HOTSPOT_TAG_TradeDate:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_TRADE_DATE))
+				break;
+			self->trade_date = field->string_value;
+			self->trade_date_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_TRADE_DATE;
+			break;
+		case KCG_HOTSPOT_TAG_SettlCurrAmount:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_SETTL_CURR_AMOUNT))
+				break;
+			self->settl_curr_amount = field->string_value;
+			self->settl_curr_amount_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_SETTL_CURR_AMOUNT;
+			break;
+		case KCG_HOTSPOT_TAG_SettleCurrency:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_SETTLE_CURRENCY))
+				break;
+			self->settle_currency = field->string_value;
+			self->settle_currency_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_SETTLE_CURRENCY;
+			break;
+		case KCG_HOTSPOT_TAG_SecurityType:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_SECURITY_TYPE))
+				break;
+			self->security_type = field->string_value;
+			self->security_type_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_SECURITY_TYPE;
+			break;
+		case KCG_HOTSPOT_TAG_MaxShow:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_MAX_SHOW))
+				break;
+			self->max_show = field->string_value;
+			self->max_show_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_MAX_SHOW;
+			break;
+		case KCG_HOTSPOT_TAG_ExecType:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_EXEC_TYPE))
+				break;
+			self->exec_type = field->string_value;
+			self->exec_type_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_EXEC_TYPE;
+			break;
+		case KCG_HOTSPOT_TAG_LastShares:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_LAST_SHARES))
+				break;
+			self->last_shares = field->string_value;
+			self->last_shares_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_LAST_SHARES;
+			break;
+		case KCG_HOTSPOT_TAG_LastPx:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_LAST_PX))
+				break;
+			self->last_px = field->string_value;
+			self->last_px_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_LAST_PX;
+			break;
+		case KCG_HOTSPOT_TAG_NoContraBrokers:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_NO_CONTRA_BROKERS))
+				break;
+			self->no_contra_brokers = field->string_value;
+			self->no_contra_brokers_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_NO_CONTRA_BROKERS;
+			break;
+		case KCG_HOTSPOT_TAG_ContraBroker:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_CONTRA_BROKER))
+				break;
+			self->contra_broker = field->string_value;
+			self->contra_broker_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_CONTRA_BROKER;
+			break;
+		case KCG_HOTSPOT_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_TEXT;
+			break;
+		case KCG_HOTSPOT_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_EXECUTION_REPORT_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= KCG_HOTSPOT_EXECUTION_REPORT_TRANSACT_TIME;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_order_cancel_request_parse(struct kcg_hotspot_order_cancel_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "F\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REQUEST_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REQUEST_ACCOUNT;
+			break;
+		case KCG_HOTSPOT_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REQUEST_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REQUEST_ORIG_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REQUEST_SYMBOL;
+			break;
+		case KCG_HOTSPOT_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REQUEST_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REQUEST_SIDE;
+			break;
+		case KCG_HOTSPOT_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REQUEST_TRANSACT_TIME;
+			break;
+		case KCG_HOTSPOT_TAG_Currency:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REQUEST_CURRENCY))
+				break;
+			self->currency = field->string_value;
+			self->currency_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REQUEST_CURRENCY;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_order_cancel_replace_request_parse(struct kcg_hotspot_order_cancel_replace_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "G\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ACCOUNT;
+			break;
+		case KCG_HOTSPOT_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORIG_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_HandlInst:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST))
+				break;
+			self->handl_inst = field->string_value;
+			self->handl_inst_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_HANDL_INST;
+			break;
+		case KCG_HOTSPOT_TAG_OrderQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY))
+				break;
+			self->order_qty = field->string_value;
+			self->order_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORDER_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_MaxShow:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW))
+				break;
+			self->max_show = field->string_value;
+			self->max_show_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_MAX_SHOW;
+			break;
+		case KCG_HOTSPOT_TAG_MinQty:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_MIN_QTY))
+				break;
+			self->min_qty = field->string_value;
+			self->min_qty_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_MIN_QTY;
+			break;
+		case KCG_HOTSPOT_TAG_Price:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_PRICE))
+				break;
+			self->price = field->string_value;
+			self->price_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_PRICE;
+			break;
+		case KCG_HOTSPOT_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_SYMBOL;
+			break;
+		case KCG_HOTSPOT_TAG_OrdType:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE))
+				break;
+			self->ord_type = field->string_value;
+			self->ord_type_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_ORD_TYPE;
+			break;
+		case KCG_HOTSPOT_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_SIDE;
+			break;
+		case KCG_HOTSPOT_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REPLACE_REQUEST_TRANSACT_TIME;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_order_cancel_reject_parse(struct kcg_hotspot_order_cancel_reject *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "9\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_ACCOUNT;
+			break;
+		case KCG_HOTSPOT_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_OrderID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_ORDER_ID))
+				break;
+			self->order_id = field->string_value;
+			self->order_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_ORDER_ID;
+			break;
+		case KCG_HOTSPOT_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_ORIG_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_SYMBOL;
+			break;
+		case KCG_HOTSPOT_TAG_CxlRejResponseTo:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_CXL_REJ_RESPONSE_TO))
+				break;
+			self->cxl_rej_response_to = field->string_value;
+			self->cxl_rej_response_to_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_CXL_REJ_RESPONSE_TO;
+			break;
+		case KCG_HOTSPOT_TAG_CxlRejReason:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_CXL_REJ_REASON))
+				break;
+			self->cxl_rej_reason = field->string_value;
+			self->cxl_rej_reason_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_CXL_REJ_REASON;
+			break;
+		case KCG_HOTSPOT_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_CANCEL_REJECT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_CANCEL_REJECT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int kcg_hotspot_order_status_request_parse(struct kcg_hotspot_order_status_request *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "H\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case KCG_HOTSPOT_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_STATUS_REQUEST_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_STATUS_REQUEST_ACCOUNT;
+			break;
+		case KCG_HOTSPOT_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_STATUS_REQUEST_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_STATUS_REQUEST_CL_ORD_ID;
+			break;
+		case KCG_HOTSPOT_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_STATUS_REQUEST_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_STATUS_REQUEST_SYMBOL;
+			break;
+		case KCG_HOTSPOT_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_STATUS_REQUEST_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_STATUS_REQUEST_SIDE;
+			break;
+		case KCG_HOTSPOT_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & KCG_HOTSPOT_ORDER_STATUS_REQUEST_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= KCG_HOTSPOT_ORDER_STATUS_REQUEST_TRANSACT_TIME;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+struct fix_dialect kcg_hotspot_fix_dialect = {
+	.version = FIX_4_2,
+	.tag_type = kcg_hotspot_fix_tag_type,
+	.parse_body = kcg_hotspot_fix_parse_body,
+};
+
@@ -5,24 +5,36 @@
 #include <stdlib.h>
 #include <string.h>
 
-int lse_itch_message_decode(struct buffer *buf, struct lse_itch_message *msg)
+struct lse_itch_message *lse_itch_message_view(struct buffer *buf)
 {
-	size_t available;
+	struct buffer_view view;
 	size_t size;
 
-	available = buffer_size(buf);
-
-	if (!available)
-		return -1;
+	if (!buffer_view(buf, sizeof(struct lse_itch_message), &view))
+		return NULL;
 
-	size = buffer_peek_8(buf);
+	size = view_8(&view, 0);
 
-	if (available < size)
-		return -1;
+	if (size < sizeof(struct lse_itch_message))
+		return NULL;
 
-	memcpy(msg, buffer_start(buf), size);
+	if (!buffer_view(buf, size, &view))
+		return NULL;
 
 	buffer_advance(buf, size);
 
+	return (void *) view_ptr(&view, 0);
+}
+
+int lse_itch_message_decode(struct buffer *buf, struct lse_itch_message *msg)
+{
+	struct lse_itch_message *frame;
+
+	frame = lse_itch_message_view(buf);
+	if (!frame)
+		return -1;
+
+	memcpy(msg, frame, frame->Length);
+
 	return 0;
 }
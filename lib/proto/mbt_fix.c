@@ -0,0 +1,194 @@
+#include "libtrading/proto/mbt_fix.h"
+
+#include "libtrading/proto/fix_message.h"
+
+#include "fix_parse.h"
+
+#include <string.h>
+
+fix_parse_inline enum fix_type mbt_fix_tag_type(int tag)
+{
+	switch (tag) {
+	case MBT_TAG_SenderCompID: return FIX_TYPE_STRING;
+	case MBT_TAG_SendingTime: return FIX_TYPE_STRING;
+	case MBT_TAG_TargetCompID: return FIX_TYPE_STRING;
+	case MBT_TAG_CheckSum: return FIX_TYPE_CHECKSUM;
+	case MBT_TAG_PossDupFlag: return FIX_TYPE_STRING;
+	case MBT_TAG_EncryptMethod: return FIX_TYPE_STRING;
+	case MBT_TAG_OnBehalfOfSubID: return FIX_TYPE_STRING;
+	case MBT_TAG_DeliverToSubID: return FIX_TYPE_STRING;
+	case MBT_TAG_ResetSeqNumFlag: return FIX_TYPE_STRING;
+	case MBT_TAG_SenderLocationID: return FIX_TYPE_STRING;
+	case MBT_TAG_MessageEncoding: return FIX_TYPE_STRING;
+	case MBT_TAG_Password: return FIX_TYPE_STRING;
+	case MBT_TAG_LiquidityTag: return FIX_TYPE_STRING;
+	case MBT_TAG_PosPendBuy: return FIX_TYPE_STRING;
+	case MBT_TAG_PosPendSell: return FIX_TYPE_STRING;
+	case MBT_TAG_MorningBuyingPower: return FIX_TYPE_STRING;
+	case MBT_TAG_PosBuyPowerUsed: return FIX_TYPE_STRING;
+	case MBT_TAG_PosRealizedPNL: return FIX_TYPE_STRING;
+	case MBT_TAG_MBTAccountType: return FIX_TYPE_STRING;
+	case MBT_TAG_OvernightBuyingPower: return FIX_TYPE_STRING;
+	case MBT_TAG_RealizedPnL: return FIX_TYPE_STRING;
+	case MBT_TAG_MorningAccountValue: return FIX_TYPE_STRING;
+	case MBT_TAG_MorningExcessEquity: return FIX_TYPE_STRING;
+	case MBT_TAG_PosEquityUsed: return FIX_TYPE_STRING;
+	case MBT_TAG_MBTInternalOrderId: return FIX_TYPE_STRING;
+	case MBT_TAG_AccountCredit: return FIX_TYPE_STRING;
+	case MBT_TAG_MBTXAggressive: return FIX_TYPE_STRING;
+	case MBT_TAG_AccBasedPermsBitMap: return FIX_TYPE_STRING;
+	case MBT_TAG_MorningExcessEquity2: return FIX_TYPE_STRING;
+	case MBT_TAG_OptionStrategyCode: return FIX_TYPE_STRING;
+	case MBT_TAG_OvernightExcess: return FIX_TYPE_STRING;
+	case MBT_TAG_BODOOvernightExcessEq: return FIX_TYPE_STRING;
+	case MBT_TAG_OrderGroupID1: return FIX_TYPE_STRING;
+	case MBT_TAG_UserQuote: return FIX_TYPE_STRING;
+	case MBT_TAG_PosRunAvgPrice: return FIX_TYPE_STRING;
+	case MBT_TAG_MultiSymbol: return FIX_TYPE_STRING;
+	case MBT_TAG_MultiPrice: return FIX_TYPE_STRING;
+	case MBT_TAG_MBTMultifunction: return FIX_TYPE_STRING;
+	case MBT_TAG_TodayRealizedPNL2: return FIX_TYPE_STRING;
+	case MBT_TAG_UserRoutePerm: return FIX_TYPE_STRING;
+	case MBT_TAG_TriggerFromOrderID: return FIX_TYPE_STRING;
+	case MBT_TAG_CompanyID: return FIX_TYPE_STRING;
+	case MBT_TAG_AccountBank: return FIX_TYPE_STRING;
+	case MBT_TAG_AccountBranch: return FIX_TYPE_STRING;
+	case MBT_TAG_FLID: return FIX_TYPE_STRING;
+	case MBT_TAG_UserSessionID: return FIX_TYPE_STRING;
+	default: return FIX_TYPE_STRING;
+	}
+}
+
+static int mbt_fix_parse_body(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
+{
+	return fix_parse_body(self, dialect, mbt_fix_tag_type, buffer, flags);
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int mbt_logon_parse(struct mbt_logon *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "A\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case MBT_TAG_EncryptMethod:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_LOGON_ENCRYPT_METHOD))
+				break;
+			self->encrypt_method = field->string_value;
+			self->encrypt_method_len = field->value_len;
+			self->present |= MBT_LOGON_ENCRYPT_METHOD;
+			break;
+		case MBT_TAG_ResetSeqNumFlag:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_LOGON_RESET_SEQ_NUM_FLAG))
+				break;
+			self->reset_seq_num_flag = field->string_value;
+			self->reset_seq_num_flag_len = field->value_len;
+			self->present |= MBT_LOGON_RESET_SEQ_NUM_FLAG;
+			break;
+		case MBT_TAG_MessageEncoding:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_LOGON_MESSAGE_ENCODING))
+				break;
+			self->message_encoding = field->string_value;
+			self->message_encoding_len = field->value_len;
+			self->present |= MBT_LOGON_MESSAGE_ENCODING;
+			break;
+		case MBT_TAG_Password:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_LOGON_PASSWORD))
+				break;
+			self->password = field->string_value;
+			self->password_len = field->value_len;
+			self->present |= MBT_LOGON_PASSWORD;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int mbt_new_order_single_parse(struct mbt_new_order_single *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "D\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case MBT_TAG_SendingTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_NEW_ORDER_SINGLE_SENDING_TIME))
+				break;
+			self->sending_time = field->string_value;
+			self->sending_time_len = field->value_len;
+			self->present |= MBT_NEW_ORDER_SINGLE_SENDING_TIME;
+			break;
+		case MBT_TAG_MBTXAggressive:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_NEW_ORDER_SINGLE_MBTX_AGGRESSIVE))
+				break;
+			self->mbtx_aggressive = field->string_value;
+			self->mbtx_aggressive_len = field->value_len;
+			self->present |= MBT_NEW_ORDER_SINGLE_MBTX_AGGRESSIVE;
+			break;
+		case MBT_TAG_MultiSymbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_NEW_ORDER_SINGLE_MULTI_SYMBOL))
+				break;
+			self->multi_symbol = field->string_value;
+			self->multi_symbol_len = field->value_len;
+			self->present |= MBT_NEW_ORDER_SINGLE_MULTI_SYMBOL;
+			break;
+		case MBT_TAG_MultiPrice:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_NEW_ORDER_SINGLE_MULTI_PRICE))
+				break;
+			self->multi_price = field->string_value;
+			self->multi_price_len = field->value_len;
+			self->present |= MBT_NEW_ORDER_SINGLE_MULTI_PRICE;
+			break;
+		case MBT_TAG_MBTMultifunction:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_NEW_ORDER_SINGLE_MBT_MULTIFUNCTION))
+				break;
+			self->mbt_multifunction = field->string_value;
+			self->mbt_multifunction_len = field->value_len;
+			self->present |= MBT_NEW_ORDER_SINGLE_MBT_MULTIFUNCTION;
+			break;
+		case MBT_TAG_TriggerFromOrderID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MBT_NEW_ORDER_SINGLE_TRIGGER_FROM_ORDER_ID))
+				break;
+			self->trigger_from_order_id = field->string_value;
+			self->trigger_from_order_id_len = field->value_len;
+			self->present |= MBT_NEW_ORDER_SINGLE_TRIGGER_FROM_ORDER_ID;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+struct fix_dialect mbt_fix_dialect = {
+	.version = FIX_4_4,
+	.tag_type = mbt_fix_tag_type,
+	.parse_body = mbt_fix_parse_body,
+};
+
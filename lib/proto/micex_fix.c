@@ -0,0 +1,530 @@
+#include "libtrading/proto/micex_fix.h"
+
+#include "libtrading/proto/fix_message.h"
+
+#include "fix_parse.h"
+
+#include <string.h>
+
+fix_parse_inline enum fix_type micex_fix_tag_type(int tag)
+{
+	switch (tag) {
+	case MICEX_TAG_BeginString: return FIX_TYPE_STRING;
+	case MICEX_TAG_BodyLength: return FIX_TYPE_INT;
+	case MICEX_TAG_MsgType: return FIX_TYPE_STRING;
+	case MICEX_TAG_SenderCompID: return FIX_TYPE_STRING;
+	case MICEX_TAG_TargetCompID: return FIX_TYPE_STRING;
+	case MICEX_TAG_MsgSeqNum: return FIX_TYPE_MSGSEQNUM;
+	case MICEX_TAG_PossDupFlag: return FIX_TYPE_STRING;
+	case MICEX_TAG_PossResend: return FIX_TYPE_STRING;
+	case MICEX_TAG_SendingTime: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrigSendingTime: return FIX_TYPE_STRING;
+	case MICEX_TAG_CheckSum: return FIX_TYPE_CHECKSUM;
+	case MICEX_TAG_Symbol: return FIX_TYPE_STRING;
+	case MICEX_TAG_Product: return FIX_TYPE_INT;
+	case MICEX_TAG_CFICode: return FIX_TYPE_STRING;
+	case MICEX_TAG_SecurityType: return FIX_TYPE_STRING;
+	case MICEX_TAG_Yield: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_NoPartyID: return FIX_TYPE_GROUP;
+	case MICEX_TAG_PartyID: return FIX_TYPE_STRING;
+	case MICEX_TAG_PartyIDSource: return FIX_TYPE_STRING;
+	case MICEX_TAG_PartyRole: return FIX_TYPE_INT;
+	case MICEX_TAG_Commission: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_CommType: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrderQty: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_CashOrderQty: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_NoTrdRegTimestamps: return FIX_TYPE_GROUP;
+	case MICEX_TAG_TrdRegTimestamp: return FIX_TYPE_STRING;
+	case MICEX_TAG_TrdRegTimestampType: return FIX_TYPE_INT;
+	case MICEX_TAG_StartDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_EndDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_DeliveryType: return FIX_TYPE_INT;
+	case MICEX_TAG_UnderlyingSymbol: return FIX_TYPE_STRING;
+	case MICEX_TAG_NoUnderlyingStips: return FIX_TYPE_GROUP;
+	case MICEX_TAG_UnderlyingStipType: return FIX_TYPE_STRING;
+	case MICEX_TAG_UnderlyingStipValue: return FIX_TYPE_STRING;
+	case MICEX_TAG_EncryptMethod: return FIX_TYPE_INT;
+	case MICEX_TAG_HeartBtInt: return FIX_TYPE_INT;
+	case MICEX_TAG_ResetSeqNumFlag: return FIX_TYPE_STRING;
+	case MICEX_TAG_Password: return FIX_TYPE_STRING;
+	case MICEX_TAG_NewPassword: return FIX_TYPE_STRING;
+	case MICEX_TAG_SessionStatus: return FIX_TYPE_INT;
+	case MICEX_TAG_CancelOnDisconnect: return FIX_TYPE_INT;
+	case MICEX_TAG_Text: return FIX_TYPE_STRING;
+	case MICEX_TAG_TestReqID: return FIX_TYPE_STRING;
+	case MICEX_TAG_BeginSeqNo: return FIX_TYPE_INT;
+	case MICEX_TAG_EndSeqNo: return FIX_TYPE_INT;
+	case MICEX_TAG_GapFillFlag: return FIX_TYPE_STRING;
+	case MICEX_TAG_NewSeqNo: return FIX_TYPE_INT;
+	case MICEX_TAG_RefSeqNum: return FIX_TYPE_INT;
+	case MICEX_TAG_RefTagID: return FIX_TYPE_INT;
+	case MICEX_TAG_RefMsgType: return FIX_TYPE_STRING;
+	case MICEX_TAG_SessionRejectReason: return FIX_TYPE_INT;
+	case MICEX_TAG_OrderID: return FIX_TYPE_STRING;
+	case MICEX_TAG_ClOrdID: return FIX_TYPE_STRING;
+	case MICEX_TAG_Account: return FIX_TYPE_STRING;
+	case MICEX_TAG_MaxFloor: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_SecondaryClOrdID: return FIX_TYPE_STRING;
+	case MICEX_TAG_NoTradingSessions: return FIX_TYPE_INT;
+	case MICEX_TAG_TradingSessionID: return FIX_TYPE_STRING;
+	case MICEX_TAG_Side: return FIX_TYPE_STRING;
+	case MICEX_TAG_TransactTime: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrdType: return FIX_TYPE_STRING;
+	case MICEX_TAG_PriceType: return FIX_TYPE_INT;
+	case MICEX_TAG_Price: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_TradeThruTime: return FIX_TYPE_STRING;
+	case MICEX_TAG_TimeInForce: return FIX_TYPE_STRING;
+	case MICEX_TAG_EffectiveTime: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrderCapacity: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrderRestrictions: return FIX_TYPE_STRING;
+	case MICEX_TAG_MaxPriceLevels: return FIX_TYPE_INT;
+	case MICEX_TAG_OrigClOrdID: return FIX_TYPE_STRING;
+	case MICEX_TAG_CancelOrigOnReject: return FIX_TYPE_STRING;
+	case MICEX_TAG_MassCancelRequestType: return FIX_TYPE_STRING;
+	case MICEX_TAG_UnsolicitedIndicator: return FIX_TYPE_STRING;
+	case MICEX_TAG_TradSesStatus: return FIX_TYPE_INT;
+	case MICEX_TAG_ExecID: return FIX_TYPE_STRING;
+	case MICEX_TAG_ExecType: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrdStatus: return FIX_TYPE_STRING;
+	case MICEX_TAG_WorkingIndicator: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrdRejReason: return FIX_TYPE_INT;
+	case MICEX_TAG_ExecRestatementReason: return FIX_TYPE_INT;
+	case MICEX_TAG_SettDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_OptionSettDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_LastQty: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_LastPx: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_TradingSessionSubID: return FIX_TYPE_STRING;
+	case MICEX_TAG_LeavesQty: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_CumQty: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_AvgPx: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_OrigTime: return FIX_TYPE_STRING;
+	case MICEX_TAG_StipulationValue: return FIX_TYPE_STRING;
+	case MICEX_TAG_CurrencyCode: return FIX_TYPE_STRING;
+	case MICEX_TAG_InstitutionID: return FIX_TYPE_STRING;
+	case MICEX_TAG_CoverID: return FIX_TYPE_STRING;
+	case MICEX_TAG_ClientAccID: return FIX_TYPE_STRING;
+	case MICEX_TAG_TradeIssueDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_OrigOrderID: return FIX_TYPE_STRING;
+	case MICEX_TAG_AccruedInterestAmt: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_NoMiscFees: return FIX_TYPE_GROUP;
+	case MICEX_TAG_MiscFeeAmt: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_MiscFeeType: return FIX_TYPE_INT;
+	case MICEX_TAG_MDEntryID: return FIX_TYPE_STRING;
+	case MICEX_TAG_MassCancelResponse: return FIX_TYPE_STRING;
+	case MICEX_TAG_MassCancelRejectReason: return FIX_TYPE_INT;
+	case MICEX_TAG_CxlRejResponseTo: return FIX_TYPE_STRING;
+	case MICEX_TAG_CxlRejReason: return FIX_TYPE_INT;
+	case MICEX_TAG_TradeReportID: return FIX_TYPE_STRING;
+	case MICEX_TAG_TrdType: return FIX_TYPE_INT;
+	case MICEX_TAG_TrdSubType: return FIX_TYPE_INT;
+	case MICEX_TAG_SecondaryTradeReportID: return FIX_TYPE_STRING;
+	case MICEX_TAG_PreviouslyReported: return FIX_TYPE_STRING;
+	case MICEX_TAG_NoUnderlyings: return FIX_TYPE_INT;
+	case MICEX_TAG_CalculatedCcyLastQty: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_TradeDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_SettlType: return FIX_TYPE_STRING;
+	case MICEX_TAG_OptionSettlType: return FIX_TYPE_STRING;
+	case MICEX_TAG_NoSides: return FIX_TYPE_INT;
+	case MICEX_TAG_GrossTradeAmt: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_EndAccruedInterestAmt: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_StartCash: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_EndCash: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_SettlInstID: return FIX_TYPE_STRING;
+	case MICEX_TAG_Price2: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_ClearingStatus: return FIX_TYPE_STRING;
+	case MICEX_TAG_ClearingRefNo: return FIX_TYPE_STRING;
+	case MICEX_TAG_ClearingHandlingType: return FIX_TYPE_STRING;
+	case MICEX_TAG_OperationType: return FIX_TYPE_INT;
+	case MICEX_TAG_Price1: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_CurrentRepoValue: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_CurrentRepoBackValue: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_TradeBalance: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_TotalAmount: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_LastCouponPaymentValue: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_LastCouponPaymentDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_LastPrincipalPaymentValue: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_LastPrincipalPaymentDate: return FIX_TYPE_STRING;
+	case MICEX_TAG_ExpectedDiscount: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_ExpectedQty: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_ExpectedRepoValue: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_ExpectedRepoBackValue: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_ExpectedReturnValue: return FIX_TYPE_FLOAT;
+	case MICEX_TAG_PreciseBalance: return FIX_TYPE_FLOAT;
+	default: return FIX_TYPE_STRING;
+	}
+}
+
+static const int micex_fix_NoPartyID_members[] = {
+	448,	/* PartyID */
+	447,	/* PartyIDSource */
+	452,	/* PartyRole */
+	0,
+};
+
+static const struct fix_group_def micex_fix_NoPartyID = { MICEX_TAG_NoPartyID, micex_fix_NoPartyID_members };
+
+static const int micex_fix_NoTrdRegTimestamps_members[] = {
+	769,	/* TrdRegTimestamp */
+	770,	/* TrdRegTimestampType */
+	0,
+};
+
+static const struct fix_group_def micex_fix_NoTrdRegTimestamps = { MICEX_TAG_NoTrdRegTimestamps, micex_fix_NoTrdRegTimestamps_members };
+
+static const int micex_fix_NoUnderlyingStips_members[] = {
+	888,	/* UnderlyingStipType */
+	889,	/* UnderlyingStipValue */
+	0,
+};
+
+static const struct fix_group_def micex_fix_NoUnderlyingStips = { MICEX_TAG_NoUnderlyingStips, micex_fix_NoUnderlyingStips_members };
+
+static const int micex_fix_NoMiscFees_members[] = {
+	137,	/* MiscFeeAmt */
+	139,	/* MiscFeeType */
+	0,
+};
+
+static const struct fix_group_def micex_fix_NoMiscFees = { MICEX_TAG_NoMiscFees, micex_fix_NoMiscFees_members };
+
+static const struct fix_group_def *micex_fix_group_def(int tag)
+{
+	switch (tag) {
+	case MICEX_TAG_NoPartyID: return &micex_fix_NoPartyID;
+	case MICEX_TAG_NoTrdRegTimestamps: return &micex_fix_NoTrdRegTimestamps;
+	case MICEX_TAG_NoUnderlyingStips: return &micex_fix_NoUnderlyingStips;
+	case MICEX_TAG_NoMiscFees: return &micex_fix_NoMiscFees;
+	default: return NULL;
+	}
+}
+
+static int micex_fix_parse_body(struct fix_message *self, struct fix_dialect *dialect, struct buffer *buffer, unsigned long flags)
+{
+	return fix_parse_body(self, dialect, micex_fix_tag_type, buffer, flags);
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int micex_new_order_single_parse(struct micex_new_order_single *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "D\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case MICEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_CL_ORD_ID;
+			break;
+		case MICEX_TAG_NoPartyID:
+			if (field->type != FIX_TYPE_INT || (self->present & MICEX_NEW_ORDER_SINGLE_NO_PARTY_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->no_party_id = field->int_value;
+			self->present |= MICEX_NEW_ORDER_SINGLE_NO_PARTY_ID;
+			break;
+		case MICEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_ACCOUNT;
+			break;
+		case MICEX_TAG_MaxFloor:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_NEW_ORDER_SINGLE_MAX_FLOOR))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->max_floor = field->float_value;
+			self->present |= MICEX_NEW_ORDER_SINGLE_MAX_FLOOR;
+			break;
+		case MICEX_TAG_SecondaryClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_SECONDARY_CL_ORD_ID))
+				break;
+			self->secondary_cl_ord_id = field->string_value;
+			self->secondary_cl_ord_id_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_SECONDARY_CL_ORD_ID;
+			break;
+		case MICEX_TAG_TradingSessionID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_TRADING_SESSION_ID))
+				break;
+			self->trading_session_id = field->string_value;
+			self->trading_session_id_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_TRADING_SESSION_ID;
+			break;
+		case MICEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_SYMBOL;
+			break;
+		case MICEX_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_SIDE;
+			break;
+		case MICEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_TRANSACT_TIME;
+			break;
+		case MICEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_NEW_ORDER_SINGLE_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->float_value;
+			self->present |= MICEX_NEW_ORDER_SINGLE_ORDER_QTY;
+			break;
+		case MICEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_ORD_TYPE))
+				break;
+			self->ord_type = field->string_value;
+			self->ord_type_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_ORD_TYPE;
+			break;
+		case MICEX_TAG_PriceType:
+			if (field->type != FIX_TYPE_INT || (self->present & MICEX_NEW_ORDER_SINGLE_PRICE_TYPE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price_type = field->int_value;
+			self->present |= MICEX_NEW_ORDER_SINGLE_PRICE_TYPE;
+			break;
+		case MICEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_NEW_ORDER_SINGLE_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= MICEX_NEW_ORDER_SINGLE_PRICE;
+			break;
+		case MICEX_TAG_TimeInForce:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_TIME_IN_FORCE))
+				break;
+			self->time_in_force = field->string_value;
+			self->time_in_force_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_TIME_IN_FORCE;
+			break;
+		case MICEX_TAG_OrderCapacity:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_NEW_ORDER_SINGLE_ORDER_CAPACITY))
+				break;
+			self->order_capacity = field->string_value;
+			self->order_capacity_len = field->value_len;
+			self->present |= MICEX_NEW_ORDER_SINGLE_ORDER_CAPACITY;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fill in the members of the tags that 'msg' has, in one pass over its
+ * fields. Only the first occurrence of a tag counts, and only if it was
+ * parsed with the type the member expects.
+ */
+int micex_execution_report_parse(struct micex_execution_report *self, struct fix_message *msg)
+{
+	unsigned long i;
+
+	if (!msg->msg_type || memcmp(msg->msg_type, "8\001", 2))
+		return -1;
+
+	self->present = 0;
+
+	for (i = 0; i < msg->nr_fields; i++) {
+		struct fix_field *field = &msg->fields[i];
+
+		switch (field->tag) {
+		case MICEX_TAG_OrderID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_ORDER_ID))
+				break;
+			self->order_id = field->string_value;
+			self->order_id_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_ORDER_ID;
+			break;
+		case MICEX_TAG_SecondaryClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_SECONDARY_CL_ORD_ID))
+				break;
+			self->secondary_cl_ord_id = field->string_value;
+			self->secondary_cl_ord_id_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_SECONDARY_CL_ORD_ID;
+			break;
+		case MICEX_TAG_ClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_CL_ORD_ID))
+				break;
+			self->cl_ord_id = field->string_value;
+			self->cl_ord_id_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_CL_ORD_ID;
+			break;
+		case MICEX_TAG_OrigClOrdID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_ORIG_CL_ORD_ID))
+				break;
+			self->orig_cl_ord_id = field->string_value;
+			self->orig_cl_ord_id_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_ORIG_CL_ORD_ID;
+			break;
+		case MICEX_TAG_NoPartyID:
+			if (field->type != FIX_TYPE_INT || (self->present & MICEX_EXECUTION_REPORT_NO_PARTY_ID))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->no_party_id = field->int_value;
+			self->present |= MICEX_EXECUTION_REPORT_NO_PARTY_ID;
+			break;
+		case MICEX_TAG_ExecID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_EXEC_ID))
+				break;
+			self->exec_id = field->string_value;
+			self->exec_id_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_EXEC_ID;
+			break;
+		case MICEX_TAG_ExecType:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_EXEC_TYPE))
+				break;
+			self->exec_type = field->string_value;
+			self->exec_type_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_EXEC_TYPE;
+			break;
+		case MICEX_TAG_OrdStatus:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_ORD_STATUS))
+				break;
+			self->ord_status = field->string_value;
+			self->ord_status_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_ORD_STATUS;
+			break;
+		case MICEX_TAG_OrdRejReason:
+			if (field->type != FIX_TYPE_INT || (self->present & MICEX_EXECUTION_REPORT_ORD_REJ_REASON))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->ord_rej_reason = field->int_value;
+			self->present |= MICEX_EXECUTION_REPORT_ORD_REJ_REASON;
+			break;
+		case MICEX_TAG_Account:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_ACCOUNT))
+				break;
+			self->account = field->string_value;
+			self->account_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_ACCOUNT;
+			break;
+		case MICEX_TAG_Symbol:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_SYMBOL))
+				break;
+			self->symbol = field->string_value;
+			self->symbol_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_SYMBOL;
+			break;
+		case MICEX_TAG_Side:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_SIDE))
+				break;
+			self->side = field->string_value;
+			self->side_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_SIDE;
+			break;
+		case MICEX_TAG_OrderQty:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_EXECUTION_REPORT_ORDER_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->order_qty = field->float_value;
+			self->present |= MICEX_EXECUTION_REPORT_ORDER_QTY;
+			break;
+		case MICEX_TAG_OrdType:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_ORD_TYPE))
+				break;
+			self->ord_type = field->string_value;
+			self->ord_type_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_ORD_TYPE;
+			break;
+		case MICEX_TAG_Price:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_EXECUTION_REPORT_PRICE))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->price = field->float_value;
+			self->present |= MICEX_EXECUTION_REPORT_PRICE;
+			break;
+		case MICEX_TAG_LastQty:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_EXECUTION_REPORT_LAST_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->last_qty = field->float_value;
+			self->present |= MICEX_EXECUTION_REPORT_LAST_QTY;
+			break;
+		case MICEX_TAG_LastPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_EXECUTION_REPORT_LAST_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->last_px = field->float_value;
+			self->present |= MICEX_EXECUTION_REPORT_LAST_PX;
+			break;
+		case MICEX_TAG_TradingSessionID:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_TRADING_SESSION_ID))
+				break;
+			self->trading_session_id = field->string_value;
+			self->trading_session_id_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_TRADING_SESSION_ID;
+			break;
+		case MICEX_TAG_LeavesQty:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_EXECUTION_REPORT_LEAVES_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->leaves_qty = field->float_value;
+			self->present |= MICEX_EXECUTION_REPORT_LEAVES_QTY;
+			break;
+		case MICEX_TAG_CumQty:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_EXECUTION_REPORT_CUM_QTY))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->cum_qty = field->float_value;
+			self->present |= MICEX_EXECUTION_REPORT_CUM_QTY;
+			break;
+		case MICEX_TAG_AvgPx:
+			if (field->type != FIX_TYPE_FLOAT || (self->present & MICEX_EXECUTION_REPORT_AVG_PX))
+				break;
+			field = fix_get_field_at(msg, i);
+			self->avg_px = field->float_value;
+			self->present |= MICEX_EXECUTION_REPORT_AVG_PX;
+			break;
+		case MICEX_TAG_TransactTime:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_TRANSACT_TIME))
+				break;
+			self->transact_time = field->string_value;
+			self->transact_time_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_TRANSACT_TIME;
+			break;
+		case MICEX_TAG_Text:
+			if (field->type != FIX_TYPE_STRING || (self->present & MICEX_EXECUTION_REPORT_TEXT))
+				break;
+			self->text = field->string_value;
+			self->text_len = field->value_len;
+			self->present |= MICEX_EXECUTION_REPORT_TEXT;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+struct fix_dialect micex_fix_dialect = {
+	.version = FIX_4_4,
+	.tag_type = micex_fix_tag_type,
+	.group_def = micex_fix_group_def,
+	.parse_body = micex_fix_parse_body,
+};
+
@@ -2,7 +2,6 @@
 
 #include "libtrading/buffer.h"
 
-#include <assert.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -33,41 +32,44 @@ void soupbin3_session_delete(struct soupbin3_session *session)
 	free(session);
 }
 
-static int soupbin3_packet_decode(struct buffer *buf, u16 len, struct soupbin3_packet *packet)
+struct soupbin3_packet *soupbin3_session_recv_view(struct soupbin3_session *session)
 {
+	struct buffer *buf = session->rx_buffer;
+	struct buffer_view view;
 	size_t size;
-	void *start;
+	ssize_t nr;
 
-	start = buffer_start(buf);
+	for (;;) {
+		if (buffer_view(buf, sizeof(be16), &view)) {
+			size = sizeof(be16) + view_be16(&view, 0);
 
-	size = sizeof(u16) + len;
+			if (buffer_view(buf, size, &view)) {
+				buffer_advance(buf, size);
 
-	memcpy(packet, start - sizeof(u16), size);
+				return (void *) view_ptr(&view, 0);
+			}
+		}
 
-	buffer_advance(buf, len);
+		if (buffer_size(buf) > 0)
+			buffer_compact(buf);
+		else
+			buffer_reset(buf);
 
-	return 0;
+		nr = buffer_xread(buf, session->sockfd);
+		if (nr <= 0)
+			return NULL;
+	}
 }
 
 int soupbin3_session_recv(struct soupbin3_session *session, struct soupbin3_packet *packet)
 {
-	u16 len;
-	ssize_t nr;
+	struct soupbin3_packet *frame;
 
-	if (buffer_size(session->rx_buffer) > 0)
-		goto decode;
-
-	buffer_reset(session->rx_buffer);
-
-	nr = buffer_xread(session->rx_buffer, session->sockfd);
-	if (nr <= 0)
+	frame = soupbin3_session_recv_view(session);
+	if (!frame)
 		return -1;
 
-decode:
-	len = buffer_get_be16(session->rx_buffer);
+	memcpy(packet, frame, sizeof(be16) + be16_to_cpu(frame->PacketLength));
 
-	if (buffer_remaining(session->rx_buffer) < len)
-		assert(0);
-
-	return soupbin3_packet_decode(session->rx_buffer, len, packet);
+	return 0;
 }
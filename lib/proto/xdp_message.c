@@ -5,22 +5,43 @@
 #include <stdlib.h>
 #include <string.h>
 
+struct xdp_message *xdp_message_view(struct buffer *buf)
+{
+	struct buffer_view view;
+	u16 msg_size;
+
+	if (!buffer_view(buf, sizeof(struct xdp_message), &view))
+		return NULL;
+
+	msg_size = view_le16(&view, 0);
+
+	if (msg_size < sizeof(struct xdp_message))
+		return NULL;
+
+	if (!buffer_view(buf, msg_size, &view))
+		return NULL;
+
+	buffer_advance(buf, msg_size);
+
+	return (void *) view_ptr(&view, 0);
+}
+
 int xdp_message_decode(struct buffer *buf, struct xdp_message *msg, size_t size)
 {
-	size_t available;
+	struct buffer_view view;
 	u16 msg_size;
 
-	available = buffer_size(buf);
-	if (!available)
+	if (!buffer_view(buf, sizeof(struct xdp_message), &view))
 		return -1;
 
-	msg_size = buffer_peek_le16(buf);
+	msg_size = view_le16(&view, 0);
 	if (msg_size > size)
 		return -1;
 
-	memcpy(msg, buffer_start(buf), msg_size);
+	if (!xdp_message_view(buf))
+		return -1;
 
-	buffer_advance(buf, msg_size);
+	memcpy(msg, view_ptr(&view, 0), msg_size);
 
 	return 0;
 }
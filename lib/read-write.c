@@ -4,8 +4,13 @@
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <unistd.h>
+#include <string.h>
 #include <errno.h>
 
+#ifdef __linux__
+#include <linux/net_tstamp.h>
+#endif
+
 ssize_t sys_sendmsg(int fd, struct iovec *iov, size_t length, int flags)
 {
 	struct msghdr msg = (struct msghdr) {
@@ -29,6 +34,58 @@ size_t iov_byte_length(struct iovec *iov, size_t iov_len)
 	return len;
 }
 
+/*
+ * Ask the kernel to attach a receive timestamp to every read from the
+ * socket. Hardware timestamps are requested too and used when the NIC
+ * provides them; SO_TIMESTAMPNS is the fallback for older kernels.
+ */
+int rx_timestamps_enable(int fd)
+{
+	int on = 1;
+#ifdef SO_TIMESTAMPING
+	int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+		    SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+
+	if (!setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)))
+		return 0;
+#endif
+	return setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+}
+
+/* Extract the receive timestamp from the control messages of recvmsg(2). */
+bool rx_timestamp_get(struct msghdr *msg, struct timespec *ts)
+{
+	struct cmsghdr *cmsg;
+
+	for (cmsg = CMSG_FIRSTHDR(msg); cmsg; cmsg = CMSG_NXTHDR(msg, cmsg)) {
+		if (cmsg->cmsg_level != SOL_SOCKET)
+			continue;
+
+		switch (cmsg->cmsg_type) {
+#ifdef SO_TIMESTAMPING
+		case SCM_TIMESTAMPING: {
+			struct timespec stamps[3];
+
+			/* [0] is the software timestamp, [2] the raw hardware one */
+			memcpy(stamps, CMSG_DATA(cmsg), sizeof(stamps));
+
+			*ts = stamps[2].tv_sec || stamps[2].tv_nsec ? stamps[2] : stamps[0];
+
+			return true;
+		}
+#endif
+		case SCM_TIMESTAMPNS:
+			memcpy(ts, CMSG_DATA(cmsg), sizeof(*ts));
+
+			return true;
+		default:
+			break;
+		}
+	}
+
+	return false;
+}
+
 /* Same as read(2) except that this function never returns EAGAIN or EINTR. */
 ssize_t xread(int fd, void *buf, size_t count)
 {
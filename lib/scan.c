@@ -0,0 +1,114 @@
+#include "libtrading/scan.h"
+
+#include "libtrading/cpu.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCAN_HAVE_AVX2
+#endif
+
+static u64 scan_tail(const char *p, size_t len, char c)
+{
+	u64 bits = 0;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if (p[i] == c)
+			bits |= 1ULL << i;
+	}
+
+	return bits;
+}
+
+/* Portable fallback: eight bytes at a time on little-endian hosts. */
+static void scan_bitmap_generic(const char *p, size_t len, char c, u64 *bitmap)
+{
+	size_t i;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	const u64 pattern = SWAR_ONES * (u8) c;
+
+	for (i = 0; len - i >= 64; i += 64) {
+		u64 bits = 0;
+		int j;
+
+		for (j = 0; j < 8; j++) {
+			u64 x;
+
+			memcpy(&x, p + i + j * 8, sizeof(x));
+
+			/* Gather the top bit of each byte into the low eight bits. */
+			x = swar_zero_bytes(x ^ pattern) >> 7;
+
+			bits |= ((x * 0x0102040810204080ULL) >> 56) << (j * 8);
+		}
+
+		*bitmap++ = bits;
+	}
+#else
+	for (i = 0; len - i >= 64; i += 64)
+		*bitmap++ = scan_tail(p + i, 64, c);
+#endif
+	if (i < len)
+		*bitmap = scan_tail(p + i, len - i, c);
+}
+
+#ifdef __SSE2__
+static void scan_bitmap_sse2(const char *p, size_t len, char c, u64 *bitmap)
+{
+	const __m128i needle = _mm_set1_epi8(c);
+	size_t i;
+
+	for (i = 0; len - i >= 64; i += 64) {
+		u64 m0, m1, m2, m3;
+
+		m0 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (p + i +  0)), needle));
+		m1 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (p + i + 16)), needle));
+		m2 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (p + i + 32)), needle));
+		m3 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (p + i + 48)), needle));
+
+		*bitmap++ = m0 | (m1 << 16) | (m2 << 32) | (m3 << 48);
+	}
+
+	if (i < len)
+		*bitmap = scan_tail(p + i, len - i, c);
+}
+#endif
+
+#ifdef SCAN_HAVE_AVX2
+__attribute__((target("avx2")))
+static void scan_bitmap_avx2(const char *p, size_t len, char c, u64 *bitmap)
+{
+	const __m256i needle = _mm256_set1_epi8(c);
+	size_t i;
+
+	for (i = 0; len - i >= 64; i += 64) {
+		u64 lo, hi;
+
+		lo = (u32) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (p + i)), needle));
+		hi = (u32) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (p + i + 32)), needle));
+
+		*bitmap++ = lo | (hi << 32);
+	}
+
+	if (i < len)
+		*bitmap = scan_tail(p + i, len - i, c);
+}
+#endif
+
+void scan_bitmap(const char *p, size_t len, char c, u64 *bitmap)
+{
+#ifdef SCAN_HAVE_AVX2
+	if (cpu_has(CPU_FEATURE_AVX2)) {
+		scan_bitmap_avx2(p, len, c, bitmap);
+		return;
+	}
+#endif
+#ifdef __SSE2__
+	if (cpu_has(CPU_FEATURE_SSE2)) {
+		scan_bitmap_sse2(p, len, c, bitmap);
+		return;
+	}
+#endif
+	scan_bitmap_generic(p, len, c, bitmap);
+}
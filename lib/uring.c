@@ -0,0 +1,935 @@
+#include "libtrading/uring.h"
+
+#include "libtrading/read-write.h"
+#include "libtrading/types.h"
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+void uring_cfg_init(struct uring_cfg *cfg)
+{
+	*cfg = (struct uring_cfg) {
+		.entries	= 256,
+		.nr_rx_bufs	= 256,
+		.rx_buf_size	= 4096,
+		.nr_tx_bufs	= 64,
+		.tx_buf_size	= 4096,
+		.defer_send	= false,
+	};
+}
+
+#ifdef __linux__
+
+#define URING_BGID	0
+#define URING_NONE	(~0U)
+
+enum uring_op {
+	URING_OP_RECV		= 1,
+	URING_OP_SEND		= 2,
+	URING_OP_CANCEL		= 3,
+};
+
+/* user_data layout: op (8 bits) | send buffer (24 bits) | fd (32 bits) */
+#define URING_DATA(op, slot, fd)	(((u64)(op) << 56) | ((u64)((slot) & 0xffffff) << 32) | (u32)(fd))
+#define URING_DATA_OP(data)		((data) >> 56)
+#define URING_DATA_SLOT(data)		(((data) >> 32) & 0xffffff)
+#define URING_DATA_FD(data)		((int)(u32)(data))
+
+enum uring_tx_state {
+	URING_TX_NONE,
+	URING_TX_QUEUED,	/* copied into a send buffer, not yet submitted */
+	URING_TX_INFLIGHT,
+};
+
+struct uring_fd {
+	dev_t			dev;		/* the socket the state belongs to */
+	ino_t			ino;
+
+	bool			armed;		/* multishot receive in flight */
+	bool			eof;
+	int			error;
+
+	unsigned int		rx_head;	/* received buffers, in order */
+	unsigned int		rx_tail;
+
+	enum uring_tx_state	tx_state;
+	unsigned int		tx_slot;
+};
+
+struct uring_rx_buf {
+	unsigned int		off;
+	unsigned int		len;
+	unsigned int		next;
+};
+
+struct uring {
+	int			fd;
+	struct uring_cfg	cfg;
+
+	void			*sq_ring;
+	size_t			sq_ring_size;
+	unsigned int		*sq_head;
+	unsigned int		*sq_tail;
+	unsigned int		*sq_mask;
+	unsigned int		*sq_array;
+	unsigned int		sq_entries;
+	unsigned int		sq_local_tail;
+	unsigned int		sq_pending;
+	struct io_uring_sqe	*sqes;
+	size_t			sqes_size;
+
+	void			*cq_ring;
+	size_t			cq_ring_size;
+	unsigned int		*cq_head;
+	unsigned int		*cq_tail;
+	unsigned int		*cq_mask;
+	struct io_uring_cqe	*cqes;
+
+	/* Provided buffer ring used by multishot receive: */
+	struct io_uring_buf_ring *br;
+	size_t			br_size;
+	unsigned short		br_tail;
+	char			*rx_data;
+	struct uring_rx_buf	*rx_bufs;
+
+	/* Registered buffers used for sends: */
+	char			*tx_data;
+	unsigned int		*tx_len;
+	unsigned int		*tx_free;
+	unsigned int		nr_tx_free;
+	int			*tx_queue;	/* fds with a queued send */
+	unsigned int		nr_tx_queue;
+
+	struct uring_fd		*fds;
+	unsigned int		nr_fds;
+
+	struct uring_stats	stats;
+};
+
+/* The one ring of the process, used without locking: see uring.h */
+static struct uring *uring;
+
+static int sys_io_uring_setup(unsigned int entries, struct io_uring_params *p)
+{
+	return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned int to_submit, unsigned int min_complete, unsigned int flags)
+{
+	return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static int sys_io_uring_register(int fd, unsigned int opcode, void *arg, unsigned int nr_args)
+{
+	return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static void uring_fd_release(int fd, struct uring_fd *state);
+static void uring_tx_discard(int fd, struct uring_fd *state);
+
+/*
+ * Sockets closed without uring_close() leave their state behind for the
+ * next socket that gets the same fd number: drop it when the file changes.
+ */
+static struct uring_fd *uring_fd_get(int fd)
+{
+	struct uring_fd *fds, *state;
+	unsigned int nr, i;
+	struct stat st;
+
+	if (fstat(fd, &st) < 0)
+		return NULL;
+
+	if (fd >= uring->nr_fds) {
+		nr = (fd + 64) & ~63U;
+
+		fds = realloc(uring->fds, nr * sizeof(*fds));
+		if (!fds)
+			return NULL;
+
+		for (i = uring->nr_fds; i < nr; i++) {
+			fds[i] = (struct uring_fd) {
+				.rx_head	= URING_NONE,
+				.rx_tail	= URING_NONE,
+				.tx_state	= URING_TX_NONE,
+				.tx_slot	= URING_NONE,
+			};
+		}
+
+		uring->fds	= fds;
+		uring->nr_fds	= nr;
+	}
+
+	state = &uring->fds[fd];
+
+	if (state->ino != st.st_ino || state->dev != st.st_dev) {
+		uring_tx_discard(fd, state);
+		uring_fd_release(fd, state);
+
+		state->dev	= st.st_dev;
+		state->ino	= st.st_ino;
+	}
+
+	return state;
+}
+
+static void uring_rx_buf_recycle(unsigned int bid)
+{
+	struct io_uring_buf *buf;
+	unsigned int mask;
+
+	mask = uring->cfg.nr_rx_bufs - 1;
+
+	buf = &uring->br->bufs[uring->br_tail & mask];
+
+	buf->addr	= (unsigned long) (uring->rx_data + (size_t) bid * uring->cfg.rx_buf_size);
+	buf->len	= uring->cfg.rx_buf_size;
+	buf->bid	= bid;
+
+	uring->br_tail++;
+
+	__atomic_store_n(&uring->br->tail, uring->br_tail, __ATOMIC_RELEASE);
+}
+
+static struct io_uring_sqe *uring_get_sqe(void)
+{
+	struct io_uring_sqe *sqe;
+	unsigned int head, idx;
+
+	head = __atomic_load_n(uring->sq_head, __ATOMIC_ACQUIRE);
+
+	if (uring->sq_local_tail - head >= uring->sq_entries) {
+		int ret;
+
+		ret = sys_io_uring_enter(uring->fd, uring->sq_pending, 0, 0);
+		if (ret < 0)
+			return NULL;
+
+		uring->stats.nr_enters++;
+		uring->sq_pending -= ret;
+	}
+
+	idx = uring->sq_local_tail & *uring->sq_mask;
+
+	sqe = &uring->sqes[idx];
+	memset(sqe, 0, sizeof(*sqe));
+
+	uring->sq_array[idx] = idx;
+	uring->sq_local_tail++;
+	uring->sq_pending++;
+
+	__atomic_store_n(uring->sq_tail, uring->sq_local_tail, __ATOMIC_RELEASE);
+
+	return sqe;
+}
+
+static int uring_arm_recv(int fd, struct uring_fd *state)
+{
+	struct io_uring_sqe *sqe;
+
+	sqe = uring_get_sqe();
+	if (!sqe)
+		return -1;
+
+	sqe->opcode	= IORING_OP_RECV;
+	sqe->fd		= fd;
+	sqe->ioprio	= IORING_RECV_MULTISHOT;
+	sqe->flags	= IOSQE_BUFFER_SELECT;
+	sqe->buf_group	= URING_BGID;
+	sqe->user_data	= URING_DATA(URING_OP_RECV, 0, fd);
+
+	state->armed = true;
+
+	return 0;
+}
+
+/*
+ * Turn queued sends into SQEs right before submission so that several
+ * messages sent to the same socket in the meantime go out as one write.
+ * If the ring runs out of SQEs partway, the sends prepared so far are left
+ * for submission and the rest stay queued for the next attempt.
+ */
+static int uring_prep_sends(void)
+{
+	struct io_uring_sqe *sqe;
+	struct uring_fd *state;
+	unsigned int i, slot;
+	int fd;
+
+	for (i = 0; i < uring->nr_tx_queue; i++) {
+		fd	= uring->tx_queue[i];
+		state	= &uring->fds[fd];
+		slot	= state->tx_slot;
+
+		sqe = uring_get_sqe();
+		if (!sqe) {
+			uring->nr_tx_queue -= i;
+			memmove(uring->tx_queue, uring->tx_queue + i, uring->nr_tx_queue * sizeof(*uring->tx_queue));
+			return -1;
+		}
+
+		sqe->opcode	= IORING_OP_WRITE_FIXED;
+		sqe->fd		= fd;
+		sqe->addr	= (unsigned long) (uring->tx_data + (size_t) slot * uring->cfg.tx_buf_size);
+		sqe->len	= uring->tx_len[slot];
+		sqe->off	= 0;
+		sqe->buf_index	= 0;
+		sqe->user_data	= URING_DATA(URING_OP_SEND, slot, fd);
+
+		state->tx_state = URING_TX_INFLIGHT;
+	}
+
+	uring->nr_tx_queue = 0;
+
+	return 0;
+}
+
+static void uring_complete_recv(int fd, struct io_uring_cqe *cqe)
+{
+	struct uring_fd *state = &uring->fds[fd];
+	unsigned int bid;
+
+	if (!(cqe->flags & IORING_CQE_F_MORE))
+		state->armed = false;
+
+	if (cqe->res > 0) {
+		bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+
+		uring->rx_bufs[bid] = (struct uring_rx_buf) {
+			.off	= 0,
+			.len	= cqe->res,
+			.next	= URING_NONE,
+		};
+
+		if (state->rx_tail != URING_NONE)
+			uring->rx_bufs[state->rx_tail].next = bid;
+		else
+			state->rx_head = bid;
+
+		state->rx_tail = bid;
+
+		uring->stats.nr_recv_cqes++;
+
+		return;
+	}
+
+	switch (cqe->res) {
+	case 0:
+		state->eof = true;
+		break;
+	case -ENOBUFS:		/* re-armed by the next uring_recv() */
+	case -ECANCELED:
+		break;
+	default:
+		state->error = -cqe->res;
+		break;
+	}
+}
+
+static void uring_complete_send(int fd, unsigned int slot, struct io_uring_cqe *cqe)
+{
+	struct uring_fd *state = &uring->fds[fd];
+
+	if (cqe->res < 0)
+		state->error = -cqe->res;
+	else if (cqe->res < uring->tx_len[slot])
+		state->error = EIO;
+
+	uring->tx_free[uring->nr_tx_free++] = slot;
+
+	state->tx_state	= URING_TX_NONE;
+	state->tx_slot	= URING_NONE;
+
+	uring->stats.nr_send_cqes++;
+}
+
+static unsigned int uring_reap(void)
+{
+	struct io_uring_cqe *cqe;
+	unsigned int head, tail;
+	unsigned int nr = 0;
+	u64 data;
+
+	head = *uring->cq_head;
+	tail = __atomic_load_n(uring->cq_tail, __ATOMIC_ACQUIRE);
+
+	for (; head != tail; head++, nr++) {
+		cqe = &uring->cqes[head & *uring->cq_mask];
+		data = cqe->user_data;
+
+		switch (URING_DATA_OP(data)) {
+		case URING_OP_RECV:
+			uring_complete_recv(URING_DATA_FD(data), cqe);
+			break;
+		case URING_OP_SEND:
+			uring_complete_send(URING_DATA_FD(data), URING_DATA_SLOT(data), cqe);
+			break;
+		default:
+			break;
+		}
+	}
+
+	__atomic_store_n(uring->cq_head, head, __ATOMIC_RELEASE);
+
+	return nr;
+}
+
+/*
+ * Submit everything queued so far and optionally wait for at least one
+ * completion. Completions are reaped for all sockets at once.
+ */
+static int uring_enter(unsigned int min_complete)
+{
+	unsigned int flags = 0;
+	int err;
+	int ret;
+
+	/* Whatever did get prepared is submitted below all the same. */
+	err = uring_prep_sends();
+
+	if (min_complete)
+		flags |= IORING_ENTER_GETEVENTS;
+
+	uring->stats.nr_enters++;
+
+	ret = sys_io_uring_enter(uring->fd, uring->sq_pending, min_complete, flags);
+	if (ret < 0) {
+		if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			return -1;
+
+		ret = 0;
+	}
+
+	uring->sq_pending -= ret;
+
+	uring_reap();
+
+	return err;
+}
+
+/* Wait until nothing is queued or in flight for the socket. */
+static int uring_tx_drain(struct uring_fd *state)
+{
+	while (state->tx_state != URING_TX_NONE) {
+		if (uring_enter(1))
+			return -1;
+	}
+
+	return 0;
+}
+
+/* Drop a send that hasn't been submitted: the fd now names another socket. */
+static void uring_tx_discard(int fd, struct uring_fd *state)
+{
+	unsigned int i;
+
+	if (state->tx_state != URING_TX_QUEUED)
+		return;
+
+	for (i = 0; i < uring->nr_tx_queue; i++) {
+		if (uring->tx_queue[i] == fd) {
+			uring->nr_tx_queue--;
+			memmove(uring->tx_queue + i, uring->tx_queue + i + 1, (uring->nr_tx_queue - i) * sizeof(*uring->tx_queue));
+			break;
+		}
+	}
+
+	uring->tx_free[uring->nr_tx_free++] = state->tx_slot;
+
+	state->tx_state	= URING_TX_NONE;
+	state->tx_slot	= URING_NONE;
+}
+
+static unsigned int uring_tx_slot_get(void)
+{
+	while (!uring->nr_tx_free) {
+		if (uring_enter(1))
+			return URING_NONE;
+	}
+
+	return uring->tx_free[--uring->nr_tx_free];
+}
+
+ssize_t uring_recv(int fd, void *buffer, size_t length, int flags)
+{
+	struct uring_rx_buf *buf;
+	struct uring_fd *state;
+	unsigned int bid;
+	size_t count;
+
+	state = uring_fd_get(fd);
+	if (!state)
+		return -1;
+
+	for (;;) {
+		if (state->rx_head != URING_NONE) {
+			bid	= state->rx_head;
+			buf	= &uring->rx_bufs[bid];
+			count	= length < buf->len ? length : buf->len;
+
+			memcpy(buffer, uring->rx_data + (size_t) bid * uring->cfg.rx_buf_size + buf->off, count);
+
+			buf->off += count;
+			buf->len -= count;
+
+			if (!buf->len) {
+				state->rx_head = buf->next;
+				if (state->rx_head == URING_NONE)
+					state->rx_tail = URING_NONE;
+
+				uring_rx_buf_recycle(bid);
+			}
+
+			return count;
+		}
+
+		if (state->error) {
+			errno = state->error;
+			state->error = 0;
+			return -1;
+		}
+
+		if (state->eof)
+			return 0;
+
+		if (!state->armed && uring_arm_recv(fd, state))
+			return -1;
+
+		if (uring_reap())
+			continue;
+
+		if (flags & MSG_DONTWAIT) {
+			if (uring->sq_pending || uring->nr_tx_queue) {
+				if (uring_enter(0))
+					return -1;
+
+				if (state->rx_head != URING_NONE || state->error || state->eof)
+					continue;
+			}
+
+			errno = EAGAIN;
+			return -1;
+		}
+
+		if (uring_enter(1))
+			return -1;
+	}
+}
+
+ssize_t uring_sendmsg(int fd, struct iovec *iov, size_t length, int flags)
+{
+	struct uring_fd *state;
+	size_t len, i;
+	char *dst;
+
+	state = uring_fd_get(fd);
+	if (!state)
+		return -1;
+
+	if (state->error) {
+		errno = state->error;
+		state->error = 0;
+		return -1;
+	}
+
+	len = iov_byte_length(iov, length);
+
+	/* Messages that do not fit a send buffer go out synchronously. */
+	if (len > uring->cfg.tx_buf_size) {
+		if (uring_tx_drain(state))
+			return -1;
+
+		return sys_sendmsg(fd, iov, length, flags);
+	}
+
+	/* At most one send per socket is in flight to keep them ordered. */
+	if (state->tx_state == URING_TX_QUEUED &&
+	    uring->tx_len[state->tx_slot] + len > uring->cfg.tx_buf_size) {
+		if (uring_enter(0))
+			return -1;
+	}
+
+	if (state->tx_state == URING_TX_INFLIGHT && uring_tx_drain(state))
+		return -1;
+
+	if (state->tx_state == URING_TX_NONE) {
+		state->tx_slot = uring_tx_slot_get();
+		if (state->tx_slot == URING_NONE)
+			return -1;
+
+		uring->tx_len[state->tx_slot] = 0;
+		uring->tx_queue[uring->nr_tx_queue++] = fd;
+
+		state->tx_state = URING_TX_QUEUED;
+	}
+
+	dst = uring->tx_data + (size_t) state->tx_slot * uring->cfg.tx_buf_size + uring->tx_len[state->tx_slot];
+
+	for (i = 0; i < length; i++) {
+		memcpy(dst, iov[i].iov_base, iov[i].iov_len);
+		dst += iov[i].iov_len;
+	}
+
+	uring->tx_len[state->tx_slot] += len;
+
+	if (!uring->cfg.defer_send && uring_enter(0))
+		return -1;
+
+	return len;
+}
+
+int uring_flush(void)
+{
+	if (!uring)
+		return 0;
+
+	return uring_enter(0);
+}
+
+/* Cancel the socket's receive, wait for its send and forget about it. */
+static void uring_fd_release(int fd, struct uring_fd *state)
+{
+	struct io_uring_sqe *sqe;
+	unsigned int bid;
+
+	uring_tx_drain(state);
+
+	if (state->armed) {
+		sqe = uring_get_sqe();
+		if (sqe) {
+			sqe->opcode	= IORING_OP_ASYNC_CANCEL;
+			sqe->addr	= URING_DATA(URING_OP_RECV, 0, fd);
+			sqe->user_data	= URING_DATA(URING_OP_CANCEL, 0, fd);
+		}
+
+		while (state->armed) {
+			if (uring_enter(1))
+				break;
+		}
+	}
+
+	while (state->rx_head != URING_NONE) {
+		bid = state->rx_head;
+		state->rx_head = uring->rx_bufs[bid].next;
+		uring_rx_buf_recycle(bid);
+	}
+
+	*state = (struct uring_fd) {
+		.rx_head	= URING_NONE,
+		.rx_tail	= URING_NONE,
+		.tx_state	= URING_TX_NONE,
+		.tx_slot	= URING_NONE,
+	};
+}
+
+void uring_close(int fd)
+{
+	if (!uring || fd < 0 || fd >= uring->nr_fds)
+		return;
+
+	uring_fd_release(fd, &uring->fds[fd]);
+}
+
+static void uring_free(struct uring *self)
+{
+	if (self->sqes && self->sqes != MAP_FAILED)
+		munmap(self->sqes, self->sqes_size);
+	if (self->cq_ring && self->cq_ring != MAP_FAILED && self->cq_ring != self->sq_ring)
+		munmap(self->cq_ring, self->cq_ring_size);
+	if (self->sq_ring && self->sq_ring != MAP_FAILED)
+		munmap(self->sq_ring, self->sq_ring_size);
+	if (self->br && self->br != MAP_FAILED)
+		munmap(self->br, self->br_size);
+	if (self->fd >= 0)
+		close(self->fd);
+
+	free(self->rx_data);
+	free(self->rx_bufs);
+	free(self->tx_data);
+	free(self->tx_len);
+	free(self->tx_free);
+	free(self->tx_queue);
+	free(self->fds);
+	free(self);
+}
+
+static int uring_setup_rings(struct uring *self)
+{
+	struct io_uring_params p;
+	char *sq, *cq;
+
+	memset(&p, 0, sizeof(p));
+
+	self->fd = sys_io_uring_setup(self->cfg.entries, &p);
+	if (self->fd < 0)
+		return -1;
+
+	self->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	self->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (self->cq_ring_size > self->sq_ring_size)
+			self->sq_ring_size = self->cq_ring_size;
+		self->cq_ring_size = self->sq_ring_size;
+	}
+
+	self->sq_ring = mmap(NULL, self->sq_ring_size, PROT_READ | PROT_WRITE,
+			     MAP_SHARED | MAP_POPULATE, self->fd, IORING_OFF_SQ_RING);
+	if (self->sq_ring == MAP_FAILED)
+		return -1;
+
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		self->cq_ring = self->sq_ring;
+	} else {
+		self->cq_ring = mmap(NULL, self->cq_ring_size, PROT_READ | PROT_WRITE,
+				     MAP_SHARED | MAP_POPULATE, self->fd, IORING_OFF_CQ_RING);
+		if (self->cq_ring == MAP_FAILED)
+			return -1;
+	}
+
+	self->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+
+	self->sqes = mmap(NULL, self->sqes_size, PROT_READ | PROT_WRITE,
+			  MAP_SHARED | MAP_POPULATE, self->fd, IORING_OFF_SQES);
+	if (self->sqes == MAP_FAILED)
+		return -1;
+
+	sq = self->sq_ring;
+	cq = self->cq_ring;
+
+	self->sq_head		= (void *) (sq + p.sq_off.head);
+	self->sq_tail		= (void *) (sq + p.sq_off.tail);
+	self->sq_mask		= (void *) (sq + p.sq_off.ring_mask);
+	self->sq_array		= (void *) (sq + p.sq_off.array);
+	self->sq_entries	= p.sq_entries;
+	self->sq_local_tail	= *self->sq_tail;
+
+	self->cq_head		= (void *) (cq + p.cq_off.head);
+	self->cq_tail		= (void *) (cq + p.cq_off.tail);
+	self->cq_mask		= (void *) (cq + p.cq_off.ring_mask);
+	self->cqes		= (void *) (cq + p.cq_off.cqes);
+
+	return 0;
+}
+
+static int uring_setup_buffers(struct uring *self)
+{
+	struct io_uring_buf_reg reg;
+	struct iovec iov;
+	unsigned int i;
+
+	self->br_size = self->cfg.nr_rx_bufs * sizeof(struct io_uring_buf);
+
+	self->br = mmap(NULL, self->br_size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (self->br == MAP_FAILED)
+		return -1;
+
+	reg = (struct io_uring_buf_reg) {
+		.ring_addr	= (unsigned long) self->br,
+		.ring_entries	= self->cfg.nr_rx_bufs,
+		.bgid		= URING_BGID,
+	};
+
+	if (sys_io_uring_register(self->fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+		return -1;
+
+	self->rx_data = malloc((size_t) self->cfg.nr_rx_bufs * self->cfg.rx_buf_size);
+	if (!self->rx_data)
+		return -1;
+
+	self->rx_bufs = calloc(self->cfg.nr_rx_bufs, sizeof(struct uring_rx_buf));
+	if (!self->rx_bufs)
+		return -1;
+
+	self->tx_data = malloc((size_t) self->cfg.nr_tx_bufs * self->cfg.tx_buf_size);
+	if (!self->tx_data)
+		return -1;
+
+	self->tx_len	= calloc(self->cfg.nr_tx_bufs, sizeof(unsigned int));
+	self->tx_free	= calloc(self->cfg.nr_tx_bufs, sizeof(unsigned int));
+	self->tx_queue	= calloc(self->cfg.nr_tx_bufs, sizeof(int));
+	if (!self->tx_len || !self->tx_free || !self->tx_queue)
+		return -1;
+
+	iov = (struct iovec) {
+		.iov_base	= self->tx_data,
+		.iov_len	= (size_t) self->cfg.nr_tx_bufs * self->cfg.tx_buf_size,
+	};
+
+	if (sys_io_uring_register(self->fd, IORING_REGISTER_BUFFERS, &iov, 1) < 0)
+		return -1;
+
+	for (i = 0; i < self->cfg.nr_tx_bufs; i++)
+		self->tx_free[self->nr_tx_free++] = i;
+
+	return 0;
+}
+
+/*
+ * Multishot receive needs Linux 6.0. Older kernels accept the ring setup
+ * above but fail the receive itself, so try it out on a socket pair.
+ */
+static int uring_probe(void)
+{
+	char c = 0;
+	int sv[2];
+	int ret;
+
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+		return -1;
+
+	ret = -1;
+
+	if (write(sv[1], &c, 1) != 1)
+		goto out;
+
+	if (uring_recv(sv[0], &c, 1, 0) != 1)
+		goto out;
+
+	if (!uring->fds[sv[0]].armed)
+		goto out;
+
+	ret = 0;
+out:
+	uring_close(sv[0]);
+
+	close(sv[0]);
+	close(sv[1]);
+
+	return ret;
+}
+
+int uring_init(struct uring_cfg *cfg)
+{
+	struct uring *self;
+	unsigned int i;
+
+	if (uring) {
+		errno = EBUSY;
+		return -1;
+	}
+
+	if (!cfg->nr_rx_bufs || (cfg->nr_rx_bufs & (cfg->nr_rx_bufs - 1)) || cfg->nr_rx_bufs > 32768 ||
+	    !cfg->rx_buf_size || !cfg->nr_tx_bufs || !cfg->tx_buf_size) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	self = calloc(1, sizeof(*self));
+	if (!self)
+		return -1;
+
+	self->fd	= -1;
+	self->cfg	= *cfg;
+
+	if (uring_setup_rings(self))
+		goto fail;
+
+	if (uring_setup_buffers(self))
+		goto fail;
+
+	uring = self;
+
+	for (i = 0; i < cfg->nr_rx_bufs; i++)
+		uring_rx_buf_recycle(i);
+
+	if (uring_probe()) {
+		uring = NULL;
+		goto fail;
+	}
+
+	io_recv		= uring_recv;
+	io_sendmsg	= uring_sendmsg;
+
+	return 0;
+
+fail:
+	uring_free(self);
+
+	return -1;
+}
+
+void uring_exit(void)
+{
+	int fd;
+
+	if (!uring)
+		return;
+
+	for (fd = 0; fd < uring->nr_fds; fd++)
+		uring_close(fd);
+
+	io_recv		= &recv;
+	io_sendmsg	= &sys_sendmsg;
+
+	uring_free(uring);
+
+	uring = NULL;
+}
+
+bool uring_enabled(void)
+{
+	return uring != NULL;
+}
+
+void uring_get_stats(struct uring_stats *stats)
+{
+	if (uring)
+		*stats = uring->stats;
+	else
+		memset(stats, 0, sizeof(*stats));
+}
+
+#else
+
+int uring_init(struct uring_cfg *cfg)
+{
+	errno = ENOSYS;
+	return -1;
+}
+
+void uring_exit(void)
+{
+}
+
+bool uring_enabled(void)
+{
+	return false;
+}
+
+int uring_flush(void)
+{
+	return 0;
+}
+
+void uring_close(int fd)
+{
+}
+
+void uring_get_stats(struct uring_stats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+}
+
+ssize_t uring_recv(int fd, void *buffer, size_t length, int flags)
+{
+	return recv(fd, buffer, length, flags);
+}
+
+ssize_t uring_sendmsg(int fd, struct iovec *iov, size_t length, int flags)
+{
+	return sys_sendmsg(fd, iov, length, flags);
+}
+
+#endif
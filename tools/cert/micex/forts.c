@@ -1,5 +1,6 @@
 #include "fix/fix_common.h"
 #include "libtrading/proto/fast_book.h"
+#include "libtrading/proto/micex_fix.h"
 
 #include "libtrading/compat.h"
 #include "libtrading/array.h"
@@ -39,21 +40,6 @@ static void usage(void)
 	exit(EXIT_FAILURE);
 }
 
-static inline struct fix_field *fix_field_by_tag(struct fix_message *msg, enum fix_tag tag)
-{
-	struct fix_field *field = NULL;
-	int i;
-
-	for (i = 0; i < msg->nr_fields; i++) {
-		field = msg->fields + i;
-
-		if (field->tag == tag)
-			return field;
-	}
-
-        return NULL;
-}
-
 static int parse_feeds(xmlNodePtr node, struct fast_book_set *set, const char *template)
 {
 	struct fast_feed *feed;
@@ -112,6 +98,8 @@ static int parse_feeds(xmlNodePtr node, struct fast_book_set *set, const char *t
 				feed->cfg.reset = true;
 			} else if (!xmlStrcmp(ptr->name, (const xmlChar *)"preamble")) {
 				feed->cfg.preamble_bytes = atoi((const char *)prop);
+			} else if (!xmlStrcmp(ptr->name, (const xmlChar *)"batch")) {
+				feed->cfg.batch_size = atoi((const char *)prop);
 			}
 
 			ptr = ptr->next;
@@ -301,33 +289,27 @@ fail:
 	return -1;
 }
 
+#define EXEC_REPORT_FIELDS	(MICEX_EXECUTION_REPORT_ORD_STATUS | MICEX_EXECUTION_REPORT_EXEC_TYPE | \
+				 MICEX_EXECUTION_REPORT_ORDER_QTY | MICEX_EXECUTION_REPORT_CUM_QTY)
+
 static int do_exec(struct fix_message *msg)
 {
-	struct fix_field *field;
+	struct micex_execution_report report;
 	char exec_type = 0;
 	double order_qty;
 	char status = 0;
 	double cum_qty;
 
-	field = fix_field_by_tag(msg, OrdStatus);
-	if (!field)
+	if (micex_execution_report_parse(&report, msg))
 		goto fail;
-	status = field->string_value[0];
 
-	field = fix_field_by_tag(msg, ExecType);
-	if (!field)
+	if ((report.present & EXEC_REPORT_FIELDS) != EXEC_REPORT_FIELDS)
 		goto fail;
-	exec_type = field->string_value[0];
 
-	field = fix_field_by_tag(msg, OrderQty);
-	if (!field)
-		goto fail;
-	order_qty = field->float_value;
-
-	field = fix_field_by_tag(msg, CumQty);
-	if (!field)
-		goto fail;
-	cum_qty = field->float_value;
+	status		= report.ord_status[0];
+	exec_type	= report.exec_type[0];
+	order_qty	= report.order_qty;
+	cum_qty		= report.cum_qty;
 
 	switch (status) {
 	case '0':
@@ -397,7 +379,7 @@ static int do_replace(struct fix_session *session, struct fast_book_set *set, st
 	fields[nr++] = FIX_STRING_FIELD(TransactTime, session->str_now);
 	fields[nr++] = FIX_STRING_FIELD(ClOrdID, session->str_now);
 
-	field = fix_field_by_tag(msg, ClOrdID);
+	field = fix_get_field(msg, ClOrdID);
 	if (!field)
 		goto fail;
 	fstrcpy(clordid, field->string_value);
@@ -409,7 +391,7 @@ static int do_replace(struct fix_session *session, struct fast_book_set *set, st
 	fields[nr++] = FIX_STRING_FIELD(OrdType, "2");
 	fields[nr++] = FIX_FLOAT_FIELD(OrderQty, 3);
 
-	field = fix_field_by_tag(msg, Side);
+	field = fix_get_field(msg, Side);
 	if (!field)
 		goto fail;
 	fstrcpy(side, field->string_value);
@@ -586,9 +568,11 @@ int main(int argc, char *argv[])
 	if (!mode || !sender_comp_id || !target_comp_id || !host || !port || !template || !config)
 		usage();
 
+	fix_session_cfg_init(&cfg);
+
 	strncpy(cfg.target_comp_id, target_comp_id, ARRAY_SIZE(cfg.target_comp_id));
 	strncpy(cfg.sender_comp_id, sender_comp_id, ARRAY_SIZE(cfg.sender_comp_id));
-	cfg.dialect = &fix_dialects[FIX_4_4];
+	cfg.dialect = &micex_fix_dialect;
 
 	he = gethostbyname(host);
 	if (!he)
@@ -352,6 +352,8 @@ int main(int argc, char *argv[])
 	if (!port || !host || !arg.xml)
 		usage();
 
+	fast_session_cfg_init(&cfg);
+
 	he = gethostbyname(host);
 	if (!he)
 		error("Unable to look up %s (%s)", host, hstrerror(h_errno));
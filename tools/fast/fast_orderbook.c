@@ -70,6 +70,25 @@ static void fast_books_print(struct fast_book_set *set)
 	return;
 }
 
+static void fast_feeds_print_stats(struct fast_book_set *set)
+{
+	struct fast_session *session;
+	struct fast_feed *feed;
+	int i;
+
+	for (i = 0; i < set->inc_feeds_num; i++) {
+		feed = set->inc_feeds + i;
+		session = feed->session;
+
+		if (!session)
+			continue;
+
+		fprintf(stdout, "%s:%d: %" PRIu64 " syscalls, %" PRIu64 " packets, %" PRIu64 " messages, %.3f syscalls/message\n",
+			feed->ip, feed->port, session->nr_recv_calls, session->nr_recv_packets,
+			session->nr_recv_messages, fast_session_syscalls_per_message(session));
+	}
+}
+
 static int parse_feeds(xmlNodePtr node, struct fast_book_set *set, const char *template)
 {
 	struct fast_feed *feed;
@@ -128,6 +147,8 @@ static int parse_feeds(xmlNodePtr node, struct fast_book_set *set, const char *t
 				feed->cfg.reset = true;
 			} else if (!xmlStrcmp(ptr->name, (const xmlChar *)"preamble")) {
 				feed->cfg.preamble_bytes = atoi((const char *)prop);
+			} else if (!xmlStrcmp(ptr->name, (const xmlChar *)"batch")) {
+				feed->cfg.batch_size = atoi((const char *)prop);
 			}
 
 			ptr = ptr->next;
@@ -336,13 +357,15 @@ int main(int argc, char *argv[])
 		fast_books_print(book_set);
 	}
 
+	endwin();
+
+	fast_feeds_print_stats(book_set);
+
 	if (fast_books_fini(book_set)) {
 		fprintf(stderr, "Books are not finalized\n");
 		goto fail;
 	}
 
-	endwin();
-
 	free(book_set);
 
 	return EXIT_SUCCESS;
@@ -354,6 +354,8 @@ int main(int argc, char *argv[])
 	} else
 		usage();
 
+	fast_session_cfg_init(&cfg);
+
 	cfg.preamble_bytes = preamble;
 	cfg.reset = reset;
 	cfg.sockfd = fd;
@@ -358,6 +358,8 @@ int main(int argc, char *argv[])
 	if (listen(sockfd, 10) < 0)
 		die("listen failed");
 
+	fast_session_cfg_init(&cfg);
+
 	cfg.sockfd = accept(sockfd, NULL, NULL);
 	if (cfg.sockfd < 0)
 		die("accept failed");
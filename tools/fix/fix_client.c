@@ -1,6 +1,7 @@
 #include "fix/fix_common.h"
 
 #include "libtrading/compat.h"
+#include "libtrading/uring.h"
 #include "libtrading/array.h"
 #include "libtrading/time.h"
 #include "libtrading/die.h"
@@ -292,6 +293,7 @@ static int fix_client_order(struct fix_session_cfg *cfg, struct fix_client_arg *
 {
 	double min_usec, avg_usec, max_usec, total_usec;
 	struct fix_session *session = NULL;
+	uint64_t wire_nsec = 0;
 	struct fix_field *fields = NULL;
 	struct fix_message *msg;
 	FILE *file = NULL;
@@ -346,13 +348,19 @@ static int fix_client_order(struct fix_session_cfg *cfg, struct fix_client_arg *
 		fix_session_new_order_single(session, fields, nr);
 
 retry_warmup:
-		if (fix_session_recv(session, &msg, MSG_DONTWAIT) <= 0)
-			goto retry_warmup;
+		if (fix_session_recv(session, &msg, FIX_RECV_FLAG_SPIN) <= 0) {
+			fprintf(stderr, "Receive FAILED\n");
+			goto exit;
+		}
 
 		if (!fix_message_type_is(msg, FIX_MSG_TYPE_EXECUTION_REPORT))
 			goto retry_warmup;
 	}
 
+	session->nr_spin_polls	= 0;
+	session->nr_spin_hits	= 0;
+	session->nr_sleeps	= 0;
+
 	for (i = 0; i < orders; i++) {
 		struct timespec before, after;
 		uint64_t elapsed_usec;
@@ -362,14 +370,24 @@ retry_warmup:
 		fix_session_new_order_single(session, fields, nr);
 
 retry:
-		if (fix_session_recv(session, &msg, FIX_RECV_FLAG_MSG_DONTWAIT) <= 0)
-			goto retry;
+		if (fix_session_recv(session, &msg, FIX_RECV_FLAG_SPIN) <= 0) {
+			fprintf(stderr, "Receive FAILED\n");
+			goto exit;
+		}
 
 		if (!fix_message_type_is(msg, FIX_MSG_TYPE_EXECUTION_REPORT))
 			goto retry;
 
 		clock_gettime(CLOCK_MONOTONIC, &after);
 
+		if (cfg->rx_timestamps) {
+			struct timespec now;
+
+			clock_gettime(CLOCK_REALTIME, &now);
+
+			wire_nsec += timespec_delta(&msg->rx_timestamp, &now);
+		}
+
 		elapsed_usec = timespec_delta(&before, &after) / 1000;
 
 		total_usec += elapsed_usec;
@@ -385,6 +403,10 @@ retry:
 
 	fprintf(stdout, "Messages sent: %d\n", orders);
 	fprintf(stdout, "Round-trip time: min/avg/max = %.1lf/%.1lf/%.1lf μs\n", min_usec, avg_usec, max_usec);
+	fprintf(stdout, "Spin polls/hits/sleeps: %lu/%lu/%lu\n", session->nr_spin_polls, session->nr_spin_hits, session->nr_sleeps);
+
+	if (cfg->rx_timestamps)
+		fprintf(stdout, "Kernel RX to decode: avg %.1lf μs\n", (double) wire_nsec / orders / 1000.0);
 
 	if (session->active) {
 		ret = fix_session_logout(session, NULL);
@@ -408,7 +430,7 @@ exit:
 
 static void usage(void)
 {
-	printf("\n usage: %s [-m mode] [-d dialect] [-f filename] [-n orders] [-s sender-comp-id] [-t target-comp-id] [-r password] [-w warmup orders] -h hostname -p port\n\n", program);
+	printf("\n usage: %s [-m mode] [-d dialect] [-f filename] [-n orders] [-s sender-comp-id] [-t target-comp-id] [-r password] [-w warmup orders] [-S spin usec] [-B busy poll usec] [-T] [-u] -h hostname -p port\n\n", program);
 
 	exit(EXIT_FAILURE);
 }
@@ -465,7 +487,12 @@ int main(int argc, char *argv[])
 	struct fix_client_arg arg = {0};
 	const char *password = NULL;
 	struct fix_session_cfg cfg;
+	struct uring_cfg uring_cfg;
+	unsigned long spin_usec = 0;
 	const char *host = NULL;
+	bool rx_timestamps = false;
+	bool use_uring = false;
+	int busy_poll_usec = 0;
 	struct sockaddr_in sa;
 	int saved_errno = 0;
 	struct hostent *he;
@@ -476,7 +503,7 @@ int main(int argc, char *argv[])
 
 	program = basename(argv[0]);
 
-	while ((opt = getopt(argc, argv, "f:h:p:d:s:t:m:n:o:r:w:")) != -1) {
+	while ((opt = getopt(argc, argv, "f:h:p:d:s:t:m:n:o:r:w:uS:B:T")) != -1) {
 		switch (opt) {
 		case 'd':
 			version = strversion(optarg);
@@ -511,6 +538,18 @@ int main(int argc, char *argv[])
 		case 'w':
 			arg.warmup_orders = atoi(optarg);
 			break;
+		case 'u':
+			use_uring = true;
+			break;
+		case 'S':
+			spin_usec = strtoul(optarg, NULL, 10);
+			break;
+		case 'B':
+			busy_poll_usec = atoi(optarg);
+			break;
+		case 'T':
+			rx_timestamps = true;
+			break;
 		default: /* '?' */
 			usage();
 		}
@@ -521,7 +560,10 @@ int main(int argc, char *argv[])
 
 	fix_session_cfg_init(&cfg);
 
-	cfg.dialect	= &fix_dialects[version];
+	cfg.dialect		= &fix_dialects[version];
+	cfg.spin_usec		= spin_usec;
+	cfg.busy_poll_usec	= busy_poll_usec;
+	cfg.rx_timestamps	= rx_timestamps;
 
 	if (!password) {
 		memset(cfg.password, 0, ARRAY_SIZE(cfg.password));
@@ -575,6 +617,13 @@ int main(int argc, char *argv[])
 
 	cfg.heartbtint = 15;
 
+	if (use_uring) {
+		uring_cfg_init(&uring_cfg);
+
+		if (uring_init(&uring_cfg) < 0)
+			fprintf(stderr, "%s: io_uring not available (%s), using recv/sendmsg\n", program, strerror(errno));
+	}
+
 	switch (mode) {
 	case FIX_CLIENT_SCRIPT:
 		ret = fix_client_functions[mode].fix_session_initiate(&cfg, &arg);
@@ -589,6 +638,9 @@ int main(int argc, char *argv[])
 		error("Invalid mode");
 	}
 
+	uring_close(cfg.sockfd);
+	uring_exit();
+
 	shutdown(cfg.sockfd, SHUT_RDWR);
 
 	if (close(cfg.sockfd) < 0)
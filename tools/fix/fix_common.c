@@ -42,13 +42,13 @@ static int fix_do_unexpected(struct fix_session *session, struct fix_message *ms
 		}
 		fix_session_resend_request(session, session->in_msg_seq_num, end_seq_no);
 
-		session->in_msg_seq_num--;
+		fix_session_set_in_msg_seq_num(session, session->in_msg_seq_num - 1);
 	} else if (msg->msg_seq_num < session->in_msg_seq_num) {
 		snprintf(text, sizeof(text),
 			"MsgSeqNum too low, expecting %lu received %lu",
 				session->in_msg_seq_num, msg->msg_seq_num);
 
-		session->in_msg_seq_num--;
+		fix_session_set_in_msg_seq_num(session, session->in_msg_seq_num - 1);
 
 		if (!fix_get_field(msg, PossDupFlag)) {
 			fix_session_logout(session, text);
@@ -114,7 +114,7 @@ bool fix_session_admin(struct fix_session *session, struct fix_message *msg)
 
 		end_seq_num = field->int_value;
 
-		fix_session_sequence_reset(session, begin_seq_num, end_seq_num + 1, true);
+		fix_session_resend(session, begin_seq_num, end_seq_num);
 
 		goto done;
 	}
@@ -140,7 +140,7 @@ bool fix_session_admin(struct fix_session *session, struct fix_message *msg)
 				fix_session_resend_request(session,
 						exp_seq_num, msg_seq_num);
 
-				session->in_msg_seq_num--;
+				fix_session_set_in_msg_seq_num(session, session->in_msg_seq_num - 1);
 
 				goto done;
 			} else if (msg_seq_num < exp_seq_num) {
@@ -148,7 +148,7 @@ bool fix_session_admin(struct fix_session *session, struct fix_message *msg)
 					"MsgSeqNum too low, expecting %lu received %lu",
 								exp_seq_num, msg_seq_num);
 
-				session->in_msg_seq_num--;
+				fix_session_set_in_msg_seq_num(session, session->in_msg_seq_num - 1);
 
 				if (!fix_get_field(msg, PossDupFlag))
 					fix_session_logout(session, text);
@@ -157,7 +157,7 @@ bool fix_session_admin(struct fix_session *session, struct fix_message *msg)
 			}
 
 			if (new_seq_num > msg_seq_num) {
-				session->in_msg_seq_num = new_seq_num - 1;
+				fix_session_set_in_msg_seq_num(session, new_seq_num - 1);
 			} else {
 				snprintf(text, sizeof(text),
 					"Attempt to lower sequence number, invalid value NewSeqNum = %lu", new_seq_num);
@@ -174,12 +174,12 @@ bool fix_session_admin(struct fix_session *session, struct fix_message *msg)
 			new_seq_num = field->int_value;
 
 			if (new_seq_num > exp_seq_num) {
-				session->in_msg_seq_num = new_seq_num - 1;
+				fix_session_set_in_msg_seq_num(session, new_seq_num - 1);
 			} else if (new_seq_num < exp_seq_num) {
 				snprintf(text, sizeof(text),
 					"Value is incorrect (too low) %lu", new_seq_num);
 
-				session->in_msg_seq_num--;
+				fix_session_set_in_msg_seq_num(session, session->in_msg_seq_num - 1);
 
 				fix_session_reject(session, exp_seq_num, text);
 			}
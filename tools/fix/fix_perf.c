@@ -3,8 +3,12 @@
 #include <libtrading/proto/fix_session.h>
 #include <libtrading/buffer.h>
 #include <libtrading/compat.h>
+#include <libtrading/itoa.h>
+#include <libtrading/scan.h>
 #include <libtrading/time.h>
 
+#include "modp_numtoa.h"
+
 #include <libgen.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -106,6 +110,7 @@ static struct fix_template *new_order_single_template(char *now)
 	struct fix_template *template;
 
 	template = fix_template_new();
+	memset(&cfg, 0, sizeof(cfg));
 	cfg.begin_string = "FIX.4.2";
 	cfg.msg_type = FIX_MSG_TYPE_NEW_ORDER_SINGLE;
 	cfg.sender_comp_id = "DLD_TEX";
@@ -156,8 +161,7 @@ static void fix_template_unparse_benchmark(const int count, struct buffer *rx_bu
 	int i;
 
 	template = new_order_single_template(session.str_now);
-	strncpy(session.str_now, "20121227-11:20:43.000", 64);
-	fix_template_update_time(template, session.str_now);
+	fix_template_update_time(template, &(struct timespec) { 1356607243, 0 });	/* 20121227-11:20:43.000 */
 	session.out_msg_seq_num = 499650;
 	session.sender_comp_id = "ABC_DEF";
 
@@ -181,7 +185,262 @@ static void fix_template_unparse_benchmark(const int count, struct buffer *rx_bu
 	fix_template_free(template);
 }
 
-static void fix_message_parse_benchmark(const int count, struct buffer *rx_buf, struct fix_message *rx_msg, int flags) 
+static struct fix_template *new_order_single_slot_template(void)
+{
+	struct fix_template_cfg cfg;
+	struct fix_template *template;
+
+	template = fix_template_new();
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.begin_string = "FIX.4.2";
+	cfg.sender_comp_id = "DLD_TEX";
+	cfg.target_comp_id = "TEX_DLD";
+	cfg.nr_const_fields = fix_new_order_single_const_fields(&cfg.const_fields[0]);
+	cfg.const_fields[cfg.nr_const_fields++] = FIX_STRING_FIELD(Symbol, "ES");
+	cfg.const_fields[cfg.nr_const_fields++] = FIX_STRING_FIELD(107, "ESM5");
+	fix_template_cfg_new_order_single(&cfg, 8);
+	fix_template_prepare(template, &cfg);
+
+	return template;
+}
+
+/*
+ * Change ClOrdID, Side, OrderQty and Price for every message: once through
+ * the variable fields that are formatted on each unparse, and once through
+ * the fixed width slots that are patched in place.
+ */
+static void fix_template_slots_benchmark(const int count)
+{
+	struct fix_template *template;
+	struct fix_message *rx_msg;
+	struct buffer *rx_buf;
+	struct fix_session session;
+	struct timespec start, end;
+	uint64_t elapsed_nsec;
+	char cl_ord_id[9];
+	int templ_parse;
+	int i;
+
+	session.out_msg_seq_num = 499650;
+	session.sender_comp_id = "ABC_DEF";
+
+	template = new_order_single_template(session.str_now);
+	fix_template_update_time(template, &(struct timespec) { 1356607243, 0 });	/* 20121227-11:20:43.000 */
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (i = 0; i < count; i++) {
+		modp_litoa10_zpad(i % 100000000, 8, cl_ord_id);
+		cl_ord_id[8] = 0;
+
+		template->fields[0] = FIX_CHAR_FIELD(Side, i & 1 ? '1' : '2');
+		template->fields[3] = FIX_STRING_FIELD(ClOrdID, cl_ord_id);
+		template->fields[5] = FIX_FLOAT_FIELD(OrderQty, 1 + i % 100);
+		template->fields[6] = FIX_FLOAT_FIELD(Price, 10000 + i % 1000);
+
+		session.out_msg_seq_num++;
+		fix_template_unparse(template, &session);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	elapsed_nsec = timespec_delta(&start, &end);
+	printf("%-10s %d %f µs/message\n", "format/templ/vars", count, (double)elapsed_nsec/(double)count/1000.0);
+
+	fix_template_free(template);
+
+	template = new_order_single_slot_template();
+	fix_template_update_time(template, &(struct timespec) { 1356607243, 0 });	/* 20121227-11:20:43.000 */
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (i = 0; i < count; i++) {
+		modp_litoa10_zpad(i % 100000000, 8, cl_ord_id);
+		cl_ord_id[8] = 0;
+
+		fix_template_set_field(template, &FIX_CHAR_FIELD(Side, i & 1 ? '1' : '2'));
+		fix_template_set_field(template, &FIX_STRING_FIELD(ClOrdID, cl_ord_id));
+		fix_template_set_field(template, &FIX_FLOAT_FIELD(OrderQty, 1 + i % 100));
+		fix_template_set_field(template, &FIX_FLOAT_FIELD(Price, 10000 + i % 1000));
+
+		session.out_msg_seq_num++;
+		fix_template_unparse(template, &session);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	elapsed_nsec = timespec_delta(&start, &end);
+	printf("%-10s %d %f µs/message\n", "format/templ/slots", count, (double)elapsed_nsec/(double)count/1000.0);
+
+	rx_buf = buffer_new(4096);
+	rx_msg = fix_message_new();
+	buffer_printf(rx_buf, "%.*s", (int)buffer_size(&template->buf), buffer_start(&template->buf));
+
+	templ_parse = fix_message_parse(rx_msg, &fix_dialects[FIX_4_2], rx_buf, 0);
+	printf("template slots unparse status: %i\n", templ_parse);
+
+	fix_message_free(rx_msg);
+	buffer_delete(rx_buf);
+	fix_template_free(template);
+}
+
+static const char *scan_bytewise(const char *p, const char *end, char c)
+{
+	for (; p < end; p++) {
+		if (*p == c)
+			return p;
+	}
+
+	return NULL;
+}
+
+enum scan_mode {
+	SCAN_BYTEWISE,
+	SCAN_VECTOR,
+	SCAN_BITMAP,
+};
+
+static const char *scan_mode_names[] = {
+	[SCAN_BYTEWISE]	= "scan/bytes  ",
+	[SCAN_VECTOR]	= "scan/vector ",
+	[SCAN_BITMAP]	= "scan/bitmap ",
+};
+
+static unsigned long scan_message(enum scan_mode mode, const char *start, const char *end)
+{
+	u64 bitmap[SCAN_BITMAP_WORDS(4096)];
+	unsigned long nr = 0;
+	const char *p;
+	size_t i;
+
+	switch (mode) {
+	case SCAN_BYTEWISE:
+		for (p = start; (p = scan_bytewise(p, end, 0x01)) != NULL; p++)
+			nr++;
+		break;
+	case SCAN_VECTOR:
+		for (p = start; (p = scan_byte(p, end, 0x01)) != NULL; p++)
+			nr++;
+		break;
+	case SCAN_BITMAP:
+		scan_bitmap(start, end - start, 0x01, bitmap);
+
+		for (i = 0; i < SCAN_BITMAP_WORDS(end - start); i++)
+			nr += __builtin_popcountll(bitmap[i]);
+		break;
+	default:
+		break;
+	}
+
+	return nr;
+}
+
+/* Find every SOH in the message to compare the delimiter scanners. */
+static void fix_scan_benchmark(const int count, struct buffer *rx_buf, enum scan_mode mode)
+{
+	const char *start, *end;
+	struct timespec ts, te;
+	unsigned long nr = 0;
+	uint64_t elapsed_nsec;
+	int i;
+
+	start	= rx_buf->data;
+	end	= rx_buf->data + rx_buf->end;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	for (i = 0; i < count; i++) {
+		nr += scan_message(mode, start, end);
+
+		__asm__ __volatile__("" : : "r" (start) : "memory");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &te);
+
+	elapsed_nsec = timespec_delta(&ts, &te);
+
+	printf("%-10s %d %f µs/message %.1f MB/s (%lu fields)\n", scan_mode_names[mode], count,
+		(double)elapsed_nsec/(double)count/1000.0,
+		(double)(end - start) * count / ((double)elapsed_nsec / 1e9) / 1e6, nr / count);
+}
+
+static u8 sum_bytewise(const char *start, const char *end)
+{
+	unsigned long sum = 0;
+
+	for (; start < end; start++)
+		sum += *start;
+
+	return sum;
+}
+
+/* Compare the bytewise checksum with buffer_sum_range() from 64 B to 4 KB. */
+static void fix_checksum_benchmark(const int count)
+{
+	struct timespec ts, te;
+	uint64_t bytewise_nsec;
+	uint64_t vector_nsec;
+	char data[4096];
+	unsigned long sum;
+	size_t size, i;
+	int j;
+
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = 'A' + i % 26;
+
+	for (size = 64; size <= sizeof(data); size *= 2) {
+		int iters = count / (size / 64);
+
+		sum = 0;
+
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+
+		for (j = 0; j < iters; j++) {
+			sum += sum_bytewise(data, data + size);
+
+			__asm__ __volatile__("" : : "r" (data) : "memory");
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &te);
+
+		bytewise_nsec = timespec_delta(&ts, &te);
+
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+
+		for (j = 0; j < iters; j++) {
+			sum -= buffer_sum_range(data, data + size);
+
+			__asm__ __volatile__("" : : "r" (data) : "memory");
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &te);
+
+		vector_nsec = timespec_delta(&ts, &te);
+
+		printf("csum/%-4zu    %d bytewise %.1f ns vector %.1f ns (%.1fx)%s\n", size, iters,
+			(double)bytewise_nsec/(double)iters,
+			(double)vector_nsec/(double)iters,
+			(double)bytewise_nsec/(double)vector_nsec,
+			sum % 256 ? " MISMATCH" : "");
+	}
+}
+
+static const char *parse_mode_name(struct fix_dialect *dialect, int flags)
+{
+	/* Through tag_type() instead of the dialect's own parser */
+	if (!dialect->parse_body)
+		return "parse/generic";
+
+	if (flags & FIX_PARSE_FLAG_LAZY)
+		return "parse/lazy  ";
+
+	if (flags & FIX_PARSE_FLAG_ONE_PASS)
+		return flags & FIX_PARSE_FLAG_NO_CSUM ? "parse/1p/fast" : "parse/1pass ";
+
+	return flags & FIX_PARSE_FLAG_NO_CSUM ? "parse/fast  " : "parse       ";
+}
+
+static void fix_message_parse_benchmark(const int count, struct buffer *rx_buf, struct fix_message *rx_msg, struct fix_dialect *dialect, int flags)
 {
 	struct timespec start, end;
 	uint64_t elapsed_nsec;
@@ -193,19 +452,152 @@ static void fix_message_parse_benchmark(const int count, struct buffer *rx_buf,
 
 	for (i = 0; i < count; i++) {
 		rx_buf->start = 0;
-		fix_message_parse(rx_msg, &fix_dialects[FIX_4_2], rx_buf, flags);
+		fix_message_parse(rx_msg, dialect, rx_buf, flags);
 	}
 
 	clock_gettime(CLOCK_MONOTONIC, &end);
 
 	elapsed_nsec = timespec_delta(&start, &end);
 
-	printf("%-10s %d %f µs/message\n", (flags & FIX_PARSE_FLAG_NO_CSUM ? "parse/fast  " : "parse       "), count, (double)elapsed_nsec/(double)count/1000.0);
+	printf("%-10s %d %f µs/message %.1f MB/s\n", parse_mode_name(dialect, flags), count,
+		(double)elapsed_nsec/(double)count/1000.0,
+		(double)rx_buf->end * count / ((double)elapsed_nsec / 1e9) / 1e6);
+}
+
+/* Look up every field of a parsed message by tag, last field first. */
+static void fix_get_field_benchmark(const int count, struct buffer *rx_buf, struct fix_message *rx_msg)
+{
+	struct timespec start, end;
+	uint64_t elapsed_nsec;
+	unsigned long nr = 0;
+	int i, j;
+
+	rx_buf->start = 0;
+
+	if (fix_message_parse(rx_msg, &fix_dialects[FIX_4_2], rx_buf, 0))
+		return;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (i = 0; i < count; i++) {
+		for (j = rx_msg->nr_fields - 1; j >= 0; j--)
+			nr += fix_get_field(rx_msg, rx_msg->fields[j].tag) != NULL;
+
+		__asm__ __volatile__("" : : "r" (rx_msg) : "memory");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	elapsed_nsec = timespec_delta(&start, &end);
+
+	printf("%-10s %d %f µs/message (%lu fields)\n", "lookup      ", count,
+		(double)elapsed_nsec/(double)count/1000.0, nr / count);
+}
+
+static const char *prices[] = { "12.5", "101.0025", "0.005", "-3.75", "4321.10", "99" };
+
+#define NR_PRICES (sizeof(prices) / sizeof(prices[0]))
+
+/* Round-trip prices through strtod()/modp_dtoa2() and through struct fix_decimal. */
+static void fix_decimal_benchmark(const int count)
+{
+	struct timespec ts, te;
+	uint64_t double_nsec;
+	uint64_t decimal_nsec;
+	unsigned long len = 0;
+	char out[64];
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	for (i = 0; i < count; i++) {
+		const char *price = prices[i % NR_PRICES];
+
+		len += modp_dtoa2(strtod(price, NULL), out, 7);
+
+		__asm__ __volatile__("" : : "r" (out) : "memory");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &te);
+
+	double_nsec = timespec_delta(&ts, &te);
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	for (i = 0; i < count; i++) {
+		const char *price = prices[i % NR_PRICES];
+
+		len += fix_decimal_unparse(fix_decimal_parse(price, NULL), out);
+
+		__asm__ __volatile__("" : : "r" (out) : "memory");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &te);
+
+	decimal_nsec = timespec_delta(&ts, &te);
+
+	printf("price       %d double %.1f ns decimal %.1f ns (%.1fx) %lu bytes\n", count,
+		(double)double_nsec/(double)count,
+		(double)decimal_nsec/(double)count,
+		(double)double_nsec/(double)decimal_nsec, len);
+}
+
+/* Format SendingTime for a clock that moves on by a microsecond per message. */
+static void fix_timestamp_benchmark(const int count)
+{
+	struct timespec ts, te, now = { 1356607243, 0 };
+	struct fix_timestamp timestamp;
+	uint64_t strftime_nsec;
+	uint64_t cached_nsec;
+	char str[64];
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	for (i = 0; i < count; i++) {
+		time_t sec = now.tv_sec + i / 1000000;
+		char fmt[32];
+		struct tm tm;
+
+		gmtime_r(&sec, &tm);
+		strftime(fmt, sizeof(fmt), "%Y%m%d-%H:%M:%S", &tm);
+		snprintf(str, sizeof(str), "%s.%06d", fmt, i % 1000000);
+
+		__asm__ __volatile__("" : : "r" (str) : "memory");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &te);
+
+	strftime_nsec = timespec_delta(&ts, &te);
+
+	fix_timestamp_init(&timestamp, str, FIX_TIME_MICRO);
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	for (i = 0; i < count; i++) {
+		now.tv_sec	= 1356607243 + i / 1000000;
+		now.tv_nsec	= (i % 1000000) * 1000;
+
+		fix_timestamp_update(&timestamp, &now);
+
+		__asm__ __volatile__("" : : "r" (str) : "memory");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &te);
+
+	cached_nsec = timespec_delta(&ts, &te);
+
+	printf("timestamp   %d strftime %.1f ns cached %.1f ns (%.1fx) %.*s\n", count,
+		(double)strftime_nsec/(double)count,
+		(double)cached_nsec/(double)count,
+		(double)strftime_nsec/(double)cached_nsec,
+		(int)fix_timestamp_len(&timestamp), str);
 }
 
 int main(int argc, char *argv[])
 {
 	struct buffer *head_buf, *body_buf;
+	struct fix_dialect generic;
 	struct fix_message *rx_msg;
 	struct buffer *rx_buf;
 	int count;
@@ -222,10 +614,25 @@ int main(int argc, char *argv[])
 	rx_buf = buffer_new(4096);
 	rx_msg = fix_message_new();
 
+	generic = fix_dialects[FIX_4_2];
+	generic.parse_body = NULL;
+
 	fix_message_unparse_benchmark(count, head_buf, body_buf);
 	fix_template_unparse_benchmark(count, rx_buf, rx_msg);
-	fix_message_parse_benchmark(count, rx_buf, rx_msg, FIX_PARSE_FLAG_NO_CSUM);
-	fix_message_parse_benchmark(count, rx_buf, rx_msg, 0);
+	fix_template_slots_benchmark(count);
+	fix_scan_benchmark(count, rx_buf, SCAN_BYTEWISE);
+	fix_scan_benchmark(count, rx_buf, SCAN_VECTOR);
+	fix_scan_benchmark(count, rx_buf, SCAN_BITMAP);
+	fix_message_parse_benchmark(count, rx_buf, rx_msg, &generic, FIX_PARSE_FLAG_NO_CSUM);
+	fix_message_parse_benchmark(count, rx_buf, rx_msg, &fix_dialects[FIX_4_2], FIX_PARSE_FLAG_NO_CSUM);
+	fix_message_parse_benchmark(count, rx_buf, rx_msg, &fix_dialects[FIX_4_2], 0);
+	fix_message_parse_benchmark(count, rx_buf, rx_msg, &fix_dialects[FIX_4_2], FIX_PARSE_FLAG_ONE_PASS | FIX_PARSE_FLAG_NO_CSUM);
+	fix_message_parse_benchmark(count, rx_buf, rx_msg, &fix_dialects[FIX_4_2], FIX_PARSE_FLAG_ONE_PASS);
+	fix_message_parse_benchmark(count, rx_buf, rx_msg, &fix_dialects[FIX_4_2], FIX_PARSE_FLAG_ONE_PASS | FIX_PARSE_FLAG_LAZY);
+	fix_get_field_benchmark(count, rx_buf, rx_msg);
+	fix_checksum_benchmark(count);
+	fix_decimal_benchmark(count);
+	fix_timestamp_benchmark(count);
 
 	fix_message_free(rx_msg);
 	buffer_delete(rx_buf);
@@ -239,6 +239,11 @@ int fmsgcmp(struct fix_message *expected, struct fix_message *actual)
 				if (expected_field->float_value != actual_field->float_value)
 					goto exit;
 				break;
+			case FIX_TYPE_DECIMAL:
+				if (expected_field->decimal_mantissa != actual_field->decimal_mantissa ||
+				    expected_field->decimal_exponent != actual_field->decimal_exponent)
+					goto exit;
+				break;
 			case FIX_TYPE_CHAR:
 				if (fstrcasecmp(&expected_field->char_value, &actual_field->char_value))
 					goto exit;
@@ -321,6 +326,13 @@ void fprintmsg(FILE *stream, struct fix_message *msg)
 			case FIX_TYPE_FLOAT:
 				len += snprintf(buf + len, size - len, "%c%d=%f", delim, field->tag, field->float_value);
 				break;
+			case FIX_TYPE_DECIMAL: {
+				char value[64];
+
+				value[fix_decimal_unparse(fix_field_decimal(field), value)] = '\0';
+				len += snprintf(buf + len, size - len, "%c%d=%s", delim, field->tag, value);
+				break;
+			}
 			case FIX_TYPE_CHAR:
 				len += snprintf(buf + len, size - len, "%c%d=%c", delim, field->tag, field->char_value);
 				break;
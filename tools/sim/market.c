@@ -36,21 +36,6 @@ static void market_init(struct market *market)
 	return;
 }
 
-static inline struct fix_field *fix_field_by_tag(struct fix_message *msg, enum fix_tag tag)
-{
-	struct fix_field *field = NULL;
-	int i;
-
-	for (i = 0; i < msg->nr_fields; i++) {
-		field = msg->fields + i;
-
-		if (field->tag == tag)
-			return field;
-	}
-
-	return NULL;
-}
-
 static int do_income(struct market *market, int sockfd)
 {
 	struct fix_message *recv_msg;
@@ -89,7 +74,7 @@ static int do_income(struct market *market, int sockfd)
 		if (!fix_message_type_is(recv_msg, FIX_MSG_TYPE_LOGON))
 			goto logout;
 
-		field = fix_field_by_tag(recv_msg, SenderCompID);
+		field = fix_get_field(recv_msg, SenderCompID);
 		if (!field)
 			goto logout;
 
@@ -111,7 +96,7 @@ static int do_income(struct market *market, int sockfd)
 	} else if (fix_message_type_is(recv_msg, FIX_MSG_TYPE_NEW_ORDER_SINGLE)) {
 		order.trader = trader->id;
 
-		field = fix_field_by_tag(recv_msg, Side);
+		field = fix_get_field(recv_msg, Side);
 		if (!field)
 			goto done;
 
@@ -122,13 +107,13 @@ static int do_income(struct market *market, int sockfd)
 		else
 			goto done;
 
-		field = fix_field_by_tag(recv_msg, Price);
+		field = fix_get_field(recv_msg, Price);
 		if (!field)
 			goto done;
 
 		order.level = round(field->float_value);
 
-		field = fix_field_by_tag(recv_msg, OrderQty);
+		field = fix_get_field(recv_msg, OrderQty);
 		if (!field)
 			goto done;
 
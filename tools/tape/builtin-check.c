@@ -8,6 +8,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <inttypes.h>
+#include <pthread.h>
 #include <getopt.h>
 #include <libgen.h>
 #include <locale.h>
@@ -15,6 +16,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <sched.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
@@ -24,6 +26,7 @@ extern const char *program;
 
 static const char *filename;
 static bool show_progress = true;
+static bool pipeline;
 static bool verbose;
 
 static uint64_t stats[26];
@@ -44,6 +47,8 @@ static void usage(void)
 #define FMT								\
 "\n usage: %s check [<options>] [filename]\n"				\
 "\n    -v, --verbose         be more verbose\n"				\
+"    -q, --quiet           don't show progress\n"			\
+"    -p, --pipeline        inflate and decode on separate threads\n"	\
 "\n"
 	fprintf(stderr, FMT, program);
 #undef FMT
@@ -53,6 +58,8 @@ static void usage(void)
 
 static const struct option options[] = {
 	{ "verbose",	no_argument,	NULL, 'v' },
+	{ "quiet",	no_argument,	NULL, 'q' },
+	{ "pipeline",	no_argument,	NULL, 'p' },
 	{ }
 };
 
@@ -60,12 +67,26 @@ static void parse_args(int argc, char *argv[])
 {
 	int opt;
 
-	while ((opt = getopt_long(argc, argv, "v", options, NULL)) != -1) {
+	/* Start over if called more than once, as the tests do. */
+	show_progress	= true;
+	pipeline	= false;
+	verbose		= false;
+	optind		= 0;
+
+	memset(stats, 0, sizeof(stats));
+
+	while ((opt = getopt_long(argc, argv, "vqp", options, NULL)) != -1) {
 		switch (opt) {
 		case 'v':
 			verbose		= true;
 			show_progress	= false;
 			break;
+		case 'q':
+			show_progress	= false;
+			break;
+		case 'p':
+			pipeline	= true;
+			break;
 		default:
 			usage();
 			break;
@@ -82,6 +103,7 @@ static void parse_args(int argc, char *argv[])
 }
 
 #define BUFFER_SIZE	(1ULL << 20) /* 1 MB */
+#define MMAP_WINDOW	(32ULL << 20) /* 32 MB */
 
 static void print_stat(const char *name, u8 msg_type)
 {
@@ -114,9 +136,9 @@ static void print_stats(void)
 	printf("\n");
 }
 
-static void print_progress(struct buffer *comp_buf, unsigned long size)
+static void print_progress(unsigned long pos, unsigned long size)
 {
-	fprintf(stderr, "Processing messages: %3u%%\r", (unsigned int)(comp_buf->start * 100 / size));
+	fprintf(stderr, "Processing messages: %3u%%\r", (unsigned int)(pos * 100 / size));
 
 	fflush(stderr);
 }
@@ -134,39 +156,8 @@ static void release_stream(z_stream *stream)
 	inflateEnd(stream);
 }
 
-int cmd_check(int argc, char *argv[])
+static void check_serial(struct buffer *comp_buf, struct buffer *uncomp_buf, z_stream *stream, unsigned long size)
 {
-	struct buffer *comp_buf, *uncomp_buf;
-	z_stream stream;
-	struct stat st;
-	int fd;
-
-	setlocale(LC_ALL, "");
-
-	if (argc < 2)
-		usage();
-
-	parse_args(argc, argv);
-
-	init_stream(&stream);
-
-	fd = open(filename, O_RDONLY);
-	if (fd < 0)
-		die("%s: %s: %s\n", program, filename, strerror(errno));
-
-	if (fstat(fd, &st) < 0)
-		die("%s: %s: %s\n", program, filename, strerror(errno));
-
-	comp_buf = buffer_mmap(fd, st.st_size);
-	if (!comp_buf)
-		die("%s: %s\n", program, strerror(errno));
-
-	stream.next_in = (void *) buffer_start(comp_buf);
-
-	uncomp_buf = buffer_new(BUFFER_SIZE);
-	if (!uncomp_buf)
-		die("%s: %s\n", program, strerror(errno));
-
 	for (;;) {
 		struct itch41_message *msg;
 
@@ -176,15 +167,17 @@ retry_size:
 
 			buffer_compact(uncomp_buf);
 
-			nr = buffer_inflate(comp_buf, uncomp_buf, &stream);
+			nr = buffer_inflate(comp_buf, uncomp_buf, stream);
 			if (nr < 0)
 				die("%s: zlib error\n", program);
 
+			buffer_mmap_advance(comp_buf);
+
 			if (!nr)
 				break;
 
 			if (show_progress)
-				print_progress(comp_buf, st.st_size);
+				print_progress(comp_buf->start, size);
 
 			goto retry_size;
 		}
@@ -198,15 +191,17 @@ retry_message:
 
 			buffer_compact(uncomp_buf);
 
-			nr = buffer_inflate(comp_buf, uncomp_buf, &stream);
+			nr = buffer_inflate(comp_buf, uncomp_buf, stream);
 			if (nr < 0)
 				die("%s: zlib error\n", program);
 
+			buffer_mmap_advance(comp_buf);
+
 			if (!nr)
 				break;
 
 			if (show_progress)
-				print_progress(comp_buf, st.st_size);
+				print_progress(comp_buf->start, size);
 
 			goto retry_message;
 		}
@@ -216,6 +211,233 @@ retry_message:
 
 		stats[msg->MessageType - 'A']++;
 	}
+}
+
+/*
+ * In pipelined mode one thread inflates into a ring of large chunks and
+ * the decoding thread consumes them. Each chunk has CARRY_SIZE bytes of
+ * head room in front of the data: the tail of a message that straddles
+ * a chunk boundary is copied there so that the message is contiguous.
+ */
+#define CHUNK_SIZE	(4ULL << 20) /* 4 MB */
+#define CARRY_SIZE	256
+#define NR_CHUNKS	8
+
+struct chunk {
+	char			*data;
+	unsigned long		len;
+	unsigned long		comp_pos;
+};
+
+/* Single-producer, single-consumer queue that can hold every chunk. */
+struct chunk_queue {
+	struct chunk		*slots[NR_CHUNKS];
+	unsigned long		head __attribute__((aligned(64)));
+	unsigned long		tail __attribute__((aligned(64)));
+};
+
+static void chunk_queue_push(struct chunk_queue *q, struct chunk *chunk)
+{
+	unsigned long tail = q->tail;
+
+	while (tail - __atomic_load_n(&q->head, __ATOMIC_ACQUIRE) == NR_CHUNKS)
+		sched_yield();
+
+	q->slots[tail % NR_CHUNKS] = chunk;
+
+	__atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+static struct chunk *chunk_queue_pop(struct chunk_queue *q)
+{
+	unsigned long head = q->head;
+	struct chunk *chunk;
+
+	while (__atomic_load_n(&q->tail, __ATOMIC_ACQUIRE) == head)
+		sched_yield();
+
+	chunk = q->slots[head % NR_CHUNKS];
+
+	__atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+
+	return chunk;
+}
+
+struct inflater {
+	struct buffer		*comp_buf;
+	z_stream		*stream;
+	struct chunk_queue	full;
+	struct chunk_queue	free;
+};
+
+static void *inflate_thread(void *arg)
+{
+	struct inflater *inflater = arg;
+
+	for (;;) {
+		struct chunk *chunk;
+		struct buffer buf;
+		ssize_t nr;
+
+		chunk = chunk_queue_pop(&inflater->free);
+
+		buf = (struct buffer) {
+			.data		= chunk->data + CARRY_SIZE,
+			.capacity	= CHUNK_SIZE,
+		};
+
+		do {
+			nr = buffer_inflate(inflater->comp_buf, &buf, inflater->stream);
+			if (nr < 0)
+				die("%s: zlib error\n", program);
+
+			buffer_mmap_advance(inflater->comp_buf);
+		} while (nr && buffer_remaining(&buf));
+
+		chunk->len	= buffer_size(&buf);
+		chunk->comp_pos	= inflater->comp_buf->start;
+
+		chunk_queue_push(&inflater->full, chunk);
+
+		/* An empty chunk marks the end of the stream. */
+		if (!chunk->len)
+			break;
+	}
+
+	return NULL;
+}
+
+static void decode_messages(struct buffer *buf)
+{
+	while (buffer_size(buf) >= sizeof(u16)) {
+		unsigned long start = buf->start;
+		struct itch41_message *msg;
+
+		buffer_advance(buf, sizeof(u16));
+
+		msg = itch41_message_decode(buf);
+		if (!msg) {
+			buf->start = start;
+			break;
+		}
+
+		if (verbose)
+			printf("%c", msg->MessageType);
+
+		stats[msg->MessageType - 'A']++;
+	}
+}
+
+static void check_pipelined(struct buffer *comp_buf, z_stream *stream, unsigned long size)
+{
+	struct chunk chunks[NR_CHUNKS];
+	struct inflater inflater = {
+		.comp_buf	= comp_buf,
+		.stream		= stream,
+	};
+	struct chunk *prev = NULL;
+	const char *carry = NULL;
+	unsigned long carry_len = 0;
+	pthread_t thread;
+	unsigned int i;
+
+	for (i = 0; i < NR_CHUNKS; i++) {
+		chunks[i].data = malloc(CARRY_SIZE + CHUNK_SIZE);
+		if (!chunks[i].data)
+			die("%s: %s\n", program, strerror(errno));
+
+		chunk_queue_push(&inflater.free, &chunks[i]);
+	}
+
+	if (pthread_create(&thread, NULL, inflate_thread, &inflater))
+		die("%s: unable to create inflate thread\n", program);
+
+	for (;;) {
+		struct chunk *chunk;
+		struct buffer buf;
+
+		chunk = chunk_queue_pop(&inflater.full);
+		if (!chunk->len)
+			break;
+
+		if (carry_len)
+			memcpy(chunk->data + CARRY_SIZE - carry_len, carry, carry_len);
+
+		if (prev)
+			chunk_queue_push(&inflater.free, prev);
+
+		buf = (struct buffer) {
+			.data		= chunk->data,
+			.start		= CARRY_SIZE - carry_len,
+			.end		= CARRY_SIZE + chunk->len,
+			.capacity	= CARRY_SIZE + CHUNK_SIZE,
+		};
+
+		decode_messages(&buf);
+
+		carry		= buffer_start(&buf);
+		carry_len	= buffer_size(&buf);
+
+		if (carry_len > CARRY_SIZE)
+			die("%s: %s: garbled message at offset %lu\n", program, filename, chunk->comp_pos);
+
+		prev = chunk;
+
+		if (show_progress)
+			print_progress(chunk->comp_pos, size);
+	}
+
+	pthread_join(thread, NULL);
+
+	for (i = 0; i < NR_CHUNKS; i++)
+		free(chunks[i].data);
+}
+
+int cmd_check(int argc, char *argv[])
+{
+	struct buffer *comp_buf, *uncomp_buf;
+	struct buffer_mmap_cfg mmap_cfg;
+	z_stream stream;
+	struct stat st;
+	int fd;
+
+	setlocale(LC_ALL, "");
+
+	if (argc < 2)
+		usage();
+
+	parse_args(argc, argv);
+
+	init_stream(&stream);
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		die("%s: %s: %s\n", program, filename, strerror(errno));
+
+	if (fstat(fd, &st) < 0)
+		die("%s: %s: %s\n", program, filename, strerror(errno));
+
+	/* Stream the file through a bounded window of resident pages. */
+	buffer_mmap_cfg_init(&mmap_cfg);
+
+	mmap_cfg.flags		= BUFFER_MMAP_SEQUENTIAL;
+	mmap_cfg.readahead	= MMAP_WINDOW;
+	mmap_cfg.release	= MMAP_WINDOW;
+
+	comp_buf = buffer_mmap_with(fd, st.st_size, &mmap_cfg);
+	if (!comp_buf)
+		die("%s: %s\n", program, strerror(errno));
+
+	stream.next_in = (void *) buffer_start(comp_buf);
+
+	uncomp_buf = buffer_new(BUFFER_SIZE);
+	if (!uncomp_buf)
+		die("%s: %s\n", program, strerror(errno));
+
+	if (pipeline)
+		check_pipelined(comp_buf, &stream, st.st_size);
+	else
+		check_serial(comp_buf, uncomp_buf, &stream, st.st_size);
 
 	printf("\n");
 
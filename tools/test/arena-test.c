@@ -0,0 +1,63 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/arena.h"
+
+#include <stdint.h>
+#include <string.h>
+
+void test_arena_alloc(void)
+{
+	struct arena *arena = arena_new(256);
+	char *a, *b, *c;
+
+	a = arena_alloc(arena, 100);
+	b = arena_alloc(arena, 100);
+	assert_true(a != NULL && b != NULL);
+	assert_int_equals(0, (uintptr_t) b % 16);
+	assert_true(b >= a + 100);
+
+	/* Does not fit in what is left of the first chunk. */
+	c = arena_alloc(arena, 100);
+	assert_true(c != NULL);
+	assert_true(c < a || c >= a + 256);
+
+	/* Larger than a chunk */
+	assert_true(arena_alloc(arena, 1000) != NULL);
+
+	/* Reset hands out the same memory again. */
+	arena_reset(arena);
+
+	assert_true(arena_alloc(arena, 100) == a);
+	assert_true(arena_alloc(arena, 100) == b);
+	assert_true(arena_alloc(arena, 100) == c);
+
+	arena_delete(arena);
+}
+
+void test_arena_grow(void)
+{
+	struct arena *arena = arena_new(256);
+	char *a, *b;
+
+	a = arena_alloc(arena, 16);
+	memcpy(a, "0123456789abcdef", 16);
+
+	/* The latest allocation grows in place. */
+	assert_true(arena_grow(arena, a, 16, 64) == a);
+
+	b = arena_alloc(arena, 16);
+
+	/* Otherwise it is copied. */
+	a = arena_grow(arena, a, 64, 128);
+	assert_true(a != NULL);
+	assert_true(a > b);
+	assert_str_equals("0123456789abcdef", a, 16);
+
+	/* Past the end of the chunk */
+	a = arena_grow(arena, a, 128, 512);
+	assert_true(a != NULL);
+	assert_str_equals("0123456789abcdef", a, 16);
+
+	arena_delete(arena);
+}
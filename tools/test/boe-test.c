@@ -276,3 +276,37 @@ void test_boe_replay_complete(void)
 
 	fail_if(close(fd) < 0);
 }
+
+void test_boe_message_view_partial(void)
+{
+	struct boe_message *msg;
+	struct buffer *buf;
+	int fd;
+
+	buf = buffer_new(1024);
+
+	fd = open(DATA_PATH "login-request-message.bin", O_RDONLY);
+	fail_if(fd < 0);
+
+	fail_if(buffer_xread(buf, fd) < 0);
+
+	/* A frame is only returned once all of it has arrived. */
+	buf->end -= 10;
+
+	assert_true(boe_message_view(buf) == NULL);
+	assert_int_equals(0, buf->start);
+
+	buf->end += 10;
+
+	msg = boe_message_view(buf);
+	fail_if(msg == NULL);
+
+	assert_true((char *) msg == buf->data);
+	assert_int_equals(131, msg->header.MessageLength);
+	assert_int_equals(LoginRequest, msg->header.MessageType);
+	assert_int_equals(0, buffer_size(buf));
+
+	buffer_delete(buf);
+
+	fail_if(close(fd) < 0);
+}
@@ -0,0 +1,200 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/read-write.h"
+#include "libtrading/buffer.h"
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+
+void test_buffer_mirror_wrap(void)
+{
+	const char *expected = "8=FIX.4.4\1";
+	struct buffer *buf;
+	unsigned long size;
+
+	buf = buffer_mirror_new(4096);
+	fail_if(buf == NULL);
+
+	size = buf->mirror;
+
+	/* Consume all but the last four bytes of the ring. */
+	buffer_advance_end(buf, size - 4);
+	buffer_advance(buf, size - 4);
+
+	buffer_compact(buf);
+	assert_int_equals(size, buffer_remaining(buf));
+
+	memcpy(buffer_end(buf), expected, strlen(expected));
+	buffer_advance_end(buf, strlen(expected));
+
+	/* The message wraps around but is still contiguous. */
+	assert_str_equals(expected, buffer_start(buf), strlen(expected));
+	assert_str_equals(expected + 4, buf->data, strlen(expected) - 4);
+
+	buffer_advance(buf, strlen(expected));
+	buffer_compact(buf);
+
+	assert_true(buf->start < size);
+	assert_int_equals(0, buffer_size(buf));
+	assert_int_equals(size, buffer_remaining(buf));
+
+	buffer_delete(buf);
+}
+
+void test_buffer_sum_range(void)
+{
+	char data[4096 + 64];
+	unsigned long sum;
+	size_t len, i;
+
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = (i * 131) ^ (i >> 3);
+
+	/* All lengths around the vector widths, from unaligned starts. */
+	for (len = 0; len < 300; len++) {
+		for (i = 0; i < 3; i++) {
+			const char *p;
+
+			for (sum = 0, p = data + i; p < data + i + len; p++)
+				sum += (u8) *p;
+
+			assert_int_equals(sum % 256, buffer_sum_range(data + i, data + i + len));
+		}
+	}
+
+	for (sum = 0, i = 0; i < 4096; i++)
+		sum += (u8) data[i];
+
+	assert_int_equals(sum % 256, buffer_sum_range(data, data + 4096));
+}
+
+void test_buffer_recv_ts(void)
+{
+	struct sockaddr_in addr = { .sin_family = AF_INET };
+	socklen_t addrlen = sizeof(addr);
+	struct timespec before, ts;
+	struct buffer *buf;
+	int rx, tx;
+
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	rx = socket(AF_INET, SOCK_DGRAM, 0);
+	tx = socket(AF_INET, SOCK_DGRAM, 0);
+	fail_if(rx < 0 || tx < 0);
+
+	fail_if(bind(rx, (struct sockaddr *) &addr, sizeof(addr)) < 0);
+	fail_if(getsockname(rx, (struct sockaddr *) &addr, &addrlen) < 0);
+	fail_if(rx_timestamps_enable(rx) < 0);
+
+	clock_gettime(CLOCK_REALTIME, &before);
+
+	fail_if(sendto(tx, "8=FIX.4.4\1", 10, 0, (struct sockaddr *) &addr, sizeof(addr)) != 10);
+
+	buf = buffer_new(64);
+	fail_if(buf == NULL);
+
+	assert_int_equals(10, buffer_recv_ts(buf, rx, 64, 0, &ts));
+	assert_str_equals("8=FIX.4.4\1", buffer_start(buf), 10);
+
+	/* Software timestamps are taken from CLOCK_REALTIME. */
+	assert_true(ts.tv_sec > 0);
+	assert_true(ts.tv_sec >= before.tv_sec && ts.tv_sec - before.tv_sec < 5);
+
+	buffer_delete(buf);
+	close(rx);
+	close(tx);
+}
+
+void test_buffer_view(void)
+{
+	const char frame[] = { 0x0b, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+	struct buffer_view view = { NULL, 0 };
+	struct buffer *buf;
+
+	buf = buffer_new(64);
+	fail_if(buf == NULL);
+
+	memcpy(buffer_end(buf), frame, sizeof(frame));
+	buffer_advance_end(buf, sizeof(frame));
+
+	assert_false(buffer_view(buf, sizeof(frame) + 1, &view));
+	assert_true(buffer_view(buf, sizeof(frame), &view));
+
+	/* Fields at odd offsets are loaded unaligned. */
+	assert_int_equals(0x0b, view_8(&view, 0));
+	assert_int_equals(0x000b, view_le16(&view, 0));
+	assert_int_equals(0x0102, view_be16(&view, 2));
+	assert_int_equals(0x05040302, view_le32(&view, 3));
+	assert_int_equals(0x02030405, view_be32(&view, 3));
+	assert_int_equals(0x0908070605040302ULL, view_le64(&view, 3));
+	assert_int_equals(0x0203040506070809ULL, view_be64(&view, 3));
+
+	/* Taking a view does not consume anything. */
+	assert_int_equals(sizeof(frame), buffer_size(buf));
+
+	assert_int_equals(0x000b, buffer_get_le16(buf));
+	assert_int_equals(0x0102, buffer_get_be16(buf));
+	assert_int_equals(0x03, buffer_get_8(buf));
+	assert_int_equals(0x07060504, buffer_get_le32(buf));
+	assert_int_equals(0x0809, buffer_get_be16(buf));
+	assert_int_equals(0, buffer_size(buf));
+
+	buffer_delete(buf);
+}
+
+void test_buffer_mmap_advance(void)
+{
+	char path[] = "/tmp/buffer-test-XXXXXX";
+	struct buffer_mmap_cfg cfg;
+	struct buffer stack_buf;
+	struct buffer *buf;
+	char data[16384];
+	int fd;
+
+	fd = mkstemp(path);
+	fail_if(fd < 0);
+	unlink(path);
+
+	memset(data, 'x', sizeof(data));
+	assert_int_equals(sizeof(data), write(fd, data, sizeof(data)));
+
+	buffer_mmap_cfg_init(&cfg);
+
+	cfg.readahead	= 4096;
+	cfg.release	= 4096;
+
+	buf = buffer_mmap_with(fd, sizeof(data), &cfg);
+	fail_if(buf == NULL);
+
+	buffer_advance(buf, sizeof(data) / 2);
+	assert_int_equals(0, buffer_mmap_advance(buf));
+	assert_int_equals('x', buffer_peek_8(buf));
+
+	buffer_munmap(buf);
+	close(fd);
+
+	/* Buffers from other constructors are refused. */
+	buf = buffer_new(64);
+	fail_if(buf == NULL);
+
+	assert_int_equals(-1, buffer_mmap_advance(buf));
+	assert_int_equals(EINVAL, errno);
+
+	buffer_delete(buf);
+
+	buf = buffer_mirror_new(4096);
+	fail_if(buf == NULL);
+
+	assert_int_equals(-1, buffer_mmap_advance(buf));
+
+	buffer_mirror_delete(buf);
+
+	stack_buf = (struct buffer) { .data = data, .capacity = sizeof(data) };
+	assert_int_equals(-1, buffer_mmap_advance(&stack_buf));
+}
@@ -0,0 +1,159 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/proto/fast_session.h"
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#define BATCH_SIZE	4
+#define NR_PACKETS	(2 * BATCH_SIZE - 1)	/* the last batch comes up short */
+#define RECV_TIMEOUT	5			/* seconds */
+
+static const char template[] =
+	"<templates>\n"
+	"  <template name=\"Tick\" id=\"1\">\n"
+	"    <uInt32 name=\"Seq\" />\n"
+	"    <string name=\"Symbol\" />\n"
+	"  </template>\n"
+	"</templates>\n";
+
+static char path[] = "/tmp/fast_session-test-XXXXXX";
+
+/* Two UDP sockets on the loopback interface, the first connected to the second. */
+static void loopback_pair(int sv[2])
+{
+	struct sockaddr_in sa;
+	socklen_t len = sizeof(sa);
+
+	memset(&sa, 0, sizeof(sa));
+
+	sa.sin_family		= AF_INET;
+	sa.sin_addr.s_addr	= htonl(INADDR_LOOPBACK);
+
+	sv[1] = socket(AF_INET, SOCK_DGRAM, 0);
+	fail_if(sv[1] < 0);
+
+	fail_if(bind(sv[1], (struct sockaddr *) &sa, sizeof(sa)) < 0);
+	fail_if(getsockname(sv[1], (struct sockaddr *) &sa, &len) < 0);
+
+	sv[0] = socket(AF_INET, SOCK_DGRAM, 0);
+	fail_if(sv[0] < 0);
+
+	fail_if(connect(sv[0], (struct sockaddr *) &sa, sizeof(sa)) < 0);
+}
+
+static struct fast_session *session_new(int sockfd, int batch_size)
+{
+	struct fast_session_cfg cfg;
+	struct fast_session *session;
+
+	fast_session_cfg_init(&cfg);
+
+	cfg.sockfd	= sockfd;
+	cfg.batch_size	= batch_size;
+
+	session = fast_session_new(&cfg);
+	fail_if(session == NULL);
+
+	assert_int_equals(0, fast_parse_template(session, path));
+
+	return session;
+}
+
+static void send_tick(struct fast_session *tx, unsigned long seq)
+{
+	struct fast_message *msg;
+	struct fast_field *field;
+
+	msg = fast_msg_by_name(tx, "Tick");
+	fail_if(msg == NULL);
+
+	field = fast_get_field(msg, "Seq");
+	field->uint_value	= seq;
+	field->state		= FAST_STATE_ASSIGNED;
+
+	field = fast_get_field(msg, "Symbol");
+	snprintf(field->string_value, sizeof(field->string_value), "SYM%lu", seq);
+	field->state		= FAST_STATE_ASSIGNED;
+
+	assert_int_equals(0, fast_session_send(tx, msg, 0));
+}
+
+void test_fast_session_recv_batch(void)
+{
+	struct timeval timeout = { .tv_sec = RECV_TIMEOUT };
+	struct timespec start, end;
+	struct fast_session *tx, *rx;
+	struct fast_message *msg;
+	unsigned long i;
+	int sv[2];
+	int fd;
+
+	fd = mkstemp(path);
+	fail_if(fd < 0);
+
+	assert_int_equals(strlen(template), write(fd, template, strlen(template)));
+	close(fd);
+
+	loopback_pair(sv);
+
+	tx = session_new(sv[0], 0);
+	rx = session_new(sv[1], BATCH_SIZE);
+
+	assert_true(rx->rx_mmsgs != NULL);
+
+	for (i = 0; i < NR_PACKETS; i++)
+		send_tick(tx, i);
+
+	/* One message per datagram, in order, across a full and a partial batch */
+	for (i = 0; i < NR_PACKETS; i++) {
+		char symbol[16];
+
+		msg = fast_session_recv(rx, MSG_DONTWAIT);
+		fail_if(msg == NULL);
+
+		assert_int_equals(1, msg->tid);
+		assert_int_equals(i, fast_get_field(msg, "Seq")->uint_value);
+
+		snprintf(symbol, sizeof(symbol), "SYM%lu", i);
+		assert_str_equals(symbol, fast_get_field(msg, "Symbol")->string_value, strlen(symbol) + 1);
+	}
+
+	assert_true(fast_session_recv(rx, MSG_DONTWAIT) == NULL);
+
+	assert_int_equals(2, rx->nr_recv_calls);
+	assert_int_equals(NR_PACKETS, rx->nr_recv_packets);
+	assert_int_equals(NR_PACKETS, rx->nr_recv_messages);
+
+	/* A blocking receive returns with fewer datagrams than a batch. */
+	fail_if(setsockopt(sv[1], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) < 0);
+
+	send_tick(tx, NR_PACKETS);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	msg = fast_session_recv(rx, 0);
+	fail_if(msg == NULL);
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	assert_int_equals(NR_PACKETS, fast_get_field(msg, "Seq")->uint_value);
+	assert_int_equals(3, rx->nr_recv_calls);
+	assert_true(end.tv_sec - start.tv_sec < RECV_TIMEOUT);
+
+	fast_session_free(tx);
+	fast_session_free(rx);
+
+	close(sv[0]);
+	close(sv[1]);
+
+	unlink(path);
+}
@@ -0,0 +1,101 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/proto/fix_journal.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static struct fix_journal_cfg	cfg;
+static char			path[] = "/tmp/fix_journal-test-XXXXXX";
+
+static void setup(void)
+{
+	int fd;
+
+	fd = mkstemp(path);
+	close(fd);
+
+	/* An empty file is initialized as a new journal. */
+	fix_journal_cfg_init(&cfg);
+
+	cfg.path	= path;
+	cfg.size	= 64;
+	cfg.max_msgs	= 4;
+}
+
+static void teardown(void)
+{
+	unlink(path);
+	strcpy(path, "/tmp/fix_journal-test-XXXXXX");
+}
+
+static int append(struct fix_journal *journal, unsigned long msg_seq_num, const char *head, const char *body)
+{
+	struct iovec iov[2] = {
+		{ .iov_base = (void *) head, .iov_len = strlen(head) },
+		{ .iov_base = (void *) body, .iov_len = strlen(body) },
+	};
+
+	return fix_journal_append(journal, msg_seq_num, iov, 2);
+}
+
+void test_fix_journal_append(void)
+{
+	struct fix_journal *journal;
+	const char *msg;
+	size_t len;
+
+	setup();
+
+	journal = fix_journal_new(&cfg);
+	assert_true(journal != NULL);
+
+	assert_int_equals(0, append(journal, 5, "head5", "body5"));
+	assert_int_equals(0, append(journal, 7, "head7", "body7"));
+
+	/* Out of index entries and out of space */
+	assert_int_equals(-1, append(journal, 9, "head9", "body9"));
+	assert_int_equals(-1, append(journal, 8, "head8", "a very long body that does not fit in the journal"));
+
+	assert_true(fix_journal_get(journal, 4, &len) == NULL);
+	assert_true(fix_journal_get(journal, 6, &len) == NULL);
+	assert_true(fix_journal_get(journal, 8, &len) == NULL);
+
+	fix_journal_free(journal);
+
+	/* The messages are still there when the journal is opened again. */
+	journal = fix_journal_new(&cfg);
+	assert_true(journal != NULL);
+
+	msg = fix_journal_get(journal, 5, &len);
+	assert_true(msg != NULL);
+	assert_int_equals(10, len);
+	assert_str_equals("head5body5", msg, 10);
+
+	msg = fix_journal_get(journal, 7, &len);
+	assert_true(msg != NULL);
+	assert_int_equals(10, len);
+	assert_str_equals("head7body7", msg, 10);
+
+	/* A MsgSeqNum that doesn't go up starts the journal over. */
+	assert_int_equals(0, append(journal, 7, "xxxxx", "xxxxx"));
+	assert_true(fix_journal_get(journal, 5, &len) == NULL);
+
+	assert_int_equals(0, append(journal, 1, "head1", "body1"));
+	assert_true(fix_journal_get(journal, 7, &len) == NULL);
+
+	msg = fix_journal_get(journal, 1, &len);
+	assert_true(msg != NULL);
+	assert_int_equals(10, len);
+	assert_str_equals("head1body1", msg, 10);
+
+	fix_journal_free(journal);
+
+	/* A journal created with another layout is refused. */
+	cfg.max_msgs = 8;
+	assert_true(fix_journal_new(&cfg) == NULL);
+
+	teardown();
+}
@@ -0,0 +1,114 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/proto/fix_log.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+
+static char			tmpdir[] = "/tmp/fix_log-test-XXXXXX";
+static char			path[64];
+
+/* Append the contents of <path>.<index> to 'data', -1 if there's no such file. */
+static ssize_t read_log(unsigned long index, char *data, size_t size)
+{
+	char name[128];
+	ssize_t len;
+	int fd;
+
+	snprintf(name, sizeof(name), "%s.%lu", path, index);
+
+	fd = open(name, O_RDONLY);
+	if (fd < 0)
+		return -1;
+
+	len = read(fd, data, size);
+
+	close(fd);
+
+	return len;
+}
+
+static void teardown(void)
+{
+	char name[128];
+	unsigned long i;
+
+	for (i = 0; ; i++) {
+		snprintf(name, sizeof(name), "%s.%lu", path, i);
+		if (unlink(name) < 0)
+			break;
+	}
+
+	rmdir(tmpdir);
+}
+
+static int log_message(struct fix_log *log, enum fix_log_dir dir, const char *msg)
+{
+	struct iovec iov = { .iov_base = (void *) msg, .iov_len = strlen(msg) };
+
+	return fix_log_write(log, dir, &iov, 1);
+}
+
+void test_fix_log_write(void)
+{
+	struct fix_log_cfg cfg;
+	struct fix_log *log;
+	char msg[2048];
+	char data[16384];
+	char *p = data;
+	unsigned long i;
+	size_t len = 0;
+	ssize_t ret;
+
+	mkdtemp(tmpdir);
+	snprintf(path, sizeof(path), "%s/log", tmpdir);
+
+	fix_log_cfg_init(&cfg);
+
+	cfg.path	= path;
+	cfg.ring_size	= 4096;
+	cfg.rotate_size	= 100;
+	cfg.full	= FIX_LOG_FULL_BLOCK;
+
+	log = fix_log_new(&cfg);
+	assert_true(log != NULL);
+
+	for (i = 0; i < 200; i++) {
+		sprintf(msg, "35=D\00111=%03lu\001", i);
+		assert_int_equals(0, log_message(log, i % 2 ? FIX_LOG_IN : FIX_LOG_OUT, msg));
+	}
+
+	/* Records that would take more than half of the ring are dropped. */
+	memset(msg, 'x', sizeof(msg) - 1);
+	msg[sizeof(msg) - 1] = 0;
+	assert_int_equals(-1, log_message(log, FIX_LOG_OUT, msg));
+	assert_int_equals(1, log->nr_dropped);
+
+	fix_log_free(log);
+
+	/* One line per message, in order, spread over the rotated files */
+	for (i = 0; (ret = read_log(i, data + len, sizeof(data) - len - 1)) >= 0; i++)
+		len += ret;
+
+	assert_true(i > 1);
+
+	data[len] = 0;
+
+	for (i = 0; i < 200; i++) {
+		char expected[32];
+		char *line;
+
+		line = strsep(&p, "\n");
+
+		sprintf(expected, " %s 35=D\00111=%03lu\001", i % 2 ? "IN " : "OUT", i);
+
+		assert_int_equals(27 + strlen(expected), strlen(line));
+		assert_str_equals(expected, line + 27, strlen(expected));
+	}
+
+	teardown();
+}
@@ -0,0 +1,609 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/proto/fix_message.h"
+#include "libtrading/proto/fix_session.h"
+#include "libtrading/proto/micex_fix.h"
+#include "libtrading/buffer.h"
+#include "libtrading/arena.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+static const char *order =
+	"8=FIX.4.2\0019=126\00135=D\00134=2\00149=BUYSIDE\00152=20121227-11:20:43.000\00156=SELLSIDE\001"
+	"11=ORD-1\00121=1\00155=LNUX\00154=1\00160=20121227-11:20:43\00138=100\00140=2\00144=12.5\001"
+	"10=101\001";
+
+static struct fix_message	*msg;
+static struct buffer		*buf;
+
+static void setup(const char *data, size_t len, unsigned long capacity)
+{
+	msg = fix_message_new();
+	buf = buffer_new(capacity);
+
+	memcpy(buffer_end(buf), data, len);
+	buffer_advance_end(buf, len);
+}
+
+static void teardown(void)
+{
+	fix_message_free(msg);
+	buffer_delete(buf);
+}
+
+static void parse_order(unsigned long flags, unsigned long capacity)
+{
+	setup(order, strlen(order), capacity);
+
+	assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, flags));
+
+	assert_int_equals(FIX_MSG_TYPE_NEW_ORDER_SINGLE, msg->type);
+	assert_int_equals(2, msg->msg_seq_num);
+	assert_int_equals(11, msg->nr_fields);
+	assert_int_equals(0, buffer_size(buf));
+	assert_int_equals(strlen(order), fix_message_size(msg));
+
+	assert_str_equals("ORD-1", fix_get_field(msg, ClOrdID)->string_value, 5);
+	assert_int_equals(12.5 * 100, fix_get_field(msg, Price)->float_value * 100);
+	assert_str_equals("101", msg->check_sum, 3);
+
+	teardown();
+}
+
+void test_fix_message_parse(void)
+{
+	parse_order(0, 4096);
+}
+
+void test_fix_message_parse_one_pass(void)
+{
+	parse_order(FIX_PARSE_FLAG_ONE_PASS, 4096);
+
+	/* No room to read a whole block past the end of the message */
+	parse_order(FIX_PARSE_FLAG_ONE_PASS, strlen(order));
+}
+
+void test_fix_message_parse_one_pass_partial(void)
+{
+	size_t len;
+
+	/* Every truncation leaves the buffer untouched for the next read. */
+	for (len = 1; len < strlen(order); len++) {
+		setup(order, len, 4096);
+
+		assert_int_equals(-1, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, FIX_PARSE_FLAG_ONE_PASS));
+		assert_int_equals(0, buf->start);
+
+		teardown();
+	}
+}
+
+void test_fix_message_parse_one_pass_garbled(void)
+{
+	char data[512];
+	size_t len;
+
+	len = strlen(order);
+
+	/* Bad CheckSum: the message is skipped. */
+	memcpy(data, order, len);
+	data[len - 2] = '9';
+
+	setup(data, len, 4096);
+	assert_int_equals(-1, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, FIX_PARSE_FLAG_ONE_PASS));
+	assert_int_equals(0, buffer_size(buf));
+	teardown();
+
+	/* The parser resynchronizes on the next good message. */
+	memcpy(data + len, order, len);
+
+	setup(data, 2 * len, 4096);
+	assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, FIX_PARSE_FLAG_ONE_PASS));
+	assert_int_equals(11, msg->nr_fields);
+	assert_int_equals(0, buffer_size(buf));
+	teardown();
+}
+
+/* Wrap 'body' in a header and trailer with the right BodyLength and CheckSum. */
+static size_t frame(char *dst, const char *body)
+{
+	size_t len;
+
+	len = sprintf(dst, "8=FIX.4.2\0019=%zu\001%s", strlen(body), body);
+
+	return len + sprintf(dst + len, "10=%03u\001", buffer_sum_range(dst, dst + len));
+}
+
+void test_fix_message_get_field(void)
+{
+	struct fix_field field;
+	char data[512];
+	size_t len;
+
+	len = frame(data, "35=D\00134=7\00155=A\00155=B\0015000=x\0015000=y\00144=1.5\001");
+
+	setup(data, len, 4096);
+
+	assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, 0));
+
+	/* Repeated tags resolve to their first occurrence. */
+	assert_str_equals("A", fix_get_field(msg, Symbol)->string_value, 1);
+	assert_str_equals("x", fix_get_field(msg, 5000)->string_value, 1);
+	assert_int_equals(150, fix_get_float(msg, Price, 0) * 100);
+
+	assert_true(fix_get_field(msg, TargetCompID) == NULL);
+	assert_true(fix_get_field(msg, 6000) == NULL);
+	assert_true(fix_get_field(msg, -1) == NULL);
+
+	/* Fields added after parsing are still found. */
+	field = FIX_STRING_FIELD(TargetCompID, "SELLSIDE");
+	fix_message_add_field(msg, &field);
+
+	assert_str_equals("SELLSIDE", fix_get_field(msg, TargetCompID)->string_value, 8);
+
+	teardown();
+
+	/* A failed parse leaves nothing to look up. */
+	setup(data, len - 1, 4096);
+
+	assert_int_equals(-1, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, 0));
+	assert_true(fix_get_field(msg, Symbol) == NULL);
+
+	teardown();
+}
+
+void test_fix_message_get_field_many_tags(void)
+{
+	char body[512], data[600];
+	size_t len = 0;
+	int i;
+
+	len += sprintf(body, "35=D\001");
+
+	/* More large tags than the hash takes */
+	for (i = 0; i < 40; i++)
+		len += sprintf(body + len, "%d=%c\001", 2000 + i * 7, 'a' + i % 26);
+
+	len = frame(data, body);
+
+	setup(data, len, 4096);
+
+	assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, FIX_PARSE_FLAG_ONE_PASS));
+	assert_int_equals(40, msg->nr_fields);
+
+	for (i = 0; i < 40; i++)
+		assert_int_equals('a' + i % 26, fix_get_field(msg, 2000 + i * 7)->string_value[0]);
+
+	assert_true(fix_get_field(msg, 2001) == NULL);
+
+	teardown();
+}
+
+void test_fix_message_parse_lazy(void)
+{
+	struct fix_field *field;
+	char data[512];
+	size_t len;
+
+	len = frame(data, "35=8\00134=3\00111=ORD-1\00138=100\001103=7\00144=12.5\001");
+
+	setup(data, len, 4096);
+
+	assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, FIX_PARSE_FLAG_LAZY));
+	assert_int_equals(4, msg->nr_fields);
+	assert_int_equals(3, msg->msg_seq_num);
+
+	/* Numbers stay as text until they are asked for. */
+	assert_true(msg->fields[1].lazy);
+	assert_str_equals("100", msg->fields[1].string_value, msg->fields[1].value_len);
+	assert_int_equals(3, msg->fields[1].value_len);
+	assert_false(msg->fields[0].lazy);
+	assert_int_equals(5, msg->fields[0].value_len);
+
+	assert_int_equals(7, fix_get_int(msg, OrdRejReason, 0));
+	assert_int_equals(1250, fix_get_float(msg, Price, 0) * 100);
+
+	field = fix_get_field(msg, OrderQty);
+	assert_false(field->lazy);
+	assert_int_equals(FIX_TYPE_FLOAT, field->type);
+	assert_int_equals(100, field->float_value);
+
+	/* The converted value is cached. */
+	assert_int_equals(100, fix_get_float(msg, OrderQty, 0));
+
+	teardown();
+}
+
+static void assert_decimal(const char *s, int64_t mantissa, int exponent, const char *formatted)
+{
+	struct fix_decimal value;
+	const char *end = NULL;
+	char out[64];
+	int len;
+
+	value = fix_decimal_parse(s, &end);
+
+	assert_int_equals(mantissa, value.mantissa);
+	assert_int_equals(exponent, value.exponent);
+	assert_true(end == s + strlen(s));
+
+	len = fix_decimal_unparse(value, out);
+
+	assert_int_equals(strlen(formatted), len);
+	assert_str_equals(formatted, out, len);
+}
+
+void test_fix_decimal_parse(void)
+{
+	assert_decimal("12.50", 1250, -2, "12.50");
+	assert_decimal("-12.5", -125, -1, "-12.5");
+	assert_decimal("0.005", 5, -3, "0.005");
+	assert_decimal("-0.25", -25, -2, "-0.25");
+	assert_decimal("100", 100, 0, "100");
+	assert_decimal("100.", 100, 0, "100");
+	assert_decimal(".5", 5, -1, "0.5");
+	assert_decimal("0", 0, 0, "0");
+	assert_decimal("0.000", 0, -3, "0.000");
+	assert_decimal("9223372036854775.807", 922337203685477580LL, -2, "9223372036854775.80");
+	assert_decimal("12345678901234567890", 123456789012345678LL, 2, "12345678901234567800");
+}
+
+static enum fix_type decimal_tag_type(int tag)
+{
+	switch (tag) {
+	case Price:	return FIX_TYPE_DECIMAL;
+	default:	return fix_dialects[FIX_4_2].tag_type(tag);
+	}
+}
+
+void test_fix_message_parse_decimal(void)
+{
+	struct fix_dialect dialect = { FIX_4_2, decimal_tag_type };
+	struct fix_decimal price, none = { -1, 0 };
+	unsigned long flags[] = { 0, FIX_PARSE_FLAG_LAZY };
+	char data[512];
+	unsigned int i;
+	size_t len;
+
+	len = frame(data, "35=8\00134=3\00111=ORD-1\00144=101.0025\001");
+
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		setup(data, len, 4096);
+
+		assert_int_equals(0, fix_message_parse(msg, &dialect, buf, flags[i]));
+
+		price = fix_get_decimal(msg, Price, none);
+		assert_int_equals(1010025, price.mantissa);
+		assert_int_equals(-4, price.exponent);
+
+		/* Converted, not read from the wrong member */
+		assert_true(fix_get_float(msg, Price, 0) == 101.0025);
+
+		price = fix_get_decimal(msg, OrderQty, none);
+		assert_int_equals(-1, price.mantissa);
+
+		teardown();
+	}
+
+	assert_true(fix_decimal_to_double((struct fix_decimal) { -375, -2 }) == -3.75);
+	assert_true(fix_decimal_to_double((struct fix_decimal) { 42, 3 }) == 42000.0);
+}
+
+void test_fix_message_parse_groups(void)
+{
+	unsigned long flags[] = { 0, FIX_PARSE_FLAG_ONE_PASS | FIX_PARSE_FLAG_LAZY };
+	struct fix_field *fields, *field;
+	unsigned long nr_fields = 0;
+	struct fix_group *group;
+	char data[512];
+	unsigned int i;
+	size_t len;
+
+	len = frame(data, "35=X\00134=4\001262=REQ-1\001268=3\001"
+			  "279=0\001269=0\001270=12.5\001271=100\001"
+			  "279=1\001269=1\001270=12.75\001"
+			  "279=2\001269=0\001270=12.25\001271=300\001"
+			  "58=done\001");
+
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		setup(data, len, 4096);
+
+		assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, flags[i]));
+		assert_int_equals(1, msg->nr_groups);
+		assert_int_equals(14, msg->nr_fields);
+
+		group = fix_get_group(msg, NoMDEntries);
+		assert_true(group != NULL);
+		assert_int_equals(3, group->count);
+		assert_int_equals(3, group->nr_entries);
+		assert_int_equals(13, group->end);
+
+		fields = fix_group_entry(msg, group, 1, &nr_fields);
+		assert_true(fields == &msg->fields[6]);
+		assert_int_equals(3, nr_fields);
+		assert_int_equals(MDUpdateAction, fields[0].tag);
+
+		/* The middle entry has no MDEntrySize. */
+		assert_true(fix_group_get_field(msg, group, 1, MDEntrySize) == NULL);
+
+		field = fix_group_get_field(msg, group, 2, MDEntrySize);
+		assert_true(field != NULL);
+		assert_int_equals(300, field->float_value);
+
+		field = fix_group_get_field(msg, group, 0, MDEntryPx);
+		assert_int_equals(1250, field->float_value * 100);
+
+		assert_true(fix_group_entry(msg, group, 3, &nr_fields) == NULL);
+
+		/* The field after the group is not part of the last entry. */
+		fields = fix_group_entry(msg, group, 2, &nr_fields);
+		assert_int_equals(4, nr_fields);
+		assert_str_equals("done", fix_get_field(msg, Text)->string_value, 4);
+
+		teardown();
+	}
+}
+
+void test_fix_message_parse_groups_short_count(void)
+{
+	struct fix_group *group;
+	char data[512];
+	size_t len;
+
+	/* NumInGroup says one entry: the second one is left out of the group. */
+	len = frame(data, "35=X\00134=4\001268=1\001279=0\001270=12.5\001279=1\001270=13\001");
+
+	setup(data, len, 4096);
+
+	assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, 0));
+
+	group = fix_get_group(msg, NoMDEntries);
+	assert_true(group != NULL);
+	assert_int_equals(1, group->nr_entries);
+	assert_int_equals(3, group->end);
+
+	teardown();
+
+	len = frame(data, "35=X\00134=4\001268=0\00158=empty\001");
+
+	setup(data, len, 4096);
+
+	assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, 0));
+
+	group = fix_get_group(msg, NoMDEntries);
+	assert_true(group != NULL);
+	assert_int_equals(0, group->nr_entries);
+	assert_int_equals(1, group->end);
+
+	teardown();
+}
+
+void test_fix_message_parse_many_fields(void)
+{
+	unsigned long flags[] = { 0, FIX_PARSE_FLAG_ONE_PASS | FIX_PARSE_FLAG_LAZY };
+	struct fix_field field;
+	char data[FIX_MAX_MESSAGE_SIZE + 64];
+	char body[FIX_MAX_MESSAGE_SIZE];
+	unsigned int i;
+	size_t len;
+	int n;
+
+	/* Well past FIX_MAX_FIELD_NUMBER */
+	n = sprintf(body, "35=d\00134=5\001");
+	for (i = 0; i < 150; i++)
+		n += sprintf(body + n, "%u=%u\001", 5000 + i, i % 10);
+
+	len = frame(data, body);
+
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		setup(data, len, 4096);
+
+		assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, flags[i]));
+		assert_int_equals(150, msg->nr_fields);
+		assert_str_equals("7", fix_get_field(msg, 5147)->string_value, 1);
+
+		/* Adding fields grows the parsed ones. */
+		field = FIX_INT_FIELD(6000, 42);
+		while (msg->nr_fields < 1000)
+			fix_message_add_field(msg, &field);
+
+		assert_int_equals(1000, msg->nr_fields);
+		assert_str_equals("7", fix_get_field(msg, 5147)->string_value, 1);
+		assert_int_equals(42, fix_get_int(msg, 6000, 0));
+
+		fix_message_reset(msg);
+		assert_int_equals(0, msg->nr_fields);
+		assert_true(fix_get_field(msg, 5147) == NULL);
+
+		fix_message_add_field(msg, &field);
+		assert_int_equals(42, fix_get_int(msg, 6000, 0));
+
+		teardown();
+	}
+}
+
+void test_fix_message_caller_fields(void)
+{
+	unsigned long flags[] = { 0, FIX_PARSE_FLAG_ONE_PASS };
+	struct fix_field fields[FIX_MAX_FIELD_NUMBER];
+	struct fix_field field = FIX_INT_FIELD(6000, 42);
+	struct fix_message hand;
+	char data[FIX_MAX_MESSAGE_SIZE + 64];
+	char body[FIX_MAX_MESSAGE_SIZE];
+	unsigned int i;
+	size_t len;
+	int n;
+
+	/* A message built by hand, with a group but nowhere to record it */
+	n = sprintf(body, "35=X34=4268=1279=0270=12.5");
+	for (i = 0; i < 60; i++)
+		n += sprintf(body + n, "%u=%u", 5000 + i, i % 10);
+
+	len = frame(data, body);
+
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		setup(data, len, 4096);
+
+		memset(&hand, 0, sizeof(hand));
+		hand.fields = fields;
+
+		/* Fields past the end of the caller's array are skipped. */
+		assert_int_equals(0, fix_message_parse(&hand, &fix_dialects[FIX_4_2], buf, flags[i]));
+		assert_true(hand.fields == fields);
+		assert_int_equals(FIX_MAX_FIELD_NUMBER, hand.nr_fields);
+		assert_int_equals(0, hand.nr_groups);
+		assert_int_equals(0, buffer_size(buf));
+		assert_int_equals(5044, fields[FIX_MAX_FIELD_NUMBER - 1].tag);
+
+		teardown();
+	}
+
+	/* An arena gives the parser room for group entries, still no groups array */
+	setup(data, len, 4096);
+
+	memset(&hand, 0, sizeof(hand));
+	hand.fields	= fields;
+	hand.arena	= arena_new(4096);
+
+	assert_int_equals(0, fix_message_parse(&hand, &fix_dialects[FIX_4_2], buf, 0));
+	assert_int_equals(0, hand.nr_groups);
+	assert_int_equals(268, fields[0].tag);
+
+	arena_delete(hand.arena);
+	teardown();
+
+	/* A fields array set on a message from fix_message_new() */
+	setup(order, strlen(order), 4096);
+
+	msg->fields	= calloc(FIX_MAX_FIELD_NUMBER, sizeof(struct fix_field));
+	msg->fields[0]	= FIX_STRING_FIELD(ClOrdID, "ORD-2");
+	msg->nr_fields	= 1;
+
+	fix_message_add_field(msg, &field);
+	assert_int_equals(2, msg->nr_fields);
+	assert_int_equals(6000, msg->fields[1].tag);
+
+	while (msg->nr_fields < FIX_MAX_FIELD_NUMBER)
+		fix_message_add_field(msg, &field);
+	fix_message_add_field(msg, &field);
+	assert_int_equals(FIX_MAX_FIELD_NUMBER, msg->nr_fields);
+
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		struct fix_field *own = msg->fields;
+
+		buffer_reset(buf);
+		memcpy(buffer_end(buf), order, strlen(order));
+		buffer_advance_end(buf, strlen(order));
+
+		assert_int_equals(0, fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, flags[i]));
+		assert_true(msg->fields == own);
+		assert_int_equals(11, msg->nr_fields);
+		assert_str_equals("ORD-1", fix_get_field(msg, ClOrdID)->string_value, 5);
+	}
+
+	/* The array is freed together with the message. */
+	teardown();
+}
+
+/* A dialect's generated parser must agree with the generic one. */
+void test_fix_message_parse_dialect(void)
+{
+	unsigned long flags[] = { 0, FIX_PARSE_FLAG_ONE_PASS, FIX_PARSE_FLAG_ONE_PASS | FIX_PARSE_FLAG_LAZY };
+	struct fix_dialect generic = micex_fix_dialect;
+	struct fix_field *field, *expected;
+	struct fix_message *generic_msg;
+	struct fix_group *group;
+	char data[512];
+	unsigned int i;
+	unsigned long j;
+	size_t len;
+
+	generic.parse_body = NULL;
+
+	len = frame(data, "35=8\00134=7\00111=ORD-1\00138=100\00144=12.5\001"
+			  "453=2\001448=FIRM\001447=D\001452=1\001448=TRADER\001447=D\001452=12\001"
+			  "58=filled\001");
+
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		setup(data, len, 4096);
+		generic_msg = fix_message_new();
+
+		assert_int_equals(0, fix_message_parse(msg, &micex_fix_dialect, buf, flags[i]));
+
+		buf->start = 0;
+		assert_int_equals(0, fix_message_parse(generic_msg, &generic, buf, flags[i]));
+
+		assert_int_equals(7, msg->msg_seq_num);
+		assert_int_equals(11, msg->nr_fields);
+		assert_int_equals(generic_msg->nr_fields, msg->nr_fields);
+		assert_int_equals(generic_msg->nr_groups, msg->nr_groups);
+
+		for (j = 0; j < msg->nr_fields; j++) {
+			field		= &msg->fields[j];
+			expected	= &generic_msg->fields[j];
+
+			assert_int_equals(expected->tag, field->tag);
+			assert_int_equals(expected->type, field->type);
+			assert_int_equals(expected->value_len, field->value_len);
+			assert_int_equals(expected->lazy, field->lazy);
+
+			if (field->lazy || field->type == FIX_TYPE_STRING)
+				assert_true(expected->string_value == field->string_value);
+			else if (field->type == FIX_TYPE_FLOAT)
+				assert_true(expected->float_value == field->float_value);
+			else
+				assert_int_equals(expected->int_value, field->int_value);
+		}
+
+		group = fix_get_group(msg, MICEX_TAG_NoPartyID);
+		assert_true(group != NULL);
+		assert_int_equals(2, group->nr_entries);
+		assert_int_equals(12, fix_group_get_field(msg, group, 1, MICEX_TAG_PartyRole)->int_value);
+
+		fix_message_free(generic_msg);
+		teardown();
+	}
+}
+
+void test_fix_message_parse_layout(void)
+{
+	unsigned long flags[] = { 0, FIX_PARSE_FLAG_ONE_PASS | FIX_PARSE_FLAG_LAZY };
+	struct micex_new_order_single new_order;
+	struct micex_execution_report report;
+	char data[512];
+	unsigned int i;
+	size_t len;
+
+	len = frame(data, "35=8\00134=7\00137=OID-1\00111=ORD-1\001453=1\001448=FIRM\001"
+			  "150=F\00139=1\00154=1\00138=100\00144=12.5\00114=40\00158=partial\00114=99\001");
+
+	for (i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+		setup(data, len, 4096);
+
+		assert_int_equals(0, fix_message_parse(msg, &micex_fix_dialect, buf, flags[i]));
+
+		assert_int_equals(0, micex_execution_report_parse(&report, msg));
+		assert_true(report.present & MICEX_EXECUTION_REPORT_CL_ORD_ID);
+		assert_str_equals("ORD-1", report.cl_ord_id, 5);
+		assert_int_equals(5, report.cl_ord_id_len);
+		assert_int_equals(1, report.no_party_id);
+		assert_int_equals('F', report.exec_type[0]);
+		assert_int_equals('1', report.ord_status[0]);
+		assert_int_equals(100, report.order_qty);
+		assert_int_equals(1250, report.price * 100);
+
+		/* The first occurrence counts, as with fix_get_field(). */
+		assert_int_equals(40, report.cum_qty);
+
+		assert_false(report.present & MICEX_EXECUTION_REPORT_LEAVES_QTY);
+		assert_false(report.present & MICEX_EXECUTION_REPORT_EXEC_ID);
+
+		/* Not a NewOrderSingle */
+		assert_int_equals(-1, micex_new_order_single_parse(&new_order, msg));
+
+		teardown();
+	}
+}
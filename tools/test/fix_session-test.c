@@ -0,0 +1,462 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/proto/fix_session.h"
+#include "libtrading/read-write.h"
+#include "libtrading/buffer.h"
+
+#include "fix/fix_common.h"
+
+#include <sys/socket.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+
+static struct fix_session_cfg	session_cfg;	/* the session points to its CompIDs */
+static struct fix_session	*session;
+static struct fix_session_cfg	peer_cfg;
+static struct fix_session	*peer;
+static int			sv[2];
+
+static void setup(unsigned long tx_ring_size)
+{
+	fix_session_cfg_init(&session_cfg);
+
+	socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+
+	session_cfg.dialect	= &fix_dialects[FIX_4_2];
+	session_cfg.sockfd	= sv[0];
+	session_cfg.tx_ring_size = tx_ring_size;
+
+	session = fix_session_new(&session_cfg);
+}
+
+static void teardown(void)
+{
+	fix_session_free(peer);
+	peer = NULL;
+
+	fix_session_free(session);
+	close(sv[0]);
+	close(sv[1]);
+}
+
+/* Format a message from the peer with sequence number 'seq' into 'dst'. */
+static size_t peer_message(char *dst, const char *msg_type, unsigned long seq, const char *fields)
+{
+	char body[128];
+	size_t len;
+
+	sprintf(body, "35=%s\00134=%lu\00149=SELLSIDE\00156=BUYSIDE\001%s", msg_type, seq, fields);
+
+	len = sprintf(dst, "8=FIX.4.2\0019=%zu\001%s", strlen(body), body);
+
+	return len + sprintf(dst + len, "10=%03u\001", buffer_sum_range(dst, dst + len));
+}
+
+static size_t execution_report(char *dst, unsigned long seq)
+{
+	char fields[32];
+
+	sprintf(fields, "37=ORD-%lu\001", seq);
+
+	return peer_message(dst, "8", seq, fields);
+}
+
+void test_fix_session_recv_batch(void)
+{
+	struct fix_message *msgs[4];
+	struct fix_field *field;
+	char data[1024];
+	size_t len = 0;
+	unsigned long i;
+	size_t last;
+
+	setup(0);
+
+	for (i = 0; i < 4; i++)
+		msgs[i] = fix_message_new();
+
+	for (i = 1; i <= 4; i++)
+		len += execution_report(data + len, i);
+
+	/* The fourth message is cut short. */
+	last = execution_report(data + 512, 4);
+
+	assert_int_equals(len - 10, write(sv[1], data, len - 10));
+
+	assert_int_equals(3, fix_session_recv_batch(session, msgs, 4, FIX_RECV_FLAG_MSG_DONTWAIT));
+	assert_int_equals(0, session->in_msg_seq_num);
+
+	for (i = 0; i < 3; i++) {
+		assert_int_equals(0, fix_session_consume(session));
+		assert_true(fix_msg_expected(session, msgs[i]));
+
+		assert_int_equals(i + 1, msgs[i]->msg_seq_num);
+		assert_true(fix_message_type_is(msgs[i], FIX_MSG_TYPE_EXECUTION_REPORT));
+
+		field = fix_get_field(msgs[i], OrderID);
+		assert_true(field != NULL);
+		assert_int_equals('1' + i, field ? field->string_value[4] : 0);
+	}
+
+	/* Nothing left to parse and nothing to read */
+	assert_int_equals(-1, fix_session_recv_batch(session, msgs, 4, FIX_RECV_FLAG_MSG_DONTWAIT));
+	assert_int_equals(FIX_FAILURE_SYSTEM, session->failure_reason);
+	assert_int_equals(EAGAIN, errno);
+
+	/* Data that doesn't complete the message */
+	assert_int_equals(5, write(sv[1], data + 512 + last - 10, 5));
+	assert_int_equals(0, fix_session_recv_batch(session, msgs, 4, FIX_RECV_FLAG_MSG_DONTWAIT));
+
+	assert_int_equals(5, write(sv[1], data + 512 + last - 5, 5));
+
+	assert_int_equals(1, fix_session_recv_batch(session, msgs, 4, FIX_RECV_FLAG_MSG_DONTWAIT));
+	assert_int_equals(4, msgs[0]->msg_seq_num);
+	assert_int_equals(0, fix_session_consume(session));
+	assert_int_equals(4, session->in_msg_seq_num);
+
+	for (i = 0; i < 4; i++)
+		fix_message_free(msgs[i]);
+
+	teardown();
+}
+
+/*
+ * Receive whatever the session has sent so far on the peer's end. The
+ * messages point into the peer's rx buffer, so it lives until teardown().
+ */
+static int recv_peer(struct fix_message **msgs, unsigned long nr)
+{
+	if (!peer) {
+		fix_session_cfg_init(&peer_cfg);
+
+		peer_cfg.dialect	= &fix_dialects[FIX_4_2];
+		peer_cfg.sockfd		= sv[1];
+
+		peer = fix_session_new(&peer_cfg);
+	}
+
+	return fix_session_recv_batch(peer, msgs, nr, FIX_RECV_FLAG_MSG_DONTWAIT);
+}
+
+/* Session level messages in one batch are all in sequence for fix_session_admin(). */
+void test_fix_session_recv_batch_admin(void)
+{
+	struct fix_message *msgs[4];
+	char data[1024];
+	size_t len = 0;
+	unsigned long i;
+
+	setup(0);
+
+	for (i = 0; i < 4; i++)
+		msgs[i] = fix_message_new();
+
+	len += peer_message(data + len, "0", 1, "");
+	len += peer_message(data + len, "1", 2, "112=PING\001");
+	len += peer_message(data + len, "0", 3, "");
+	len += execution_report(data + len, 4);
+
+	assert_int_equals(len, write(sv[1], data, len));
+
+	assert_int_equals(4, fix_session_recv_batch(session, msgs, 4, FIX_RECV_FLAG_MSG_DONTWAIT));
+
+	for (i = 0; i < 3; i++) {
+		assert_int_equals(0, fix_session_consume(session));
+		assert_true(fix_session_admin(session, msgs[i]));
+	}
+
+	assert_int_equals(0, fix_session_consume(session));
+	assert_false(fix_session_admin(session, msgs[3]));
+
+	assert_int_equals(4, session->in_msg_seq_num);
+
+	/* The TestRequest was answered and nothing was logged out. */
+	assert_int_equals(1, recv_peer(msgs, 4));
+	assert_true(fix_message_type_is(msgs[0], FIX_MSG_TYPE_HEARTBEAT));
+	assert_str_equals("PING", fix_get_field(msgs[0], TestReqID)->string_value, 4);
+
+	for (i = 0; i < 4; i++)
+		fix_message_free(msgs[i]);
+
+	teardown();
+}
+
+void test_fix_session_send_cork(void)
+{
+	struct fix_message heartbeat = { .type = FIX_MSG_TYPE_HEARTBEAT };
+	struct fix_message *msgs[4];
+	unsigned long i;
+
+	setup(3);
+
+	for (i = 0; i < 4; i++)
+		msgs[i] = fix_message_new();
+
+	assert_int_equals(0, fix_session_send(session, &heartbeat, FIX_SEND_FLAG_CORK));
+	assert_int_equals(0, fix_session_send(session, &heartbeat, FIX_SEND_FLAG_CORK));
+	assert_int_equals(2, session->nr_tx_queued);
+	assert_int_equals(-1, recv_peer(msgs, 4));
+
+	/* An uncorked message goes out after the queued ones. */
+	assert_int_equals(0, fix_session_send(session, &heartbeat, 0));
+	assert_int_equals(0, session->nr_tx_queued);
+	assert_int_equals(3, recv_peer(msgs, 4));
+
+	for (i = 0; i < 3; i++) {
+		assert_int_equals(i + 1, msgs[i]->msg_seq_num);
+		assert_true(fix_message_type_is(msgs[i], FIX_MSG_TYPE_HEARTBEAT));
+	}
+
+	/* A full ring flushes itself. */
+	for (i = 0; i < 3; i++)
+		assert_int_equals(0, fix_session_send(session, &heartbeat, FIX_SEND_FLAG_CORK));
+	assert_int_equals(0, session->nr_tx_queued);
+
+	assert_int_equals(0, fix_session_send(session, &heartbeat, FIX_SEND_FLAG_CORK));
+	assert_int_equals(0, fix_session_flush(session));
+	assert_int_equals(0, fix_session_flush(session));
+
+	assert_int_equals(4, recv_peer(msgs, 4));
+
+	for (i = 0; i < 4; i++)
+		assert_int_equals(i + 4, msgs[i]->msg_seq_num);
+
+	for (i = 0; i < 4; i++)
+		fix_message_free(msgs[i]);
+
+	teardown();
+}
+
+static size_t			send_max;
+
+/* Send at most 'send_max' bytes, fail with EAGAIN if it's zero. */
+static ssize_t short_sendmsg(int fd, struct iovec *iov, size_t length, int flags)
+{
+	char buf[256];
+	size_t len = 0;
+	size_t i;
+
+	if (!send_max) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	for (i = 0; i < length && len < send_max; i++) {
+		size_t n = iov[i].iov_len < send_max - len ? iov[i].iov_len : send_max - len;
+
+		memcpy(buf + len, iov[i].iov_base, n);
+		len += n;
+	}
+
+	return send(fd, buf, len, flags);
+}
+
+void test_fix_session_flush_short(void)
+{
+	struct fix_message heartbeat = { .type = FIX_MSG_TYPE_HEARTBEAT };
+	struct fix_message *msgs[4];
+	unsigned long i;
+	int ret;
+
+	setup(4);
+
+	for (i = 0; i < 4; i++)
+		msgs[i] = fix_message_new();
+
+	io_sendmsg = short_sendmsg;
+	send_max = 40;
+
+	for (i = 0; i < 3; i++)
+		assert_int_equals(0, fix_session_send(session, &heartbeat, FIX_SEND_FLAG_CORK));
+
+	/* The rest of the batch stays queued. */
+	assert_true(fix_session_flush(session) > 0);
+	assert_int_equals(3, session->nr_tx_queued);
+
+	send_max = 0;
+	assert_int_equals(-1, fix_session_flush(session));
+	assert_int_equals(3, session->nr_tx_queued);
+
+	send_max = 40;
+	assert_true(fix_session_send(session, &heartbeat, FIX_SEND_FLAG_CORK) > 0);
+	assert_int_equals(4, session->nr_tx_queued);
+
+	/* A full ring refuses messages without using up a MsgSeqNum. */
+	assert_int_equals(-1, fix_session_send(session, &heartbeat, 0));
+	assert_int_equals(EAGAIN, errno);
+	assert_int_equals(5, session->out_msg_seq_num);
+
+	while ((ret = fix_session_flush(session)) > 0)
+		;
+	assert_int_equals(0, ret);
+	assert_int_equals(0, session->nr_tx_queued);
+
+	io_sendmsg = sys_sendmsg;
+
+	assert_int_equals(4, recv_peer(msgs, 4));
+
+	for (i = 0; i < 4; i++) {
+		assert_int_equals(i + 1, msgs[i]->msg_seq_num);
+		assert_true(fix_message_type_is(msgs[i], FIX_MSG_TYPE_HEARTBEAT));
+	}
+
+	assert_int_equals(0, fix_session_send(session, &heartbeat, 0));
+	assert_int_equals(1, recv_peer(msgs, 4));
+	assert_int_equals(5, msgs[0]->msg_seq_num);
+
+	for (i = 0; i < 4; i++)
+		fix_message_free(msgs[i]);
+
+	teardown();
+}
+
+void test_fix_session_resend(void)
+{
+	struct fix_field fields[] = { FIX_STRING_FIELD(ClOrdID, "ORD-1") };
+	struct fix_message order = {
+		.type		= FIX_MSG_TYPE_NEW_ORDER_SINGLE,
+		.nr_fields	= 1,
+		.fields		= fields,
+	};
+	struct fix_message heartbeat = { .type = FIX_MSG_TYPE_HEARTBEAT };
+	char path[] = "/tmp/fix_session-test-XXXXXX";
+	struct fix_journal_cfg cfg;
+	struct fix_message *msgs[4];
+	struct fix_field *field;
+	const char *msg;
+	unsigned long i;
+	size_t len;
+
+	setup(0);
+
+	for (i = 0; i < 4; i++)
+		msgs[i] = fix_message_new();
+
+	close(mkstemp(path));
+
+	fix_journal_cfg_init(&cfg);
+	cfg.path	 = path;
+	cfg.size	 = 4096;
+	cfg.max_msgs	 = 16;
+
+	session->journal = fix_journal_new(&cfg);
+	assert_true(session->journal != NULL);
+
+	assert_int_equals(0, fix_session_send(session, &order, 0));
+	assert_int_equals(0, fix_session_send(session, &heartbeat, 0));
+	assert_int_equals(0, fix_session_send(session, &order, 0));
+	assert_int_equals(3, recv_peer(msgs, 4));
+
+	/* The orders are replayed, the heartbeat is gap filled. */
+	assert_int_equals(0, fix_session_resend(session, 1, 0));
+	assert_int_equals(3, recv_peer(msgs, 4));
+	assert_int_equals(4, session->out_msg_seq_num);
+
+	for (i = 0; i < 3; i++) {
+		assert_int_equals(i + 1, msgs[i]->msg_seq_num);
+
+		field = fix_get_field(msgs[i], PossDupFlag);
+		assert_true(field != NULL);
+		assert_str_equals("Y", field->string_value, 1);
+	}
+
+	assert_true(fix_message_type_is(msgs[0], FIX_MSG_TYPE_NEW_ORDER_SINGLE));
+	assert_true(fix_get_field(msgs[0], OrigSendingTime) != NULL);
+
+	field = fix_get_field(msgs[0], ClOrdID);
+	assert_true(field != NULL);
+	assert_str_equals("ORD-1", field->string_value, 5);
+
+	assert_true(fix_message_type_is(msgs[1], FIX_MSG_TYPE_SEQUENCE_RESET));
+
+	field = fix_get_field(msgs[1], NewSeqNo);
+	assert_true(field != NULL);
+	assert_int_equals(3, field->int_value);
+
+	assert_true(fix_message_type_is(msgs[2], FIX_MSG_TYPE_NEW_ORDER_SINGLE));
+
+	/* Replayed messages and gap fills are not journaled again. */
+	assert_true(fix_journal_get(session->journal, 1, &len) != NULL);
+	assert_true(fix_journal_get(session->journal, 3, &len) != NULL);
+
+	/* No room for it in the journal */
+	session->out_msg_seq_num = 100;
+	assert_int_equals(0, fix_session_send(session, &order, 0));
+	assert_int_equals(1, session->nr_journal_errors);
+
+	/* Sequence numbers that start over empty the journal. */
+	session->out_msg_seq_num = 1;
+	assert_int_equals(0, fix_session_send(session, &heartbeat, 0));
+	assert_int_equals(1, session->nr_journal_errors);
+	assert_true(fix_journal_get(session->journal, 3, &len) == NULL);
+
+	msg = fix_journal_get(session->journal, 1, &len);
+	assert_true(msg != NULL);
+	assert_true(memmem(msg, len, "\00135=0\001", 6) != NULL);
+
+	for (i = 0; i < 4; i++)
+		fix_message_free(msgs[i]);
+
+	fix_journal_free(session->journal);
+	unlink(path);
+
+	teardown();
+}
+
+void test_fix_session_state(void)
+{
+	struct fix_message heartbeat = { .type = FIX_MSG_TYPE_HEARTBEAT };
+	char path[] = "/tmp/fix_session-test-XXXXXX";
+	struct fix_session_cfg cfg;
+	struct fix_message *msg;
+	char data[256];
+	size_t len;
+
+	close(mkstemp(path));
+	unlink(path);
+
+	socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+
+	fix_session_cfg_init(&cfg);
+
+	cfg.dialect		= &fix_dialects[FIX_4_2];
+	cfg.sockfd		= sv[0];
+	cfg.state_path		= path;
+	cfg.state_sync		= FIX_STATE_SYNC_SEND;
+	cfg.out_msg_seq_num	= 10;
+
+	session = fix_session_new(&cfg);
+	assert_true(session != NULL);
+
+	assert_int_equals(0, fix_session_send(session, &heartbeat, 0));
+	assert_int_equals(0, fix_session_send(session, &heartbeat, 0));
+
+	len = execution_report(data, 1);
+	assert_int_equals(len, write(sv[1], data, len));
+	assert_true(fix_session_recv(session, &msg, FIX_RECV_FLAG_MSG_DONTWAIT) > 0);
+
+	assert_int_equals(1, session->state->in_msg_seq_num);
+	assert_int_equals(12, session->state->out_msg_seq_num);
+
+	/* As SequenceReset would */
+	assert_int_equals(0, fix_session_set_in_msg_seq_num(session, 7));
+	assert_int_equals(7, session->state->in_msg_seq_num);
+
+	fix_session_free(session);
+
+	/* The file wins over the configuration. */
+	cfg.out_msg_seq_num	= 1;
+
+	session = fix_session_new(&cfg);
+	assert_true(session != NULL);
+
+	assert_int_equals(7, session->in_msg_seq_num);
+	assert_int_equals(12, session->out_msg_seq_num);
+
+	unlink(path);
+
+	teardown();
+}
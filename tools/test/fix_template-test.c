@@ -0,0 +1,112 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/proto/fix_template.h"
+#include "libtrading/proto/fix_message.h"
+#include "libtrading/buffer.h"
+
+#include <string.h>
+
+static struct fix_template *new_order_single_template(void)
+{
+	struct fix_template_cfg cfg;
+	struct fix_template *template;
+
+	template = fix_template_new();
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.begin_string	= "FIX.4.2";
+	cfg.sender_comp_id	= "BUYSIDE";
+	cfg.target_comp_id	= "SELLSIDE";
+	cfg.const_fields[cfg.nr_const_fields++] = FIX_STRING_FIELD(Symbol, "ES");
+	cfg.const_fields[cfg.nr_const_fields++] = FIX_CHAR_FIELD(OrdType, '2');
+	fix_template_cfg_new_order_single(&cfg, 4);
+	fix_template_prepare(template, &cfg);
+
+	fix_template_update_time(template, &(struct timespec) { 1356607243, 0 });
+
+	return template;
+}
+
+static int parse_template(struct fix_template *template, struct fix_message *msg, struct buffer *buf)
+{
+	buffer_reset(buf);
+	buffer_printf(buf, "%.*s", (int) buffer_size(&template->buf), buffer_start(&template->buf));
+
+	return fix_message_parse(msg, &fix_dialects[FIX_4_2], buf, 0);
+}
+
+void test_fix_template_set_field(void)
+{
+	struct fix_template *template;
+	struct fix_session session;
+	struct fix_message *msg;
+	struct buffer *buf;
+	struct fix_field *field;
+
+	template = new_order_single_template();
+	msg = fix_message_new();
+	buf = buffer_new(1024);
+
+	session.sender_comp_id = "BUYSIDE";
+	session.out_msg_seq_num = 1;
+
+	fix_template_unparse(template, &session);
+	assert_int_equals(0, parse_template(template, msg, buf));
+
+	assert_int_equals(0, fix_template_set_field(template, &FIX_STRING_FIELD(ClOrdID, "A001")));
+	assert_int_equals(0, fix_template_set_field(template, &FIX_CHAR_FIELD(Side, '2')));
+	assert_int_equals(0, fix_template_set_field(template, &FIX_FLOAT_FIELD(OrderQty, 25)));
+	assert_int_equals(0, fix_template_set_field(template, &FIX_FLOAT_FIELD(Price, -12.5)));
+
+	session.out_msg_seq_num = 2;
+	fix_template_unparse(template, &session);
+	assert_int_equals(0, parse_template(template, msg, buf));
+
+	assert_int_equals(2, msg->msg_seq_num);
+
+	field = fix_get_field(msg, ClOrdID);
+	assert_true(field != NULL);
+	assert_str_equals("A001", field->string_value, 4);
+
+	field = fix_get_field(msg, Side);
+	assert_true(field != NULL);
+	assert_str_equals("2", field->string_value, 1);
+
+	field = fix_get_field(msg, OrderQty);
+	assert_true(field != NULL);
+	assert_int_equals(FIX_TEMPLATE_QTY_WIDTH, field->value_len);
+	assert_true(field->float_value == 25);
+
+	field = fix_get_field(msg, Price);
+	assert_true(field != NULL);
+	assert_int_equals(FIX_TEMPLATE_PRICE_WIDTH, field->value_len);
+	assert_true(field->float_value == -12.5);
+
+	assert_true(memmem(buffer_start(&template->buf), buffer_size(&template->buf), "\00138=000000000025\00144=-0000000000012.5\001", 37) != NULL);
+
+	/* Values that don't fit leave the message as it was. */
+	assert_int_equals(-1, fix_template_set_field(template, &FIX_STRING_FIELD(ClOrdID, "A0001")));
+	assert_int_equals(-1, fix_template_set_field(template, &FIX_FLOAT_FIELD(OrderQty, 123456.1234567)));
+	assert_int_equals(-1, fix_template_set_field(template, &FIX_INT_FIELD(OrderQty, 1)));
+	assert_int_equals(-1, fix_template_set_field(template, &FIX_STRING_FIELD(Symbol, "NQ")));
+
+	/* A new timestamp keeps the checksum right as well. */
+	fix_template_update_time(template, &(struct timespec) { 1356607299, 999000000 });
+
+	session.out_msg_seq_num = 3;
+	fix_template_unparse(template, &session);
+	assert_int_equals(0, parse_template(template, msg, buf));
+
+	field = fix_get_field(msg, ClOrdID);
+	assert_true(field != NULL);
+	assert_str_equals("A001", field->string_value, 4);
+
+	field = fix_get_field(msg, TransactTime);
+	assert_true(field != NULL);
+	assert_str_equals("20121227-11:21:39.999", field->string_value, 21);
+
+	buffer_delete(buf);
+	fix_message_free(msg);
+	fix_template_free(template);
+}
@@ -0,0 +1,93 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/buffer.h"
+#include "libtrading/scan.h"
+#include "libtrading/cpu.h"
+
+#include <string.h>
+
+static const char *msg = "8=FIX.4.2\0019=65\00135=A\00134=1\00149=BUYSIDE\00152=20121227-11:20:43.000\00156=SELLSIDE\00198=0\001108=15\00110=071\001";
+
+void test_scan_byte(void)
+{
+	size_t len = strlen(msg);
+	const char *p;
+
+	p = scan_byte(msg, msg + len, 0x01);
+	assert_int_equals(9, p - msg);
+
+	p = scan_byte(msg, msg + len, '|');
+	assert_is_null(p);
+
+	/* A delimiter past the vector loop is found by the tail loop. */
+	p = scan_byte(msg + 70, msg + len, 0x01);
+	assert_str_equals("\001", p, 1);
+	assert_true(p < msg + len);
+}
+
+void test_scan_bitmap(void)
+{
+	u64 bitmap[SCAN_BITMAP_WORDS(128)];
+	size_t len = strlen(msg);
+	size_t i;
+
+	memset(bitmap, 0xff, sizeof(bitmap));
+
+	scan_bitmap(msg, len, 0x01, bitmap);
+
+	for (i = 0; i < 128; i++) {
+		bool bit = bitmap[i / 64] & (1ULL << (i % 64));
+
+		assert_int_equals(i < len && msg[i] == 0x01, bit);
+	}
+}
+
+/* Hide the vector extensions so the out-of-line kernels take the SWAR path. */
+void test_scan_bitmap_swar(void)
+{
+	u64 bitmap[SCAN_BITMAP_WORDS(128)];
+	size_t len = strlen(msg);
+	unsigned long sum = 0;
+	size_t i;
+
+	cpu_features_disable(CPU_FEATURE_SSE2 | CPU_FEATURE_AVX2);
+
+	assert_false(cpu_has(CPU_FEATURE_SSE2));
+	assert_false(cpu_has(CPU_FEATURE_AVX2));
+
+	memset(bitmap, 0xff, sizeof(bitmap));
+
+	scan_bitmap(msg, len, 0x01, bitmap);
+
+	for (i = 0; i < 128; i++) {
+		bool bit = bitmap[i / 64] & (1ULL << (i % 64));
+
+		assert_int_equals(i < len && msg[i] == 0x01, bit);
+	}
+
+	for (i = 0; i < len; i++)
+		sum += (u8) msg[i];
+
+	assert_int_equals((u8) sum, buffer_sum_range(msg, msg + len));
+
+	cpu_features_reset();
+}
+
+/* scan_byte() only falls back to SWAR at compile time, so call it directly. */
+void test_scan_byte_swar(void)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	size_t len = strlen(msg);
+	const char *p;
+
+	p = scan_byte_swar(msg, msg + len, 0x01);
+	assert_int_equals(9, p - msg);
+
+	assert_is_null(scan_byte_swar(msg, msg + len, '|'));
+
+	p = scan_byte_swar(msg + 70, msg + len, 0x01);
+	assert_true(p == scan_byte_scalar(msg + 70, msg + len, 0x01));
+	assert_true(p != NULL);
+#endif
+}
@@ -0,0 +1,148 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/proto/nasdaq_itch41_message.h"
+#include "libtrading/byte-order.h"
+
+#include "../tape/builtin-cmds.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <zlib.h>
+
+const char *program = "tape";
+
+/* Enough for the pipelined check to go through its whole pool of chunks */
+#define DATA_SIZE	(40UL << 20)
+
+static void write_message(gzFile file, const void *msg, u16 size)
+{
+	be16 len = cpu_to_be16(size);
+
+	assert_int_equals(sizeof(len), gzwrite(file, &len, sizeof(len)));
+	assert_int_equals(size, gzwrite(file, msg, size));
+}
+
+/*
+ * An ITCH 4.1 file whose messages have different sizes, so that many of
+ * them straddle the boundaries of the chunks the data is inflated into.
+ */
+static unsigned long write_itch41_file(const char *path)
+{
+	struct itch41_msg_timestamp_seconds seconds;
+	struct itch41_msg_order_delete delete;
+	struct itch41_msg_add_order add;
+	unsigned long size = 0;
+	unsigned long i;
+	gzFile file;
+
+	memset(&seconds, 0, sizeof(seconds));
+	memset(&delete, 0, sizeof(delete));
+	memset(&add, 0, sizeof(add));
+
+	seconds.MessageType	= ITCH41_MSG_TIMESTAMP_SECONDS;
+	delete.MessageType	= ITCH41_MSG_ORDER_DELETE;
+	add.MessageType		= ITCH41_MSG_ADD_ORDER;
+
+	file = gzopen(path, "wb1");
+	fail_if(file == NULL);
+
+	for (i = 0; size < DATA_SIZE; i++) {
+		if (i % 7 == 0) {
+			seconds.Second = cpu_to_be32(i);
+			write_message(file, &seconds, sizeof(seconds));
+			size += sizeof(u16) + sizeof(seconds);
+		}
+
+		add.OrderReferenceNumber = cpu_to_be64(i);
+		write_message(file, &add, sizeof(add));
+		size += sizeof(u16) + sizeof(add);
+
+		if (i % 3 == 0) {
+			delete.OrderReferenceNumber = cpu_to_be64(i);
+			write_message(file, &delete, sizeof(delete));
+			size += sizeof(u16) + sizeof(delete);
+		}
+	}
+
+	assert_int_equals(Z_OK, gzclose(file));
+
+	return i;	/* Add Order messages */
+}
+
+/* Run "tape check -q" with the given option and return what it printed. */
+static char *run_check(char *data_path, const char *option, size_t *len)
+{
+	char out_path[] = "/tmp/tape-test-out-XXXXXX";
+	char *argv[5];
+	int argc = 0;
+	char *out;
+	int stdout_fd;
+	int fd;
+
+	fd = mkstemp(out_path);
+	fail_if(fd < 0);
+	unlink(out_path);
+
+	argv[argc++] = (char *) "check";
+	argv[argc++] = (char *) "-q";
+	if (option)
+		argv[argc++] = (char *) option;
+	argv[argc++] = data_path;
+	argv[argc] = NULL;
+
+	fflush(stdout);
+	stdout_fd = dup(STDOUT_FILENO);
+	dup2(fd, STDOUT_FILENO);
+
+	assert_int_equals(0, cmd_check(argc, argv));
+
+	fflush(stdout);
+	dup2(stdout_fd, STDOUT_FILENO);
+	close(stdout_fd);
+
+	*len = lseek(fd, 0, SEEK_END);
+
+	out = calloc(1, *len + 1);
+	fail_if(out == NULL);
+
+	assert_int_equals(*len, pread(fd, out, *len, 0));
+
+	close(fd);
+
+	return out;
+}
+
+void test_tape_check_pipelined(void)
+{
+	char data_path[] = "/tmp/tape-test-XXXXXX";
+	char *serial, *pipelined;
+	unsigned long nr_add;
+	char expected[64];
+	size_t serial_len;
+	size_t len;
+	int fd;
+
+	fd = mkstemp(data_path);
+	fail_if(fd < 0);
+	close(fd);
+
+	nr_add = write_itch41_file(data_path);
+
+	serial		= run_check(data_path, NULL, &serial_len);
+	pipelined	= run_check(data_path, "-p", &len);
+
+	/* Every message counted once, whichever way the file was read */
+	snprintf(expected, sizeof(expected), "%'14.0f  Add Order\n", (double) nr_add);
+	assert_true(strstr(serial, expected) != NULL);
+	assert_int_equals(serial_len, len);
+	assert_str_equals(serial, pipelined, len);
+
+	free(serial);
+	free(pipelined);
+
+	unlink(data_path);
+}
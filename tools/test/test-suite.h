@@ -0,0 +1,54 @@
+#ifndef TEST_SUITE_H
+#define TEST_SUITE_H
+extern void test_arena_alloc(void);
+extern void test_arena_grow(void);
+extern void test_boe_login_request(void);
+extern void test_boe_login_response(void);
+extern void test_boe_logout_request(void);
+extern void test_boe_client_heartbeat(void);
+extern void test_boe_logout(void);
+extern void test_boe_server_heartbeat(void);
+extern void test_boe_replay_complete(void);
+extern void test_boe_message_view_partial(void);
+extern void test_buffer_mirror_wrap(void);
+extern void test_buffer_sum_range(void);
+extern void test_buffer_recv_ts(void);
+extern void test_buffer_view(void);
+extern void test_buffer_mmap_advance(void);
+extern void test_fast_session_recv_batch(void);
+extern void test_fix_journal_append(void);
+extern void test_fix_log_write(void);
+extern void test_fix_message_parse(void);
+extern void test_fix_message_parse_one_pass(void);
+extern void test_fix_message_parse_one_pass_partial(void);
+extern void test_fix_message_parse_one_pass_garbled(void);
+extern void test_fix_message_get_field(void);
+extern void test_fix_message_get_field_many_tags(void);
+extern void test_fix_message_parse_lazy(void);
+extern void test_fix_decimal_parse(void);
+extern void test_fix_message_parse_decimal(void);
+extern void test_fix_message_parse_groups(void);
+extern void test_fix_message_parse_groups_short_count(void);
+extern void test_fix_message_parse_many_fields(void);
+extern void test_fix_message_caller_fields(void);
+extern void test_fix_message_parse_dialect(void);
+extern void test_fix_message_parse_layout(void);
+extern void test_fix_session_recv_batch(void);
+extern void test_fix_session_send_cork(void);
+extern void test_fix_session_flush_short(void);
+extern void test_fix_session_resend(void);
+extern void test_fix_session_state(void);
+extern void test_fix_template_set_field(void);
+extern void test_mbt_quote_decode_logging_on(void);
+extern void test_scan_byte(void);
+extern void test_scan_bitmap(void);
+extern void test_scan_bitmap_swar(void);
+extern void test_scan_byte_swar(void);
+extern void test_tape_check_pipelined(void);
+extern void test_fix_field_unparse_str(void);
+extern void test_fix_field_unparse_checksum(void);
+extern void test_fix_field_unparse_decimal(void);
+extern void test_fix_timestamp_update(void);
+extern void test_uring_loopback(void);
+extern void test_uring_sends_exceed_sq(void);
+#endif
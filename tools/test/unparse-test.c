@@ -49,3 +49,49 @@ void test_fix_field_unparse_checksum(void)
 
 	teardown();
 }
+
+void test_fix_field_unparse_decimal(void)
+{
+	setup();
+
+	expected = "44=-0.0125\1";
+
+	field = FIX_DECIMAL_FIELD(Price, -125, -4);
+
+	fix_field_unparse(&field, buf);
+
+	assert_str_equals(expected, buf->data, strlen(expected));
+
+	teardown();
+}
+
+void test_fix_timestamp_update(void)
+{
+	struct timespec now = { 1356607243, 123456789 };	/* 20121227-11:20:43 */
+	struct fix_timestamp timestamp;
+	char str[64];
+
+	fix_timestamp_init(&timestamp, str, FIX_TIME_MILLI);
+	assert_int_equals(0, fix_timestamp_update(&timestamp, &now));
+	assert_int_equals(21, fix_timestamp_len(&timestamp));
+	assert_str_equals("20121227-11:20:43.123", str, 21);
+
+	fix_timestamp_init(&timestamp, str, FIX_TIME_MICRO);
+	assert_int_equals(0, fix_timestamp_update(&timestamp, &now));
+	assert_str_equals("20121227-11:20:43.123456", str, 24);
+
+	fix_timestamp_init(&timestamp, str, FIX_TIME_NANO);
+	assert_int_equals(0, fix_timestamp_update(&timestamp, &now));
+	assert_str_equals("20121227-11:20:43.123456789", str, 27);
+
+	/* Within the minute only the seconds change... */
+	now.tv_sec += 16;
+	now.tv_nsec = 5;
+	assert_int_equals(0, fix_timestamp_update(&timestamp, &now));
+	assert_str_equals("20121227-11:20:59.000000005", str, 27);
+
+	/* ...and past it the date too. */
+	now.tv_sec += 12 * 3600 + 40 * 60 + 1;
+	assert_int_equals(0, fix_timestamp_update(&timestamp, &now));
+	assert_str_equals("20121228-00:01:00.000000005", str, 27);
+}
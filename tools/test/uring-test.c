@@ -0,0 +1,239 @@
+#include "test-suite.h"
+#include "harness.h"
+
+#include "libtrading/read-write.h"
+#include "libtrading/uring.h"
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+
+#define NR_PAIRS	8
+
+/* Connect two TCP sockets over the loopback interface. */
+static void loopback_pair(int sv[2])
+{
+	struct sockaddr_in sa;
+	socklen_t len = sizeof(sa);
+	int lfd;
+
+	memset(&sa, 0, sizeof(sa));
+
+	sa.sin_family		= AF_INET;
+	sa.sin_addr.s_addr	= htonl(INADDR_LOOPBACK);
+
+	lfd = socket(AF_INET, SOCK_STREAM, 0);
+	fail_if(lfd < 0);
+
+	fail_if(bind(lfd, (struct sockaddr *) &sa, sizeof(sa)) < 0);
+	fail_if(listen(lfd, 1) < 0);
+	fail_if(getsockname(lfd, (struct sockaddr *) &sa, &len) < 0);
+
+	sv[0] = socket(AF_INET, SOCK_STREAM, 0);
+	fail_if(sv[0] < 0);
+
+	fail_if(connect(sv[0], (struct sockaddr *) &sa, sizeof(sa)) < 0);
+
+	sv[1] = accept(lfd, NULL, NULL);
+	fail_if(sv[1] < 0);
+
+	close(lfd);
+}
+
+static void close_pair(int sv[2])
+{
+	uring_close(sv[0]);
+	uring_close(sv[1]);
+
+	close(sv[0]);
+	close(sv[1]);
+}
+
+/* Read exactly 'len' bytes through the io_recv hook. */
+static void recv_all(int fd, char *data, size_t len)
+{
+	ssize_t ret;
+
+	while (len) {
+		ret = io_recv(fd, data, len, 0);
+		fail_if(ret <= 0);
+
+		data	+= ret;
+		len	-= ret;
+	}
+}
+
+static ssize_t send_string(int fd, const char *s)
+{
+	struct iovec iov = { .iov_base = (void *) s, .iov_len = strlen(s) };
+
+	return io_sendmsg(fd, &iov, 1, 0);
+}
+
+/* Kernels without multishot receive, or sandboxes without io_uring, skip the tests. */
+static bool setup(struct uring_cfg *cfg)
+{
+	if (uring_init(cfg) < 0) {
+		fprintf(stderr, "io_uring not available (%s), skipping\n", strerror(errno));
+		return false;
+	}
+
+	assert_true(uring_enabled());
+
+	return true;
+}
+
+void test_uring_loopback(void)
+{
+	struct iovec iov[2];
+	struct uring_cfg cfg;
+	char data[64];
+	int sv[2];
+
+	uring_cfg_init(&cfg);
+
+	if (!setup(&cfg))
+		return;
+
+	loopback_pair(sv);
+
+	assert_int_equals(5, send_string(sv[0], "35=D\001"));
+
+	iov[0] = (struct iovec) { .iov_base = (void *) "35=F", .iov_len = 4 };
+	iov[1] = (struct iovec) { .iov_base = (void *) "\001", .iov_len = 1 };
+	assert_int_equals(5, io_sendmsg(sv[0], iov, 2, 0));
+
+	/* In order, each byte once */
+	recv_all(sv[1], data, 10);
+	assert_str_equals("35=D\00135=F\001", data, 10);
+
+	/* And back */
+	assert_int_equals(5, send_string(sv[1], "35=8\001"));
+	recv_all(sv[0], data, 5);
+	assert_str_equals("35=8\001", data, 5);
+
+	assert_int_equals(-1, io_recv(sv[0], data, sizeof(data), MSG_DONTWAIT));
+	assert_int_equals(EAGAIN, errno);
+
+	close_pair(sv);
+
+	uring_exit();
+
+	assert_false(uring_enabled());
+}
+
+/*
+ * More deferred sends than the submission queue has entries: preparing them
+ * submits the SQ midway and each socket must still see its message once.
+ */
+void test_uring_sends_exceed_sq(void)
+{
+	int sv[NR_PAIRS][2];
+	struct uring_stats stats;
+	struct uring_cfg cfg;
+	char expected[16];
+	char data[16];
+	unsigned long i;
+
+	uring_cfg_init(&cfg);
+
+	cfg.entries	= 2;
+	cfg.defer_send	= true;
+
+	if (!setup(&cfg))
+		return;
+
+	for (i = 0; i < NR_PAIRS; i++)
+		loopback_pair(sv[i]);
+
+	for (i = 0; i < NR_PAIRS; i++) {
+		snprintf(expected, sizeof(expected), "11=%lu\001", i);
+		assert_int_equals(strlen(expected), send_string(sv[i][0], expected));
+	}
+
+	assert_int_equals(0, uring_flush());
+
+	for (i = 0; i < NR_PAIRS; i++) {
+		snprintf(expected, sizeof(expected), "11=%lu\001", i);
+
+		recv_all(sv[i][1], data, strlen(expected));
+		assert_str_equals(expected, data, strlen(expected));
+	}
+
+	/* Let the send completions in, then make sure nothing was sent twice. */
+	uring_get_stats(&stats);
+	while (stats.nr_send_cqes < NR_PAIRS) {
+		assert_int_equals(0, uring_flush());
+		uring_get_stats(&stats);
+	}
+
+	for (i = 0; i < NR_PAIRS; i++) {
+		assert_int_equals(-1, io_recv(sv[i][1], data, sizeof(data), MSG_DONTWAIT));
+		assert_int_equals(EAGAIN, errno);
+	}
+
+	for (i = 0; i < NR_PAIRS; i++)
+		close_pair(sv[i]);
+
+	uring_exit();
+}
+
+/*
+ * A socket closed without uring_close() while its receive is armed: the
+ * next socket under the same fd number must not inherit the stale state,
+ * and dropping that state must really close the old socket.
+ */
+void test_uring_fd_reused(void)
+{
+	struct pollfd pfd;
+	struct uring_cfg cfg;
+	char data[16];
+	int old[2], sv[2];
+	int i;
+
+	uring_cfg_init(&cfg);
+
+	if (!setup(&cfg))
+		return;
+
+	loopback_pair(old);
+
+	assert_int_equals(5, send_string(old[0], "35=0\001"));
+	recv_all(old[1], data, 5);
+
+	/* Close the old socket by putting a new one under its number. */
+	loopback_pair(sv);
+
+	fail_if(dup2(sv[1], old[1]) < 0);
+	close(sv[1]);
+	sv[1] = old[1];
+
+	assert_int_equals(5, send_string(sv[0], "35=1\001"));
+
+	for (i = 0; i < 1000; i++) {
+		if (io_recv(sv[1], data, 5, MSG_DONTWAIT) == 5)
+			break;
+
+		fail_if(errno != EAGAIN);
+		usleep(1000);
+	}
+
+	assert_str_equals("35=1\001", data, 5);
+
+	/* The old socket's peer sees it go away. */
+	pfd = (struct pollfd) { .fd = old[0], .events = POLLIN };
+	assert_int_equals(1, poll(&pfd, 1, 1000));
+	assert_int_equals(0, recv(old[0], data, sizeof(data), MSG_DONTWAIT));
+
+	uring_close(old[0]);
+	close(old[0]);
+
+	close_pair(sv);
+
+	uring_exit();
+}